@@ -19,6 +19,16 @@
 #import <Foundation/Foundation.h>
 #import "GTMDefines.h"
 
+/// The container format used by the zlib compression apis.
+typedef NS_ENUM(NSInteger, GTMNSDataZlibFormat) {
+  // A zlib stream ("deflate").
+  GTMNSDataZlibFormatZlib,
+  // A gzip stream.
+  GTMNSDataZlibFormatGzip,
+  // A raw deflate stream, without any header.
+  GTMNSDataZlibFormatRaw,
+};
+
 /// Helpers for dealing w/ zlib inflate/deflate calls.
 @interface NSData (GTMZLibAdditions)
 
@@ -119,6 +129,17 @@
 + (NSData *)gtm_dataByInflatingData:(NSData *)data
                               error:(NSError **)error;
 
+/// Return an autoreleased NSData w/ the result of decompressing the bytes.
+//
+// The bytes to decompress can be zlib or gzip payloads. |expectedLength| is
+// the expected size of the decompressed result (e.g. taken from the payload's
+// metadata); the output is inflated directly into a single allocation of that
+// size and only grows if the hint was too small. Pass 0 if unknown.
++ (NSData *)gtm_dataByInflatingBytes:(const void *)bytes
+                              length:(NSUInteger)length
+                      expectedLength:(NSUInteger)expectedLength
+                               error:(NSError **)error;
+
 #pragma mark "Raw" Compression Support
 
 // NOTE: raw deflate is *NOT* gzip or deflate.  it does not include a header
@@ -182,6 +203,100 @@
 
 @end
 
+#pragma mark Streaming Support
+
+/// Incrementally decompresses zlib, gzip or raw deflate data.
+//
+// Input is pushed as it becomes available (e.g. while it is being downloaded)
+// and output is pulled into caller supplied buffers, so neither side has to be
+// held in memory in full. Pushed NSData objects are kept with -copy until they
+// have been consumed: immutable data is only retained, mutable data is copied
+// so later changes to it can't affect the stream. Not thread safe.
+@interface GTMZlibInflateStream : NSObject
+
+/// Creates a stream that autodetects zlib or gzip data, or expects raw
+/// deflate data if |isRawData| is YES.
+- (instancetype)initWithRawData:(BOOL)isRawData;
+
+/// Queues |data| to be decompressed, see the note above on copying.
+- (void)pushData:(NSData *)data;
+/// Queues a copy of |bytes| to be decompressed.
+- (void)pushBytes:(const void *)bytes length:(NSUInteger)length;
+
+/// Decompresses queued input into |buffer|.
+//
+// Returns the number of bytes written, which is less than |maxLength| once
+// the queued input has been used up or the end of the compressed stream was
+// reached. Returns -1 and sets |error| on failure; the stream is unusable
+// after that.
+- (NSInteger)pullBytes:(void *)buffer
+             maxLength:(NSUInteger)maxLength
+                 error:(NSError **)error;
+
+/// Returns an autoreleased NSData w/ all output that can be produced from the
+/// input queued so far, or nil and sets |error| on failure.
+- (NSData *)pullAvailableDataWithError:(NSError **)error;
+
+/// The maximum ratio of output bytes to input bytes before the stream fails
+/// with GTMNSDataZlibErrorInflateRatioExceeded, guarding against
+/// decompression bombs. 0 (the default) means no limit.
+@property(nonatomic, assign) NSUInteger maximumInflateRatio;
+
+/// YES once the end of the compressed stream has been reached.
+@property(nonatomic, readonly, getter=isFinished) BOOL finished;
+
+/// The number of compressed bytes consumed so far.
+@property(nonatomic, readonly) unsigned long long totalBytesIn;
+
+/// The number of decompressed bytes produced so far.
+@property(nonatomic, readonly) unsigned long long totalBytesOut;
+
+@end
+
+/// Incrementally compresses data into a zlib, gzip or raw deflate stream.
+//
+// The push/pull semantics (including how pushed data is kept) match
+// GTMZlibInflateStream. Once all input has been
+// pushed, call |finishInput| and keep pulling until |isFinished| is YES.
+// Not thread safe.
+@interface GTMZlibDeflateStream : NSObject
+
+/// Creates a stream producing |format| data at the given compression |level|.
+//
+// |level| can be 1-9, any other values will be clipped to that range.
+- (instancetype)initWithFormat:(GTMNSDataZlibFormat)format
+              compressionLevel:(int)level;
+
+/// Queues |data| to be compressed.
+- (void)pushData:(NSData *)data;
+/// Queues a copy of |bytes| to be compressed.
+- (void)pushBytes:(const void *)bytes length:(NSUInteger)length;
+
+/// Marks the end of the input, no more data may be pushed after this.
+- (void)finishInput;
+
+/// Compresses queued input into |buffer|.
+//
+// Returns the number of bytes written, or -1 and sets |error| on failure.
+- (NSInteger)pullBytes:(void *)buffer
+             maxLength:(NSUInteger)maxLength
+                 error:(NSError **)error;
+
+/// Returns an autoreleased NSData w/ all output that can be produced from the
+/// input queued so far, or nil and sets |error| on failure.
+- (NSData *)pullAvailableDataWithError:(NSError **)error;
+
+/// YES once the end of the compressed stream has been written.
+@property(nonatomic, readonly, getter=isFinished) BOOL finished;
+
+/// The number of uncompressed bytes consumed so far.
+@property(nonatomic, readonly) unsigned long long totalBytesIn;
+
+/// The number of compressed bytes produced so far.
+@property(nonatomic, readonly) unsigned long long totalBytesOut;
+
+@end
+
 FOUNDATION_EXPORT NSString *const GTMNSDataZlibErrorDomain;
 FOUNDATION_EXPORT NSString *const GTMNSDataZlibErrorKey;  // NSNumber
 FOUNDATION_EXPORT NSString *const GTMNSDataZlibRemainingBytesKey;  // NSNumber
@@ -195,5 +310,10 @@ typedef NS_ENUM(NSInteger, GTMNSDataZlibError) {
   GTMNSDataZlibErrorInternal,
   // There was left over data in the buffer that was not used.
   // GTMNSDataZlibRemainingBytesKey will contain number of remaining bytes.
-  GTMNSDataZlibErrorDataRemaining
+  GTMNSDataZlibErrorDataRemaining,
+  // A GTMZlibInflateStream produced more output than its
+  // maximumInflateRatio allows.
+  GTMNSDataZlibErrorInflateRatioExceeded,
+  // A stream was used after it failed or after its input was finished.
+  GTMNSDataZlibErrorStreamClosed
 };
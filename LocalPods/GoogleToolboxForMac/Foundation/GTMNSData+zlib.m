@@ -20,18 +20,137 @@
 #import <zlib.h>
 #import "GTMDefines.h"
 
-#define kChunkSize 1024
-
 NSString *const GTMNSDataZlibErrorDomain = @"com.google.GTMNSDataZlibErrorDomain";
 NSString *const GTMNSDataZlibErrorKey = @"GTMNSDataZlibErrorKey";
 NSString *const GTMNSDataZlibRemainingBytesKey = @"GTMNSDataZlibRemainingBytesKey";
 
 typedef enum {
-  CompressionModeZlib,
-  CompressionModeGzip,
-  CompressionModeRaw,
+  CompressionModeZlib = GTMNSDataZlibFormatZlib,
+  CompressionModeGzip = GTMNSDataZlibFormatGzip,
+  CompressionModeRaw = GTMNSDataZlibFormatRaw,
 } CompressionMode;
 
+// Upper bound on a single zlib output window, zlib counts in 32bit |uInt|s.
+#define kMaxZlibWindow ((NSUInteger)UINT_MAX)
+
+// Initial output size used by the stream convenience methods when nothing
+// better is known.
+#define kDefaultStreamChunkSize (64 * 1024)
+
+static NSError *GTMZlibError(int retCode, const char *msg) {
+  NSMutableDictionary *userInfo =
+      [NSMutableDictionary dictionaryWithObject:[NSNumber numberWithInt:retCode]
+                                         forKey:GTMNSDataZlibErrorKey];
+  if (msg) {
+    NSString *message = [NSString stringWithUTF8String:msg];
+    if (message) {
+      [userInfo setObject:message forKey:NSLocalizedDescriptionKey];
+    }
+  }
+  return [NSError errorWithDomain:GTMNSDataZlibErrorDomain
+                             code:GTMNSDataZlibErrorInternal
+                         userInfo:userInfo];
+}
+
+static int GTMZlibClampCompressionLevel(int level) {
+  if (level == Z_DEFAULT_COMPRESSION) {
+    // the default value is actually outside the range, so we have to let it
+    // through specifically.
+    return level;
+  } else if (level < Z_BEST_SPEED) {
+    return Z_BEST_SPEED;
+  } else if (level > Z_BEST_COMPRESSION) {
+    return Z_BEST_COMPRESSION;
+  }
+  return level;
+}
+
+static int GTMZlibDeflateWindowBits(GTMNSDataZlibFormat format) {
+  int windowBits = 15; // the default
+  switch (format) {
+    case GTMNSDataZlibFormatZlib:
+      // nothing to do
+      break;
+
+    case GTMNSDataZlibFormatGzip:
+      windowBits += 16; // enable gzip header instead of zlib header
+      break;
+
+    case GTMNSDataZlibFormatRaw:
+      windowBits *= -1; // Negative to mean no header.
+      break;
+  }
+  return windowBits;
+}
+
+// A malloc'd output buffer. Unlike NSMutableData's -setLength: and
+// -increaseLengthBy:, growing it doesn't zero-fill memory that zlib is about
+// to overwrite anyway.
+typedef struct {
+  unsigned char *bytes;
+  NSUInteger capacity;
+} GTMZlibOutputBuffer;
+
+// Grows |buffer| to hold at least |capacity| bytes, keeping its contents.
+// Returns NO if the memory couldn't be allocated.
+static BOOL GTMZlibOutputBufferReserve(GTMZlibOutputBuffer *buffer,
+                                       NSUInteger capacity) {
+  if (capacity <= buffer->capacity) {
+    return YES;
+  }
+  unsigned char *bytes = realloc(buffer->bytes, capacity);
+  if (!bytes) {
+    return NO;
+  }
+  buffer->bytes = bytes;
+  buffer->capacity = capacity;
+  return YES;
+}
+
+static void GTMZlibOutputBufferFree(GTMZlibOutputBuffer *buffer) {
+  free(buffer->bytes);
+  buffer->bytes = NULL;
+  buffer->capacity = 0;
+}
+
+// Hands the first |length| bytes of |buffer| over to an autoreleased NSData,
+// without copying them. |buffer| is empty afterwards.
+static NSData *GTMZlibOutputBufferTakeData(GTMZlibOutputBuffer *buffer,
+                                           NSUInteger length) {
+  if (length == 0) {
+    GTMZlibOutputBufferFree(buffer);
+    return [NSData data];
+  }
+  // Give back the unused tail; keeping the larger block is fine if that fails.
+  unsigned char *bytes = realloc(buffer->bytes, length);
+  if (!bytes) {
+    bytes = buffer->bytes;  // COV_NF_LINE
+  }
+  buffer->bytes = NULL;
+  buffer->capacity = 0;
+  return [NSData dataWithBytesNoCopy:bytes length:length freeWhenDone:YES];
+}
+
+// Points |strm|'s output window at the unused tail of |result|, growing
+// |result| first if it is full. Returns NO if it couldn't be grown.
+static BOOL GTMZlibPrepareOutput(z_stream *strm, GTMZlibOutputBuffer *result) {
+  NSUInteger produced = (NSUInteger)strm->total_out;
+  if (produced >= result->capacity) {
+    NSUInteger growBy = MAX(result->capacity, (NSUInteger)kDefaultStreamChunkSize);
+    if (!GTMZlibOutputBufferReserve(result, result->capacity + growBy)) {
+      return NO;  // COV_NF_LINE
+    }
+  }
+  NSUInteger available = result->capacity - produced;
+  strm->next_out = result->bytes + produced;
+  strm->avail_out = (uInt)MIN(available, kMaxZlibWindow);
+  return YES;
+}
+
+static NSError *GTMZlibOutOfMemoryError(void) {
+  return GTMZlibError(Z_MEM_ERROR, NULL);
+}
+
 @interface NSData (GTMZlibAdditionsPrivate)
 + (NSData *)gtm_dataByCompressingBytes:(const void *)bytes
                                 length:(NSUInteger)length
@@ -41,6 +160,7 @@ typedef enum {
 + (NSData *)gtm_dataByInflatingBytes:(const void *)bytes
                               length:(NSUInteger)length
                            isRawData:(BOOL)isRawData
+                      expectedLength:(NSUInteger)expectedLength
                                error:(NSError **)error;
 @end
 
@@ -67,51 +187,29 @@ typedef enum {
   }
 #endif
 
-  if (level == Z_DEFAULT_COMPRESSION) {
-    // the default value is actually outside the range, so we have to let it
-    // through specifically.
-  } else if (level < Z_BEST_SPEED) {
-    level = Z_BEST_SPEED;
-  } else if (level > Z_BEST_COMPRESSION) {
-    level = Z_BEST_COMPRESSION;
-  }
+  level = GTMZlibClampCompressionLevel(level);
 
   z_stream strm;
   bzero(&strm, sizeof(z_stream));
 
   int memLevel = 8; // the default
-  int windowBits = 15; // the default
-  switch (mode) {
-    case CompressionModeZlib:
-      // nothing to do
-      break;
-
-    case CompressionModeGzip:
-      windowBits += 16; // enable gzip header instead of zlib header
-      break;
-
-    case CompressionModeRaw:
-      windowBits *= -1; // Negative to mean no header.
-      break;
-  }
+  int windowBits = GTMZlibDeflateWindowBits((GTMNSDataZlibFormat)mode);
   int retCode;
   if ((retCode = deflateInit2(&strm, level, Z_DEFLATED, windowBits,
                               memLevel, Z_DEFAULT_STRATEGY)) != Z_OK) {
     // COV_NF_START - no real way to force this in a unittest (we guard all args)
     if (error) {
-      NSDictionary *userInfo = [NSDictionary dictionaryWithObject:[NSNumber numberWithInt:retCode]
-                                                           forKey:GTMNSDataZlibErrorKey];
-      *error = [NSError errorWithDomain:GTMNSDataZlibErrorDomain
-                                   code:GTMNSDataZlibErrorInternal
-                               userInfo:userInfo];
+      *error = GTMZlibError(retCode, NULL);
     }
     return nil;
     // COV_NF_END
   }
 
-  // hint the size at 1/4 the input size
-  NSMutableData *result = [NSMutableData dataWithCapacity:(length/4)];
-  unsigned char output[kChunkSize];
+  // deflateBound is a worst case for the configured stream, so the output is
+  // normally produced into a single allocation in a single deflate() call.
+  uLong bound = deflateBound(&strm, (uLong)length);
+  GTMZlibOutputBuffer result = { NULL, 0 };
+  GTMZlibOutputBufferReserve(&result, (NSUInteger)bound);
 
   // setup the input
   strm.avail_in = (unsigned int)length;
@@ -119,9 +217,16 @@ typedef enum {
 
   // loop to collect the data
   do {
-    // update what we're passing in
-    strm.avail_out = kChunkSize;
-    strm.next_out = output;
+    if (!GTMZlibPrepareOutput(&strm, &result)) {
+      // COV_NF_START - no real way to force an allocation failure in a unittest
+      if (error) {
+        *error = GTMZlibOutOfMemoryError();
+      }
+      GTMZlibOutputBufferFree(&result);
+      deflateEnd(&strm);
+      return nil;
+      // COV_NF_END
+    }
     retCode = deflate(&strm, Z_FINISH);
     if ((retCode != Z_OK) && (retCode != Z_STREAM_END)) {
       // COV_NF_START - no real way to force this in a unittest
@@ -129,22 +234,13 @@ typedef enum {
       // here would be some internal issue w/in zlib, and there isn't any real
       // way to test it)
       if (error) {
-        NSDictionary *userInfo = [NSDictionary dictionaryWithObject:[NSNumber numberWithInt:retCode]
-                                                             forKey:GTMNSDataZlibErrorKey];
-        *error = [NSError errorWithDomain:GTMNSDataZlibErrorDomain
-                                     code:GTMNSDataZlibErrorInternal
-                                 userInfo:userInfo];
+        *error = GTMZlibError(retCode, NULL);
       }
+      GTMZlibOutputBufferFree(&result);
       deflateEnd(&strm);
       return nil;
       // COV_NF_END
     }
-    // collect what we got
-    unsigned gotBack = kChunkSize - strm.avail_out;
-    if (gotBack > 0) {
-      [result appendBytes:output length:gotBack];
-    }
-
   } while (retCode == Z_OK);
 
   // if the loop exits, we used all input and the stream ended
@@ -155,15 +251,18 @@ typedef enum {
                 @"thought we finished deflate w/o getting a result of stream end, code %d",
                 retCode);
 
+  NSData *compressed = GTMZlibOutputBufferTakeData(&result, (NSUInteger)strm.total_out);
+
   // clean up
   deflateEnd(&strm);
 
-  return result;
+  return compressed;
 } // gtm_dataByCompressingBytes:length:compressionLevel:useGzip:
 
 + (NSData *)gtm_dataByInflatingBytes:(const void *)bytes
                               length:(NSUInteger)length
                            isRawData:(BOOL)isRawData
+                      expectedLength:(NSUInteger)expectedLength
                                error:(NSError **)error {
   if (!bytes || !length) {
     return nil;
@@ -194,52 +293,45 @@ typedef enum {
   if ((retCode = inflateInit2(&strm, windowBits)) != Z_OK) {
     // COV_NF_START - no real way to force this in a unittest (we guard all args)
     if (error) {
-      NSDictionary *userInfo = [NSDictionary dictionaryWithObject:[NSNumber numberWithInt:retCode]
-                                                           forKey:GTMNSDataZlibErrorKey];
-      *error = [NSError errorWithDomain:GTMNSDataZlibErrorDomain
-                                   code:GTMNSDataZlibErrorInternal
-                               userInfo:userInfo];
+      *error = GTMZlibError(retCode, NULL);
     }
     return nil;
     // COV_NF_END
   }
 
-  // hint the size at 4x the input size
-  NSMutableData *result = [NSMutableData dataWithCapacity:(length*4)];
-  unsigned char output[kChunkSize];
+  // Inflate straight into the result; when no hint is given, guess at 4x the
+  // input size. The buffer only grows if the guess was too small.
+  if (expectedLength == 0) {
+    expectedLength = length * 4;
+  }
+  GTMZlibOutputBuffer output = { NULL, 0 };
+  GTMZlibOutputBufferReserve(&output, expectedLength);
 
   // loop to collect the data
   do {
-    // update what we're passing in
-    strm.avail_out = kChunkSize;
-    strm.next_out = output;
+    if (!GTMZlibPrepareOutput(&strm, &output)) {
+      // COV_NF_START - no real way to force an allocation failure in a unittest
+      if (error) {
+        *error = GTMZlibOutOfMemoryError();
+      }
+      GTMZlibOutputBufferFree(&output);
+      inflateEnd(&strm);
+      return nil;
+      // COV_NF_END
+    }
     retCode = inflate(&strm, Z_NO_FLUSH);
     if ((retCode != Z_OK) && (retCode != Z_STREAM_END)) {
       if (error) {
-        NSMutableDictionary *userInfo =
-            [NSMutableDictionary dictionaryWithObject:[NSNumber numberWithInt:retCode]
-                                               forKey:GTMNSDataZlibErrorKey];
-        if (strm.msg) {
-          NSString *message = [NSString stringWithUTF8String:strm.msg];
-          if (message) {
-            [userInfo setObject:message forKey:NSLocalizedDescriptionKey];
-          }
-        }
-        *error = [NSError errorWithDomain:GTMNSDataZlibErrorDomain
-                                     code:GTMNSDataZlibErrorInternal
-                                 userInfo:userInfo];
+        *error = GTMZlibError(retCode, strm.msg);
       }
+      GTMZlibOutputBufferFree(&output);
       inflateEnd(&strm);
       return nil;
     }
-    // collect what we got
-    unsigned gotBack = kChunkSize - strm.avail_out;
-    if (gotBack > 0) {
-      [result appendBytes:output length:gotBack];
-    }
-
   } while (retCode == Z_OK);
 
+  NSData *result = GTMZlibOutputBufferTakeData(&output, (NSUInteger)strm.total_out);
+
   // make sure there wasn't more data tacked onto the end of a valid compressed
   // stream.
   if (strm.avail_in != 0) {
@@ -262,7 +354,7 @@ typedef enum {
   inflateEnd(&strm);
 
   return result;
-} // gtm_dataByInflatingBytes:length:windowBits:
+} // gtm_dataByInflatingBytes:length:isRawData:expectedLength:error:
 
 @end
 
@@ -416,6 +508,7 @@ typedef enum {
   return [self gtm_dataByInflatingBytes:bytes
                                  length:length
                               isRawData:NO
+                         expectedLength:0
                                   error:error];
 } // gtm_dataByInflatingBytes:length:error:
 
@@ -428,9 +521,21 @@ typedef enum {
   return [self gtm_dataByInflatingBytes:[data bytes]
                                  length:[data length]
                               isRawData:NO
+                         expectedLength:0
                                   error:error];
 } // gtm_dataByInflatingData:
 
++ (NSData *)gtm_dataByInflatingBytes:(const void *)bytes
+                              length:(NSUInteger)length
+                      expectedLength:(NSUInteger)expectedLength
+                               error:(NSError **)error {
+  return [self gtm_dataByInflatingBytes:bytes
+                                 length:length
+                              isRawData:NO
+                         expectedLength:expectedLength
+                                  error:error];
+} // gtm_dataByInflatingBytes:length:expectedLength:error:
+
 #pragma mark -
 
 + (NSData *)gtm_dataByRawDeflatingBytes:(const void *)bytes
@@ -512,6 +617,7 @@ typedef enum {
   return [self gtm_dataByInflatingBytes:bytes
                                  length:length
                               isRawData:YES
+                         expectedLength:0
                                   error:error];
 } // gtm_dataByRawInflatingBytes:length:error:
 
@@ -525,7 +631,357 @@ typedef enum {
   return [self gtm_dataByInflatingBytes:[data bytes]
                                  length:[data length]
                               isRawData:YES
+                         expectedLength:0
                                   error:error];
 } // gtm_dataByRawInflatingData:error:
 
 @end
+
+
+#pragma mark -
+
+static NSError *GTMZlibStreamClosedError(void) {
+  return [NSError errorWithDomain:GTMNSDataZlibErrorDomain
+                             code:GTMNSDataZlibErrorStreamClosed
+                         userInfo:nil];
+}
+
+// Drains everything |pull| can currently produce into one NSData, doubling
+// the buffer (and pulling straight into it) as needed.
+static NSData *GTMZlibPullAvailableData(NSInteger (^pull)(void *buffer,
+                                                          NSUInteger maxLength,
+                                                          NSError **error),
+                                        NSError **error) {
+  GTMZlibOutputBuffer result = { NULL, 0 };
+  NSUInteger used = 0;
+  while (YES) {
+    NSUInteger capacity = MAX(result.capacity * 2, (NSUInteger)kDefaultStreamChunkSize);
+    if (!GTMZlibOutputBufferReserve(&result, capacity)) {
+      // COV_NF_START - no real way to force an allocation failure in a unittest
+      if (error) {
+        *error = GTMZlibOutOfMemoryError();
+      }
+      GTMZlibOutputBufferFree(&result);
+      return nil;
+      // COV_NF_END
+    }
+    NSUInteger space = result.capacity - used;
+    NSInteger got = pull(result.bytes + used, space, error);
+    if (got < 0) {
+      GTMZlibOutputBufferFree(&result);
+      return nil;
+    }
+    used += (NSUInteger)got;
+    if ((NSUInteger)got < space) {
+      break;
+    }
+  }
+  return GTMZlibOutputBufferTakeData(&result, used);
+}
+
+// Queue of pushed input, handed to a z_stream one window at a time.
+@interface GTMZlibInputQueue : NSObject {
+ @private
+  NSMutableArray *pending_;
+  NSData *current_;
+}
+- (void)pushData:(NSData *)data;
+// Points |strm| at the next unconsumed input once its window is used up.
+- (void)refillStream:(z_stream *)strm;
+// YES if |strm|'s window holds the last of the queued input.
+- (BOOL)isLastWindowForStream:(z_stream *)strm;
+@end
+
+@implementation GTMZlibInputQueue
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    pending_ = [[NSMutableArray alloc] init];
+  }
+  return self;
+}
+
+- (void)pushData:(NSData *)data {
+  if ([data length] > 0) {
+    [pending_ addObject:data];
+  }
+}
+
+- (void)refillStream:(z_stream *)strm {
+  if (strm->avail_in > 0) {
+    return;
+  }
+
+  NSUInteger offset = 0;
+  if (current_) {
+    offset = (NSUInteger)(strm->next_in - (const unsigned char *)[current_ bytes]);
+    if (offset >= [current_ length]) {
+      current_ = nil;
+      offset = 0;
+    }
+  }
+
+  if (!current_) {
+    if ([pending_ count] == 0) {
+      return;
+    }
+    current_ = [pending_ objectAtIndex:0];
+    [pending_ removeObjectAtIndex:0];
+  }
+
+  strm->next_in = (unsigned char *)[current_ bytes] + offset;
+  strm->avail_in = (uInt)MIN([current_ length] - offset, kMaxZlibWindow);
+}
+
+- (BOOL)isLastWindowForStream:(z_stream *)strm {
+  if ([pending_ count] > 0) {
+    return NO;
+  }
+  if (!current_) {
+    return YES;
+  }
+  const unsigned char *windowEnd = strm->next_in + strm->avail_in;
+  return (NSUInteger)(windowEnd - (const unsigned char *)[current_ bytes]) == [current_ length];
+}
+
+@end
+
+@implementation GTMZlibInflateStream {
+  z_stream strm_;
+  GTMZlibInputQueue *input_;
+  BOOL initialized_;
+  BOOL failed_;
+}
+
+@synthesize maximumInflateRatio = maximumInflateRatio_;
+@synthesize finished = finished_;
+
+- (instancetype)init {
+  return [self initWithRawData:NO];
+}
+
+- (instancetype)initWithRawData:(BOOL)isRawData {
+  self = [super init];
+  if (self) {
+    bzero(&strm_, sizeof(z_stream));
+    input_ = [[GTMZlibInputQueue alloc] init];
+
+    int windowBits = 15; // 15 to enable any window size
+    if (isRawData) {
+      windowBits *= -1; // make it negative to signal no header.
+    } else {
+      windowBits += 32; // and +32 to enable zlib or gzip header detection.
+    }
+    if (inflateInit2(&strm_, windowBits) != Z_OK) {
+      // COV_NF_START - no real way to force this in a unittest (we guard all args)
+      return nil;
+      // COV_NF_END
+    }
+    initialized_ = YES;
+  }
+  return self;
+}
+
+- (void)dealloc {
+  if (initialized_) {
+    inflateEnd(&strm_);
+  }
+}
+
+- (void)pushData:(NSData *)data {
+  _GTMDevAssert(!finished_, @"pushing data into a finished inflate stream");
+  [input_ pushData:[data copy]];
+}
+
+- (void)pushBytes:(const void *)bytes length:(NSUInteger)length {
+  [self pushData:[NSData dataWithBytes:bytes length:length]];
+}
+
+- (NSInteger)pullBytes:(void *)buffer
+             maxLength:(NSUInteger)maxLength
+                 error:(NSError **)error {
+  if (failed_) {
+    if (error) {
+      *error = GTMZlibStreamClosedError();
+    }
+    return -1;
+  }
+  if (finished_ || !buffer || maxLength == 0) {
+    return 0;
+  }
+
+  unsigned char *output = buffer;
+  NSUInteger produced = 0;
+  while (produced < maxLength) {
+    [input_ refillStream:&strm_];
+    strm_.next_out = output + produced;
+    strm_.avail_out = (uInt)MIN(maxLength - produced, kMaxZlibWindow);
+    uInt windowSize = strm_.avail_out;
+    int retCode = inflate(&strm_, Z_NO_FLUSH);
+    produced += windowSize - strm_.avail_out;
+    if (retCode == Z_STREAM_END) {
+      finished_ = YES;
+      break;
+    }
+    if (retCode == Z_BUF_ERROR) {
+      // No progress possible until more input is pushed.
+      break;
+    }
+    if (retCode != Z_OK) {
+      failed_ = YES;
+      if (error) {
+        *error = GTMZlibError(retCode, strm_.msg);
+      }
+      return -1;
+    }
+  }
+
+  if (maximumInflateRatio_ > 0 &&
+      strm_.total_out > (unsigned long long)strm_.total_in * maximumInflateRatio_) {
+    failed_ = YES;
+    if (error) {
+      *error = [NSError errorWithDomain:GTMNSDataZlibErrorDomain
+                                   code:GTMNSDataZlibErrorInflateRatioExceeded
+                               userInfo:nil];
+    }
+    return -1;
+  }
+
+  return (NSInteger)produced;
+}
+
+- (NSData *)pullAvailableDataWithError:(NSError **)error {
+  return GTMZlibPullAvailableData(^NSInteger(void *buffer, NSUInteger maxLength, NSError **pullError) {
+    return [self pullBytes:buffer maxLength:maxLength error:pullError];
+  }, error);
+}
+
+- (unsigned long long)totalBytesIn {
+  return strm_.total_in;
+}
+
+- (unsigned long long)totalBytesOut {
+  return strm_.total_out;
+}
+
+@end
+
+@implementation GTMZlibDeflateStream {
+  z_stream strm_;
+  GTMZlibInputQueue *input_;
+  BOOL initialized_;
+  BOOL inputFinished_;
+  BOOL failed_;
+}
+
+@synthesize finished = finished_;
+
+- (instancetype)init {
+  return [self initWithFormat:GTMNSDataZlibFormatZlib
+             compressionLevel:Z_DEFAULT_COMPRESSION];
+}
+
+- (instancetype)initWithFormat:(GTMNSDataZlibFormat)format
+              compressionLevel:(int)level {
+  self = [super init];
+  if (self) {
+    bzero(&strm_, sizeof(z_stream));
+    input_ = [[GTMZlibInputQueue alloc] init];
+
+    int memLevel = 8; // the default
+    if (deflateInit2(&strm_, GTMZlibClampCompressionLevel(level), Z_DEFLATED,
+                     GTMZlibDeflateWindowBits(format), memLevel,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      // COV_NF_START - no real way to force this in a unittest (we guard all args)
+      return nil;
+      // COV_NF_END
+    }
+    initialized_ = YES;
+  }
+  return self;
+}
+
+- (void)dealloc {
+  if (initialized_) {
+    deflateEnd(&strm_);
+  }
+}
+
+- (void)pushData:(NSData *)data {
+  _GTMDevAssert(!inputFinished_, @"pushing data into a finished deflate stream");
+  if (inputFinished_) {
+    return;
+  }
+  [input_ pushData:[data copy]];
+}
+
+- (void)pushBytes:(const void *)bytes length:(NSUInteger)length {
+  [self pushData:[NSData dataWithBytes:bytes length:length]];
+}
+
+- (void)finishInput {
+  inputFinished_ = YES;
+}
+
+- (NSInteger)pullBytes:(void *)buffer
+             maxLength:(NSUInteger)maxLength
+                 error:(NSError **)error {
+  if (failed_) {
+    if (error) {
+      *error = GTMZlibStreamClosedError();
+    }
+    return -1;
+  }
+  if (finished_ || !buffer || maxLength == 0) {
+    return 0;
+  }
+
+  unsigned char *output = buffer;
+  NSUInteger produced = 0;
+  while (produced < maxLength) {
+    [input_ refillStream:&strm_];
+    int flush = (inputFinished_ && [input_ isLastWindowForStream:&strm_]) ? Z_FINISH : Z_NO_FLUSH;
+    strm_.next_out = output + produced;
+    strm_.avail_out = (uInt)MIN(maxLength - produced, kMaxZlibWindow);
+    uInt windowSize = strm_.avail_out;
+    int retCode = deflate(&strm_, flush);
+    produced += windowSize - strm_.avail_out;
+    if (retCode == Z_STREAM_END) {
+      finished_ = YES;
+      break;
+    }
+    if (retCode == Z_BUF_ERROR) {
+      // No progress possible until more input is pushed or the input is
+      // finished.
+      break;
+    }
+    if (retCode != Z_OK) {
+      // COV_NF_START - an internal zlib issue, see gtm_dataByCompressingBytes:
+      failed_ = YES;
+      if (error) {
+        *error = GTMZlibError(retCode, strm_.msg);
+      }
+      return -1;
+      // COV_NF_END
+    }
+  }
+
+  return (NSInteger)produced;
+}
+
+- (NSData *)pullAvailableDataWithError:(NSError **)error {
+  return GTMZlibPullAvailableData(^NSInteger(void *buffer, NSUInteger maxLength, NSError **pullError) {
+    return [self pullBytes:buffer maxLength:maxLength error:pullError];
+  }, error);
+}
+
+- (unsigned long long)totalBytesIn {
+  return strm_.total_in;
+}
+
+- (unsigned long long)totalBytesOut {
+  return strm_.total_out;
+}
+
+@end
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  The measurements taken while running a benchmark
+ *
+ *  Heap usage is sampled from the default malloc zone right after each operation, while the object that the operation
+ *  returned is still alive. It therefore measures what an operation's result keeps allocated, not its transient garbage.
+ */
+@interface HUBBenchmarkResult : NSObject
+
+/// The name of the benchmark
+@property (nonatomic, copy, readonly) NSString *name;
+
+/// The number of times the benchmarked operation was run
+@property (nonatomic, assign, readonly) NSUInteger iterations;
+
+/// The mean wall clock time of one operation, in nanoseconds
+@property (nonatomic, assign, readonly) double nanosecondsPerOperation;
+
+/// The mean number of heap bytes held by the result of one operation
+@property (nonatomic, assign, readonly) double heapBytesPerOperation;
+
+/// The mean number of heap allocations held by the result of one operation
+@property (nonatomic, assign, readonly) double heapAllocationsPerOperation;
+
+/// The peak resident memory size of the process after running the benchmark, in bytes
+@property (nonatomic, assign, readonly) uint64_t peakResidentSize;
+
+/// A single line report of the result, prefixed with "HUBBenchmark" so that it can be picked out of a test log
+- (NSString *)reportWithParameterDescription:(NSString *)parameterDescription;
+
+@end
+
+/**
+ *  Run a benchmark and measure it
+ *
+ *  @param name The name of the benchmark
+ *  @param iterations The number of times to run the operation. One extra, unmeasured, run is made to warm up.
+ *  @param operation The operation to benchmark. The object it returns is released once it has been measured.
+ */
+extern HUBBenchmarkResult *HUBRunBenchmark(NSString *name, NSUInteger iterations, id _Nullable (^operation)(void));
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import "HUBBenchmark.h"
+
+#import <mach/mach_time.h>
+#import <malloc/malloc.h>
+#import <sys/resource.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBBenchmarkResult ()
+
+@property (nonatomic, copy, readwrite) NSString *name;
+@property (nonatomic, assign, readwrite) NSUInteger iterations;
+@property (nonatomic, assign, readwrite) double nanosecondsPerOperation;
+@property (nonatomic, assign, readwrite) double heapBytesPerOperation;
+@property (nonatomic, assign, readwrite) double heapAllocationsPerOperation;
+@property (nonatomic, assign, readwrite) uint64_t peakResidentSize;
+
+@end
+
+@implementation HUBBenchmarkResult
+
+- (NSString *)reportWithParameterDescription:(NSString *)parameterDescription
+{
+    return [NSString stringWithFormat:@"HUBBenchmark %@ %@ iterations=%@ ns/op=%.0f heapBytes/op=%.0f heapAllocations/op=%.1f peakRSS=%.1fMB",
+            self.name,
+            parameterDescription,
+            @(self.iterations),
+            self.nanosecondsPerOperation,
+            self.heapBytesPerOperation,
+            self.heapAllocationsPerOperation,
+            (double)self.peakResidentSize / (1024 * 1024)];
+}
+
+@end
+
+static double HUBBenchmarkNanosecondsFromMachTime(uint64_t machTime)
+{
+    static mach_timebase_info_data_t timebase;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebase);
+    });
+    
+    return (double)machTime * timebase.numer / timebase.denom;
+}
+
+static malloc_statistics_t HUBBenchmarkHeapStatistics(void)
+{
+    malloc_statistics_t statistics;
+    malloc_zone_statistics(NULL, &statistics);
+    return statistics;
+}
+
+HUBBenchmarkResult *HUBRunBenchmark(NSString *name, NSUInteger iterations, id _Nullable (^operation)(void))
+{
+    @autoreleasepool {
+        (void)operation();
+    }
+    
+    uint64_t totalMachTime = 0;
+    double totalHeapBytes = 0;
+    double totalHeapAllocations = 0;
+    
+    for (NSUInteger iteration = 0; iteration < iterations; iteration++) {
+        @autoreleasepool {
+            malloc_statistics_t const heapBefore = HUBBenchmarkHeapStatistics();
+            uint64_t const startTime = mach_absolute_time();
+            // Keep the result alive until the heap has been sampled
+            __attribute__((objc_precise_lifetime)) id const operationResult = operation();
+            uint64_t const endTime = mach_absolute_time();
+            malloc_statistics_t const heapAfter = HUBBenchmarkHeapStatistics();
+            (void)operationResult;
+            
+            totalMachTime += endTime - startTime;
+            totalHeapBytes += (double)heapAfter.size_in_use - (double)heapBefore.size_in_use;
+            totalHeapAllocations += (double)heapAfter.blocks_in_use - (double)heapBefore.blocks_in_use;
+        }
+    }
+    
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    
+    HUBBenchmarkResult * const result = [HUBBenchmarkResult new];
+    result.name = name;
+    result.iterations = iterations;
+    result.nanosecondsPerOperation = HUBBenchmarkNanosecondsFromMachTime(totalMachTime) / MAX(iterations, (NSUInteger)1);
+    result.heapBytesPerOperation = totalHeapBytes / MAX(iterations, (NSUInteger)1);
+    result.heapAllocationsPerOperation = totalHeapAllocations / MAX(iterations, (NSUInteger)1);
+    // ru_maxrss is in bytes on Darwin
+    result.peakResidentSize = (uint64_t)usage.ru_maxrss;
+    return result;
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Generates synthetic JSON feeds for the model pipeline benchmarks
+ *
+ *  A feed consists of a number of body components, each with a chain of nested children `nestingDepth` levels deep.
+ *  Successive generations of the feed are derived from each other by churning a fraction of its components, so that
+ *  diffing them exercises insertions, deletions and reloads. Generation is deterministic for a given seed.
+ */
+@interface HUBBenchmarkFeed : NSObject
+
+/// The number of body components in the first generation of the feed
+@property (nonatomic, assign, readonly) NSUInteger componentCount;
+
+/// The number of levels of children that each body component has
+@property (nonatomic, assign, readonly) NSUInteger nestingDepth;
+
+/// The fraction (0-1) of components that are removed, updated or followed by an insertion in each new generation
+@property (nonatomic, assign, readonly) double churnRate;
+
+/**
+ *  Initialize an instance of this class
+ *
+ *  @param componentCount The number of body components in the first generation of the feed
+ *  @param nestingDepth The number of levels of children that each body component has
+ *  @param churnRate The fraction (0-1) of components that change between generations
+ *  @param seed The seed to use for the feed's pseudo random number generator
+ */
+- (instancetype)initWithComponentCount:(NSUInteger)componentCount
+                          nestingDepth:(NSUInteger)nestingDepth
+                             churnRate:(double)churnRate
+                                  seed:(uint32_t)seed NS_DESIGNATED_INITIALIZER;
+
+/// Return the JSON dictionary of the current generation of the feed
+- (NSDictionary<NSString *, id> *)JSONDictionary;
+
+/// Advance the feed to its next generation, churning `churnRate` of its components
+- (void)advanceGeneration;
+
+/// A description of the feed's parameters, for use in benchmark reports
+- (NSString *)parameterDescription;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
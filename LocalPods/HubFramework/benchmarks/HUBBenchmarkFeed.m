@@ -0,0 +1,154 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import "HUBBenchmarkFeed.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBBenchmarkFeed ()
+
+@property (nonatomic, strong, readonly) NSMutableArray<NSNumber *> *componentNumbers;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, NSNumber *> *revisionsByComponentNumber;
+@property (nonatomic, assign) NSUInteger nextComponentNumber;
+@property (nonatomic, assign) uint32_t randomState;
+
+@end
+
+@implementation HUBBenchmarkFeed
+
+- (instancetype)initWithComponentCount:(NSUInteger)componentCount
+                          nestingDepth:(NSUInteger)nestingDepth
+                             churnRate:(double)churnRate
+                                  seed:(uint32_t)seed
+{
+    self = [super init];
+    
+    if (self) {
+        _componentCount = componentCount;
+        _nestingDepth = nestingDepth;
+        _churnRate = churnRate;
+        _randomState = seed;
+        _componentNumbers = [NSMutableArray arrayWithCapacity:componentCount];
+        _revisionsByComponentNumber = [NSMutableDictionary new];
+        
+        for (NSUInteger index = 0; index < componentCount; index++) {
+            [_componentNumbers addObject:@(_nextComponentNumber++)];
+        }
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (NSDictionary<NSString *, id> *)JSONDictionary
+{
+    NSMutableArray<NSDictionary<NSString *, id> *> * const body = [NSMutableArray arrayWithCapacity:self.componentNumbers.count];
+    
+    for (NSNumber * const componentNumber in self.componentNumbers) {
+        NSUInteger const revision = self.revisionsByComponentNumber[componentNumber].unsignedIntegerValue;
+        [body addObject:[self componentDictionaryWithNumber:componentNumber.unsignedIntegerValue revision:revision depth:0]];
+    }
+    
+    return @{
+        @"id": @"benchmark",
+        @"body": body
+    };
+}
+
+- (void)advanceGeneration
+{
+    NSMutableArray<NSNumber *> * const componentNumbers = [NSMutableArray arrayWithCapacity:self.componentNumbers.count];
+    
+    for (NSNumber * const componentNumber in self.componentNumbers) {
+        double const roll = [self nextRandomValue];
+        
+        // Split the churn evenly between removals, updates and insertions
+        if (roll < self.churnRate / 3) {
+            continue;
+        }
+        
+        [componentNumbers addObject:componentNumber];
+        
+        if (roll < self.churnRate * 2 / 3) {
+            self.revisionsByComponentNumber[componentNumber] = @(self.revisionsByComponentNumber[componentNumber].unsignedIntegerValue + 1);
+        } else if (roll < self.churnRate) {
+            [componentNumbers addObject:@(self.nextComponentNumber++)];
+        }
+    }
+    
+    [self.componentNumbers setArray:componentNumbers];
+}
+
+- (NSString *)parameterDescription
+{
+    return [NSString stringWithFormat:@"components=%@ depth=%@ churn=%.2f",
+            @(self.componentCount), @(self.nestingDepth), self.churnRate];
+}
+
+#pragma mark - Private utilities
+
+- (NSDictionary<NSString *, id> *)componentDictionaryWithNumber:(NSUInteger)number
+                                                       revision:(NSUInteger)revision
+                                                          depth:(NSUInteger)depth
+{
+    NSString * const identifier = [NSString stringWithFormat:@"component-%@-%@", @(number), @(depth)];
+    
+    NSMutableDictionary<NSString *, id> * const dictionary = [@{
+        @"id": identifier,
+        @"component": @{
+            @"id": (depth == 0) ? @"benchmark:row" : @"benchmark:child",
+            @"category": @"row"
+        },
+        @"text": @{
+            @"title": [NSString stringWithFormat:@"Title %@ (revision %@)", @(number), @(revision)],
+            @"subtitle": [NSString stringWithFormat:@"Subtitle %@", @(number)]
+        },
+        @"images": @{
+            @"main": @{
+                @"uri": [NSString stringWithFormat:@"https://images.example.com/%@.jpg", @(number)],
+                @"placeholder": @"album"
+            }
+        },
+        @"target": @{
+            @"uri": [NSString stringWithFormat:@"benchmark:item:%@", @(number)]
+        },
+        @"metadata": @{
+            @"index": @(number)
+        }
+    } mutableCopy];
+    
+    if (depth < self.nestingDepth) {
+        dictionary[@"children"] = @[[self componentDictionaryWithNumber:number revision:revision depth:depth + 1]];
+    }
+    
+    return dictionary;
+}
+
+/// Return a pseudo random value in [0, 1), using a linear congruential generator so that feeds are reproducible
+- (double)nextRandomValue
+{
+    self.randomState = self.randomState * 1664525u + 1013904223u;
+    return (double)self.randomState / ((double)UINT32_MAX + 1);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
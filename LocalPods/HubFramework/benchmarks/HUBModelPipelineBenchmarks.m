@@ -0,0 +1,426 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBBenchmark.h"
+#import "HUBBenchmarkFeed.h"
+#import "HUBBlockContentOperation.h"
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModel.h"
+#import "HUBComponentModelBuilder.h"
+#import "HUBComponentModelBuilderImplementation.h"
+#import "HUBConnectivityStateResolver.h"
+#import "HUBContentOperationContext.h"
+#import "HUBContentOperationRecording.h"
+#import "HUBContentOperationReplayer.h"
+#import "HUBFeatureInfoImplementation.h"
+#import "HUBJSONSchemaImplementation.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBTestDataCompression.h"
+#import "HUBViewModel.h"
+#import "HUBViewModelBuilderImplementation.h"
+#import "HUBViewModelDiff.h"
+#import "HUBViewModelLoaderImplementation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// LCS diffing allocates a (from x to) matrix, so it's only benchmarked up to this many components
+static NSUInteger const HUBBenchmarkMaximumLCSComponentCount = 2000;
+
+/// Roughly the number of component models that each benchmark builds or compares per parameter set
+static NSUInteger const HUBBenchmarkComponentModelsPerRun = 100000;
+
+/// The number of builders that preferred index resolution is benchmarked with
+static NSUInteger const HUBBenchmarkPreferredIndexComponentCount = 10000;
+
+/// The share of those builders that have a preferred index
+static double const HUBBenchmarkPreferredIndexPinnedRate = 0.2;
+
+#pragma mark - Test doubles
+
+@interface HUBBenchmarkConnectivityStateResolver : NSObject <HUBConnectivityStateResolver>
+
+@end
+
+@implementation HUBBenchmarkConnectivityStateResolver
+
+- (HUBConnectivityState)resolveConnectivityState
+{
+    return HUBConnectivityStateOnline;
+}
+
+- (void)addObserver:(id<HUBConnectivityStateResolverObserver>)observer
+{
+    // Connectivity never changes
+}
+
+- (void)removeObserver:(id<HUBConnectivityStateResolverObserver>)observer
+{
+    // Connectivity never changes
+}
+
+@end
+
+@interface HUBBenchmarkViewModelLoaderDelegate : NSObject <HUBViewModelLoaderDelegate>
+
+@property (nonatomic, strong, nullable) id<HUBViewModel> viewModel;
+@property (nonatomic, strong, nullable) NSError *error;
+
+@end
+
+@implementation HUBBenchmarkViewModelLoaderDelegate
+
+- (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didLoadViewModel:(id<HUBViewModel>)viewModel
+{
+    self.viewModel = viewModel;
+}
+
+- (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didFailLoadingWithError:(NSError *)error
+{
+    self.error = error;
+}
+
+@end
+
+#pragma mark - Benchmarks
+
+/**
+ *  Benchmarks for the model pipeline: JSON parsing, view model building, diffing, equality and loading
+ *
+ *  Every benchmark runs over all combinations of the component counts, nesting depths and churn rates given by the
+ *  `HUB_BENCHMARK_COMPONENT_COUNTS`, `HUB_BENCHMARK_NESTING_DEPTHS` and `HUB_BENCHMARK_CHURN_RATES` environment
+ *  variables (comma separated), and prints a line prefixed with "HUBBenchmark" per combination.
+ *
+ *  A session recorded using `HUBManager.contentOperationRecorder` can be replayed by passing the path of the recording
+ *  file as the `HUB_BENCHMARK_REPLAY_RECORDING` environment variable, which prints the profile of every replayed load.
+ */
+@interface HUBModelPipelineBenchmarks : XCTestCase
+
+@property (nonatomic, strong) HUBComponentDefaults *componentDefaults;
+@property (nonatomic, strong) id<HUBJSONSchema> JSONSchema;
+
+@end
+
+@implementation HUBModelPipelineBenchmarks
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    self.componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"benchmark"
+                                                                         componentName:@"row"
+                                                                     componentCategory:HUBComponentCategoryRow];
+    
+    self.JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:self.componentDefaults
+                                                                    iconImageResolver:nil];
+}
+
+#pragma mark - Benchmarks
+
+- (void)testParseAndBuild
+{
+    [self enumerateFeedsWithBlock:^(HUBBenchmarkFeed *feed, NSUInteger iterations) {
+        NSDictionary<NSString *, id> * const dictionary = [feed JSONDictionary];
+        
+        HUBBenchmarkResult * const result = HUBRunBenchmark(@"parseAndBuild", iterations, ^id {
+            HUBViewModelBuilderImplementation * const builder = [self createBuilder];
+            [builder addJSONDictionary:dictionary];
+            return [builder build];
+        });
+        
+        [self reportResult:result feed:feed];
+    }];
+}
+
+- (void)testCompressedJSONDataParseAndBuild
+{
+    [self enumerateFeedsWithBlock:^(HUBBenchmarkFeed *feed, NSUInteger iterations) {
+        NSData * const JSONData = [NSJSONSerialization dataWithJSONObject:[feed JSONDictionary] options:(NSJSONWritingOptions)0 error:nil];
+        NSData * const compressedData = HUBCompressDataIfNeeded(JSONData);
+        
+        HUBBenchmarkResult * const result = HUBRunBenchmark(@"compressedJSONDataParseAndBuild", iterations, ^id {
+            HUBViewModelBuilderImplementation * const builder = [self createBuilder];
+            NSError *error = nil;
+            [builder addJSONData:compressedData error:&error];
+            XCTAssertNil(error);
+            return [builder build];
+        });
+        
+        [self reportResult:result feed:feed];
+    }];
+}
+
+- (void)testMyersDiff
+{
+    [self benchmarkDiffAlgorithm:HUBDiffMyersAlgorithm named:@"myersDiff" maximumComponentCount:NSUIntegerMax];
+}
+
+- (void)testLCSDiff
+{
+    [self benchmarkDiffAlgorithm:HUBDiffLCSAlgorithm named:@"LCSDiff" maximumComponentCount:HUBBenchmarkMaximumLCSComponentCount];
+}
+
+- (void)testComponentModelEquality
+{
+    [self enumerateFeedsWithBlock:^(HUBBenchmarkFeed *feed, NSUInteger iterations) {
+        NSDictionary<NSString *, id> * const dictionary = [feed JSONDictionary];
+        NSArray<id<HUBComponentModel>> * const models = [self buildViewModelFromDictionary:dictionary].bodyComponentModels;
+        NSArray<id<HUBComponentModel>> * const equalModels = [self buildViewModelFromDictionary:dictionary].bodyComponentModels;
+        
+        HUBBenchmarkResult * const result = HUBRunBenchmark(@"componentModelEquality", iterations, ^id {
+            NSUInteger equalCount = 0;
+            
+            for (NSUInteger index = 0; index < models.count; index++) {
+                if ([models[index] isEqual:equalModels[index]]) {
+                    equalCount++;
+                }
+            }
+            
+            XCTAssertEqual(equalCount, models.count);
+            return nil;
+        });
+        
+        [self reportResult:result feed:feed];
+    }];
+}
+
+- (void)testViewModelLoaderWithSyntheticContentOperations
+{
+    [self enumerateFeedsWithBlock:^(HUBBenchmarkFeed *feed, NSUInteger iterations) {
+        NSDictionary<NSString *, id> * const dictionary = [feed JSONDictionary];
+        NSUInteger const componentCount = [dictionary[@"body"] count];
+        NSUInteger const updatedComponentCount = (NSUInteger)(componentCount * feed.churnRate);
+        
+        // One operation adds the feed, the next one updates some of its components, like a local override would
+        NSArray<id<HUBContentOperation>> * const contentOperations = @[
+            [[HUBBlockContentOperation alloc] initWithBlock:^(id<HUBContentOperationContext> context) {
+                [context.viewModelBuilder addJSONDictionary:dictionary];
+            }],
+            [[HUBBlockContentOperation alloc] initWithBlock:^(id<HUBContentOperationContext> context) {
+                NSArray<id<HUBComponentModelBuilder>> * const builders = [context.viewModelBuilder allBodyComponentModelBuilders];
+                
+                for (NSUInteger index = 0; index < updatedComponentCount; index++) {
+                    builders[index * builders.count / MAX(updatedComponentCount, (NSUInteger)1)].subtitle = @"Updated";
+                }
+            }]
+        ];
+        
+        HUBBenchmarkResult * const result = HUBRunBenchmark(@"viewModelLoader", iterations, ^id {
+            return [self loadViewModelUsingContentOperations:contentOperations];
+        });
+        
+        [self reportResult:result feed:feed];
+    }];
+}
+
+- (void)testPreferredIndexResolution
+{
+    NSUInteger const componentCount = HUBBenchmarkPreferredIndexComponentCount;
+    NSUInteger const pinnedCount = (NSUInteger)(componentCount * HUBBenchmarkPreferredIndexPinnedRate);
+    NSMutableDictionary<NSString *, HUBComponentModelBuilderImplementation *> * const builders = [NSMutableDictionary new];
+    NSMutableArray<NSString *> * const identifierOrder = [NSMutableArray new];
+    uint32_t randomState = 42;
+    
+    for (NSUInteger index = 0; index < componentCount; index++) {
+        NSString * const identifier = [NSString stringWithFormat:@"component-%lu", (unsigned long)index];
+        builders[identifier] = [[HUBComponentModelBuilderImplementation alloc] initWithModelIdentifier:identifier
+                                                                                                  type:HUBComponentTypeBody
+                                                                                            JSONSchema:self.JSONSchema
+                                                                                     componentDefaults:self.componentDefaults
+                                                                                     iconImageResolver:nil
+                                                                                  mainImageDataBuilder:nil
+                                                                            backgroundImageDataBuilder:nil];
+        [identifierOrder addObject:identifier];
+    }
+    
+    // Pinned builders are spread evenly, and some of their indexes are out of bounds or shared with another builder
+    for (NSUInteger pinnedIndex = 0; pinnedIndex < pinnedCount; pinnedIndex++) {
+        randomState = randomState * 1664525u + 1013904223u;
+        NSUInteger const preferredIndex = randomState % (componentCount + componentCount / 10);
+        builders[identifierOrder[pinnedIndex * componentCount / pinnedCount]].preferredIndex = @(preferredIndex);
+    }
+    
+    HUBBenchmarkResult * const result = HUBRunBenchmark(@"preferredIndexResolution", 20, ^id {
+        return [HUBComponentModelBuilderImplementation sortedBuildersFromBuilders:builders identifierOrder:identifierOrder];
+    });
+    
+    NSString * const parameterDescription = [NSString stringWithFormat:@"components=%@ pinned=%.2f",
+                                             @(componentCount), HUBBenchmarkPreferredIndexPinnedRate];
+    
+    printf("%s\n", [result reportWithParameterDescription:parameterDescription].UTF8String);
+}
+
+- (void)testReplayRecordedSession
+{
+    NSString * const path = [NSProcessInfo processInfo].environment[@"HUB_BENCHMARK_REPLAY_RECORDING"];
+    
+    if (path.length == 0) {
+        return;
+    }
+    
+    NSData * const data = [NSData dataWithContentsOfFile:path];
+    XCTAssertNotNil(data, @"Could not read recording: %@", path);
+    
+    if (data == nil) {
+        return;
+    }
+    
+    NSError *error = nil;
+    NSArray<HUBContentOperationRecording *> * const recordings = [HUBContentOperationRecording recordingsFromJSONData:data error:&error];
+    XCTAssertNil(error);
+    
+    for (HUBContentOperationRecording * const recording in recordings) {
+        HUBContentOperationReplayer * const replayer = [[HUBContentOperationReplayer alloc] initWithRecording:recording
+                                                                                            componentDefaults:self.componentDefaults];
+        
+        for (NSDictionary<NSString *, id> * const profile in [replayer replay]) {
+            NSData * const profileData = [NSJSONSerialization dataWithJSONObject:profile options:(NSJSONWritingOptions)0 error:nil];
+            NSString * const profileString = [[NSString alloc] initWithData:profileData encoding:NSUTF8StringEncoding];
+            printf("HUBBenchmark replay %s %s\n", recording.viewURI.absoluteString.UTF8String, profileString.UTF8String);
+        }
+        
+        XCTAssertEqual(replayer.unmatchedContentOperationCount, (NSUInteger)0, @"Replay diverged for view: %@", recording.viewURI);
+    }
+}
+
+#pragma mark - Utilities
+
+- (void)benchmarkDiffAlgorithm:(HUBDiffAlgorithm)algorithm
+                         named:(NSString *)name
+         maximumComponentCount:(NSUInteger)maximumComponentCount
+{
+    [self enumerateFeedsWithBlock:^(HUBBenchmarkFeed *feed, NSUInteger iterations) {
+        if (feed.componentCount > maximumComponentCount) {
+            return;
+        }
+        
+        id<HUBViewModel> const fromViewModel = [self buildViewModelFromDictionary:[feed JSONDictionary]];
+        [feed advanceGeneration];
+        id<HUBViewModel> const toViewModel = [self buildViewModelFromDictionary:[feed JSONDictionary]];
+        
+        HUBBenchmarkResult * const result = HUBRunBenchmark(name, iterations, ^id {
+            return [HUBViewModelDiff diffFromViewModel:fromViewModel toViewModel:toViewModel algorithm:algorithm];
+        });
+        
+        [self reportResult:result feed:feed];
+    }];
+}
+
+- (void)enumerateFeedsWithBlock:(void(^)(HUBBenchmarkFeed *, NSUInteger))block
+{
+    NSArray<NSNumber *> * const componentCounts = [self parametersForEnvironmentVariable:@"HUB_BENCHMARK_COMPONENT_COUNTS"
+                                                                           defaultValue:@"100,1000,5000,20000"];
+    NSArray<NSNumber *> * const nestingDepths = [self parametersForEnvironmentVariable:@"HUB_BENCHMARK_NESTING_DEPTHS"
+                                                                         defaultValue:@"0,3"];
+    NSArray<NSNumber *> * const churnRates = [self parametersForEnvironmentVariable:@"HUB_BENCHMARK_CHURN_RATES"
+                                                                      defaultValue:@"0.01,0.1"];
+    
+    for (NSNumber * const componentCount in componentCounts) {
+        for (NSNumber * const nestingDepth in nestingDepths) {
+            for (NSNumber * const churnRate in churnRates) {
+                HUBBenchmarkFeed * const feed = [[HUBBenchmarkFeed alloc] initWithComponentCount:componentCount.unsignedIntegerValue
+                                                                                    nestingDepth:nestingDepth.unsignedIntegerValue
+                                                                                       churnRate:churnRate.doubleValue
+                                                                                            seed:42];
+                
+                NSUInteger const modelsPerOperation = feed.componentCount * (feed.nestingDepth + 1);
+                NSUInteger const iterations = MAX((NSUInteger)3, HUBBenchmarkComponentModelsPerRun / MAX(modelsPerOperation, (NSUInteger)1));
+                
+                @autoreleasepool {
+                    block(feed, iterations);
+                }
+            }
+        }
+    }
+}
+
+- (NSArray<NSNumber *> *)parametersForEnvironmentVariable:(NSString *)name defaultValue:(NSString *)defaultValue
+{
+    NSString * const value = [NSProcessInfo processInfo].environment[name] ?: defaultValue;
+    NSMutableArray<NSNumber *> * const parameters = [NSMutableArray new];
+    
+    for (NSString * const component in [value componentsSeparatedByString:@","]) {
+        NSString * const trimmedComponent = [component stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+        
+        if (trimmedComponent.length > 0) {
+            [parameters addObject:@(trimmedComponent.doubleValue)];
+        }
+    }
+    
+    return parameters;
+}
+
+- (HUBViewModelBuilderImplementation *)createBuilder
+{
+    return [[HUBViewModelBuilderImplementation alloc] initWithJSONSchema:self.JSONSchema
+                                                       componentDefaults:self.componentDefaults
+                                                       iconImageResolver:nil];
+}
+
+- (id<HUBViewModel>)buildViewModelFromDictionary:(NSDictionary<NSString *, id> *)dictionary
+{
+    HUBViewModelBuilderImplementation * const builder = [self createBuilder];
+    [builder addJSONDictionary:dictionary];
+    return [builder build];
+}
+
+- (nullable id<HUBViewModel>)loadViewModelUsingContentOperations:(NSArray<id<HUBContentOperation>> *)contentOperations
+{
+    NSURL * const viewURI = [NSURL URLWithString:@"benchmark:view"];
+    HUBPerformanceTracker * const performanceTracker = [[HUBPerformanceTracker new] trackerForViewURI:viewURI
+                                                                                   featureIdentifier:@"benchmark"];
+    
+    HUBViewModelLoaderImplementation * const loader = [[HUBViewModelLoaderImplementation alloc] initWithViewURI:viewURI
+                                                                                                      featureInfo:[[HUBFeatureInfoImplementation alloc] initWithIdentifier:@"benchmark" title:@"Benchmark"]
+                                                                                                contentOperations:contentOperations
+                                                                                              contentReloadPolicy:nil
+                                                                                                       JSONSchema:self.JSONSchema
+                                                                                                componentDefaults:self.componentDefaults
+                                                                                        connectivityStateResolver:[HUBBenchmarkConnectivityStateResolver new]
+                                                                                                iconImageResolver:nil
+                                                                                                 initialViewModel:nil
+                                                                                               performanceTracker:performanceTracker
+                                                                                         contentOperationRecorder:nil];
+    
+    HUBBenchmarkViewModelLoaderDelegate * const delegate = [HUBBenchmarkViewModelLoaderDelegate new];
+    loader.delegate = delegate;
+    [loader loadViewModel];
+    
+    // Content operations may be scheduled on the main queue, so let it run until loading has finished
+    while (delegate.viewModel == nil && delegate.error == nil) {
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate distantFuture]];
+    }
+    
+    XCTAssertNil(delegate.error);
+    return delegate.viewModel;
+}
+
+- (void)reportResult:(HUBBenchmarkResult *)result feed:(HUBBenchmarkFeed *)feed
+{
+    printf("%s\n", [result reportWithParameterDescription:[feed parameterDescription]].UTF8String);
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -42,9 +42,24 @@ NS_ASSUME_NONNULL_BEGIN
  *
  *  The Hub Framework will call this method on your component every time that an action was performed
  *  in the view that it is being used in, including both default selection actions & custom ones.
+ *  To only observe some custom actions, implement `observedActionNamespaces`.
  */
 - (void)actionPerformedWithContext:(id<HUBActionContext>)context;
 
+@optional
+
+/**
+ *  The namespaces of the custom actions that the component is interested in
+ *
+ *  Implement this method to only get `actionPerformedWithContext:` called for default selection actions,
+ *  and custom actions that have an identifier within one of the returned namespaces. This avoids
+ *  notifying your component of frequently performed actions that it doesn't care about. The returned
+ *  namespaces are read once the component is displayed, and should not change after that.
+ *
+ *  If this method is not implemented, your component will observe all actions.
+ */
+- (NSSet<NSString *> *)observedActionNamespaces;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Protocol defining the public API of the cache that keeps saved component UI states
+ *
+ *  The UI states of components conforming to `HUBComponentWithRestorableUIState` are saved whenever the components are
+ *  reused, so that they can be restored once the same model is rendered again. Each view controller keeps its own saved
+ *  states in a least-recently-used order, and evicts the least recently used ones once either `countLimit` or
+ *  `totalCostLimit` is exceeded. Evicted states that conform to `NSCoding` may optionally be spilled into a compact
+ *  archived form, from which they can still be restored.
+ *
+ *  The limits apply to each view controller created by the `HUBManager` that the cache belongs to, and are enforced the
+ *  next time a view controller saves a state. The counters are aggregated across all of those view controllers.
+ *
+ *  You don't implement this protocol yourself, instead you access the cache through `HUBManager`. It should only be
+ *  accessed from the main thread.
+ */
+@protocol HUBComponentUIStateCache <NSObject>
+
+/// The maximum number of states that each view controller keeps in memory. 0 means no limit. Defaults to 500.
+@property (nonatomic, assign) NSUInteger countLimit;
+
+/**
+ *  The maximum total cost of the states that each view controller keeps in memory. 0 means no limit. Defaults to 0.
+ *
+ *  The cost of a state is determined by the component that it was saved for. See `HUBComponentWithRestorableUIState`.
+ */
+@property (nonatomic, assign) NSUInteger totalCostLimit;
+
+/// Whether evicted states that conform to `NSCoding` should be archived instead of discarded. Defaults to `NO`.
+@property (nonatomic, assign) BOOL spillsEvictedStates;
+
+/// The maximum number of bytes that each view controller's archived (spilled) states may occupy. 0 means no limit.
+@property (nonatomic, assign) NSUInteger spilledStatesByteLimit;
+
+/// The number of states that have been evicted because either `countLimit` or `totalCostLimit` was exceeded
+@property (nonatomic, assign, readonly) NSUInteger evictionCount;
+
+/// The number of evicted states that were spilled into an archived form, rather than discarded
+@property (nonatomic, assign, readonly) NSUInteger spillCount;
+
+/// The number of states (including spilled ones) that have been discarded because the system was low on memory
+@property (nonatomic, assign, readonly) NSUInteger purgeCount;
+
+/// Reset all counters to 0
+- (void)resetCounters;
+
+@end
+
+NS_ASSUME_NONNULL_END
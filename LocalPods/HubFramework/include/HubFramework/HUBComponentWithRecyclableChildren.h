@@ -0,0 +1,45 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBComponentWithChildren.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Extended Hub component protocol that lets the Hub Framework recycle child components that are no longer displayed
+ *
+ *  By default, child components created through `childDelegate` are kept alive until their parent is reused, since a
+ *  parent might hold on to a child's view while it's off screen. For components that display many children, such as
+ *  long horizontal carousels, this means keeping a child component & view alive for every child that was ever shown.
+ *
+ *  Conform to this protocol if your component stops using a child component once it has called
+ *  `component:didStopDisplayingChildAtIndex:view:` for it, and always asks `childDelegate` for a child component
+ *  again before displaying that child once more. The Hub Framework will then save the UI state of each child that is
+ *  no longer displayed, and send it back to the reuse pool, so that it can be reused for other children. Any saved UI
+ *  state is restored once a component is requested for that child again.
+ *
+ *  This protocol doesn't have any methods of its own. See `HUBComponentWithChildren` for more information.
+ */
+@protocol HUBComponentWithRecyclableChildren <HUBComponentWithChildren>
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -36,7 +36,8 @@ NS_ASSUME_NONNULL_BEGIN
  *  for different component implementations
  *
  *  UI state is never shared across different views, and it's not persisted across multiple
- *  launches of the application.
+ *  launches of the application. The number of states kept in memory is limited, see
+ *  `HUBComponentUIStateCache`.
  *
  *  For more information, see `HUBComponent`.
  */
@@ -68,6 +69,19 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)restoreUIState:(id)state NS_SWIFT_NAME(restoreUIState(_:));
 
+@optional
+
+/**
+ *  Return the cost of keeping a UI state in memory
+ *
+ *  @param state The state that is about to be saved. This object is the one that was returned from `currentUIState`.
+ *
+ *  The cost counts towards the `totalCostLimit` of the UI state cache of `HUBManager`, so the unit should be the same for
+ *  all of your components - for example the approximate number of bytes that the state occupies. If this method isn't
+ *  implemented, states have a cost of 0. See `HUBComponentUIStateCache` for more information.
+ */
+- (NSUInteger)costForUIState:(id)state NS_SWIFT_NAME(cost(forUIState:));
+
 @end
 
 NS_ASSUME_NONNULL_END
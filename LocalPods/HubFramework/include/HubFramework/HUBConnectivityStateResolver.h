@@ -35,7 +35,9 @@ NS_ASSUME_NONNULL_BEGIN
  *
  *  A connectivity state resolver should send this to all of its observers once it detected
  *  a change in connectivity state. The Hub Framework will react to this, and reschedule a
- *  reload of any visible view's content.
+ *  reload of any visible view's content once the connectivity state has stopped changing. Only
+ *  content operations that don't conform to `HUBContentOperationWithConnectivityIndependentContent`
+ *  (and the ones following them) will be re-executed.
  */
 - (void)connectivityStateResolverStateDidChange:(id<HUBConnectivityStateResolver>)resolver;
 
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Protocol defining the public API of the Hub Framework content operation recorder
+ *
+ *  The recorder captures what the content loading chains of all views do during a real session, so that the session can
+ *  later be replayed deterministically, without any network or other content sources, to profile the framework's side
+ *  of content loading. For each view, the following is recorded:
+ *
+ *  - Every time content was loaded, either initially, for the next page, because a content operation requested to be
+ *    rescheduled, or because the connectivity state changed.
+ *  - Every content operation that was performed, with its start time, duration and any error that it ended with, as
+ *    well as the content of its view model builder once it had finished - which captures the mutations it made.
+ *
+ *  You don't implement this protocol yourself, instead you access the recorder through `HUBManager`. Note though that
+ *  it is only available when the application hosting the framework is compiled for DEBUG. All methods should be called
+ *  on the main queue.
+ */
+@protocol HUBContentOperationRecorder <NSObject>
+
+/// Whether the recorder is currently recording
+@property (nonatomic, readonly, getter=isRecording) BOOL recording;
+
+/// The number of events that have been recorded since recording was started
+@property (nonatomic, readonly) NSUInteger recordedEventCount;
+
+/**
+ *  Start recording, discarding anything that was previously recorded
+ *
+ *  Views that were created before recording started are recorded from the next time they load content.
+ */
+- (void)startRecording;
+
+/**
+ *  Stop recording and write what was recorded to a file
+ *
+ *  @param fileURL The URL of the file to write the recording to. Any existing file is replaced.
+ *  @param error Any error that occurred while writing the file
+ *
+ *  @return `YES` if the recording was written, otherwise `NO`. Recording is stopped either way.
+ *
+ *  The recording is written as JSON, containing one entry per recorded view. See `HUBContentOperationReplayer` in the
+ *  framework's sources for how to replay it.
+ */
+- (BOOL)stopRecordingAndWriteToURL:(NSURL *)fileURL error:(NSError * _Nullable __autoreleasing *)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,41 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBContentOperation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Extended Hub content operation protocol used to define operations whose content doesn't depend on connectivity
+ *
+ *  Conform to this protocol instead of `HUBContentOperation` if your content operation adds the same content
+ *  regardless of the current `HUBConnectivityState` - for example if it only adds local or static content. Whenever
+ *  the connectivity state of the app changes, the Hub Framework will then keep the content that was previously
+ *  added by your operation, and only re-execute the operations that are connectivity dependent.
+ *
+ *  Since content operations are executed as a chain, any connectivity independent operations that come after a
+ *  connectivity dependent one will still be re-executed, using the new output of the operations before them.
+ */
+@protocol HUBContentOperationWithConnectivityIndependentContent <HUBContentOperation>
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Protocol defining the public API of the Hub Framework frame profiler
+ *
+ *  The frame profiler attributes the main thread time that view controllers spend on components to each display frame,
+ *  and aggregates it per feature and component identifier. The following work is measured for each component:
+ *
+ *  - `configure`: Configuring the component for a model.
+ *  - `loadView`: Loading the component's view and adding it to a cell or parent component.
+ *  - `imageApply`: Updating the component's view for a loaded image.
+ *  - `contentOffsetObservation`: Updating the component's view for a changed content offset while scrolling.
+ *
+ *  A frame is considered over budget when more than `frameBudget` plus half a display refresh interval passed since the
+ *  previous frame (with the default budget, 1.5 refresh intervals), meaning that at least one vsync was missed. The extra
+ *  half interval keeps normal jitter in display refresh timestamps from being counted. All work measured since the
+ *  previous frame is then attributed to the frame that was over budget.
+ *
+ *  You don't implement this protocol yourself, instead you access the profiler through `HUBManager`. Note though that
+ *  it is only available when the application hosting the framework is compiled for DEBUG.
+ */
+@protocol HUBFrameProfiler <NSObject>
+
+/// Whether the profiler is currently measuring frames. Defaults to `NO`.
+@property (nonatomic, assign, getter=isEnabled) BOOL enabled;
+
+/// The time that each frame is allowed to take, in seconds. Defaults to 1/60th of a second.
+@property (nonatomic, assign) NSTimeInterval frameBudget;
+
+/// The number of frames that have been measured since the profiler was enabled or last reset
+@property (nonatomic, readonly) NSUInteger frameCount;
+
+/// The number of measured frames that were over budget
+@property (nonatomic, readonly) NSUInteger overBudgetFrameCount;
+
+/**
+ *  Export a summary of the components that caused the most dropped frames, per feature
+ *
+ *  @param limit The maximum number of components to include for each feature
+ *
+ *  @return A JSON compatible dictionary keyed by feature identifier. Each value is an array of dictionaries, sorted by
+ *  the time a component spent in over budget frames, then by its total time. Each dictionary contains the component
+ *  identifier (`component`), the number of measurements (`sampleCount`), the total time (`totalDuration`), the largest
+ *  amount of time spent in a single frame (`maxFrameDuration`), the number of over budget frames the component did
+ *  work in (`overBudgetFrameCount`) and the time it spent in them (`overBudgetDuration`), as well as the total time
+ *  per kind of work (`durationsByCategory`). All durations are in seconds.
+ */
+- (NSDictionary<NSString *, NSArray<NSDictionary<NSString *, id> *> *> *)worstOffendersByFeatureWithLimit:(NSUInteger)limit;
+
+/// Discard all measurements made so far
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
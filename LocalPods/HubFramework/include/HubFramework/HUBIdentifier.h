@@ -33,6 +33,10 @@ NS_ASSUME_NONNULL_BEGIN
  *
  *  You can create component identifiers programmatically, or supply string representations when
  *  using JSON data using the `namespace:name` format.
+ *
+ *  Identifiers are interned, meaning that initializing an identifier with the same namespace & name as
+ *  an identifier that is still alive returns that existing instance. Equality checks between interned
+ *  identifiers are therefore pointer comparisons, and their hash values are precomputed.
  */
 @interface HUBIdentifier : NSObject <NSCopying>
 
@@ -0,0 +1,50 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBImageLoader.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Extended image loader protocol that adds the ability to load multiple images with a single request
+ *
+ *  Conform to this protocol instead of `HUBImageLoader` if your image loader can load images more efficiently when
+ *  it knows about several of them at once - for example by sharing connections, deduplicating requests or decoding
+ *  images in parallel. The Hub Framework will then collect the images needed by all components that are rendered at
+ *  the same time - including main, background, custom and child component images - and pass them to your image
+ *  loader as one batch, instead of calling `loadImageForURL:targetSize:` once per image.
+ *
+ *  Each loaded image should still be reported to the image loader's delegate individually, as soon as it's available.
+ */
+@protocol HUBImageLoaderWithBatchedRequests <HUBImageLoader>
+
+/**
+ *  Load a batch of images from a set of URLs
+ *
+ *  @param imageURLs The URLs of the images to load, in the order the images were requested in. Each URL is unique.
+ *  @param targetSizes The target sizes of the images, as `CGSize` values. Has the same count as `imageURLs`, and each
+ *         size applies to the URL at the same index. See `loadImageForURL:targetSize:` for more information.
+ */
+- (void)loadImagesForURLs:(NSArray<NSURL *> *)imageURLs targetSizes:(NSArray<NSValue *> *)targetSizes;
+
+@end
+
+NS_ASSUME_NONNULL_END
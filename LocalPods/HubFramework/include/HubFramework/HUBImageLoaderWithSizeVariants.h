@@ -0,0 +1,54 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBImageLoader.h"
+
+@protocol HUBComponentImageData;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Extended image loader protocol that adds the ability to load size variants of images
+ *
+ *  Conform to this protocol instead of `HUBImageLoader` if the images that your image loader loads are available in
+ *  multiple resolutions - for example from a CDN that can serve images at various sizes. Before loading an image, the
+ *  Hub Framework will then ask your image loader which URL to load, given the size the image will be displayed at,
+ *  which avoids downloading and decoding images that are much larger than needed.
+ *
+ *  Since your image loader knows which variants it has loaded, it can also choose to serve a larger variant that it has
+ *  already cached - by downscaling it - instead of loading a smaller one.
+ */
+@protocol HUBImageLoaderWithSizeVariants <HUBImageLoader>
+
+/**
+ *  Return the URL to load an image from, for a certain target size
+ *
+ *  @param imageData The data of the image to load. Its `URL` is always non-nil when this method is called.
+ *  @param targetSize The size that the image will be displayed at, as preferred by the component displaying it
+ *
+ *  The returned URL is then passed to `loadImageForURL:targetSize:`, together with the same target size. Return the
+ *  `URL` of the image data as-is in case no better matching variant is available.
+ */
+- (NSURL *)URLForImageWithData:(id<HUBComponentImageData>)imageData targetSize:(CGSize)targetSize;
+
+@end
+
+NS_ASSUME_NONNULL_END
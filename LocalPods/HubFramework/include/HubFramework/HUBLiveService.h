@@ -48,6 +48,20 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)liveService:(id<HUBLiveService>)liveService
         didCreateViewController:(HUBViewController *)viewController;
 
+@optional
+
+/**
+ *  Sent to the delegate whenever the live service received a JSON patch that it couldn't apply
+ *
+ *  @param liveService The live service in question
+ *  @param error An error describing why the patch couldn't be decompressed, parsed or applied
+ *
+ *  Since the rendered document is then out of sync with the one being edited, the service also closes
+ *  its connection, and `hublive` needs to reconnect and resend the complete document.
+ */
+- (void)liveService:(id<HUBLiveService>)liveService
+        didFailToApplyPatchWithError:(NSError *)error;
+
 @end
 
 /**
@@ -61,6 +75,12 @@ NS_ASSUME_NONNULL_BEGIN
  *  The service will then call its delegate once it has created a view controller for any JSON data that
  *  was passed from `hublive`.
  *
+ *  Data is sent as length-prefixed frames, each containing either a complete JSON document or a JSON patch
+ *  (RFC 6902) to apply to the current document, which avoids resending large views for small edits. Each
+ *  frame starts with the payload length as a big-endian 32 bit integer, followed by a one byte frame type
+ *  (`1` for a document, `2` for a patch). Unframed JSON documents, as sent by older versions of `hublive`,
+ *  are also accepted.
+ *
  *  You don't implement this protocol yourself, instead the Hub Framework contains an implementation of it.
  *  Note though that this implementation is only compiled when the application hosting the framework is
  *  compiled for DEBUG.
@@ -41,6 +41,10 @@
 @protocol HUBComponentLayoutManager;
 @protocol HUBComponentFallbackHandler;
 @protocol HUBContentOperationFactory;
+@protocol HUBPerformanceObserver;
+@protocol HUBComponentUIStateCache;
+@protocol HUBFrameProfiler;
+@protocol HUBContentOperationRecorder;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -77,6 +81,24 @@ NS_ASSUME_NONNULL_BEGIN
 /// The service that can be used to enable live editing of Hub Framework-powered view controllers. Always `nil` in release builds.
 @property (nonatomic, strong, readonly, nullable) id<HUBLiveService> liveService;
 
+/// The profiler that can be used to find components causing dropped frames. Always `nil` in release builds. See `HUBFrameProfiler` for more info.
+@property (nonatomic, strong, readonly, nullable) id<HUBFrameProfiler> frameProfiler;
+
+/// The recorder that can be used to record content loading, to replay it later. Always `nil` in release builds. See `HUBContentOperationRecorder` for more info.
+@property (nonatomic, strong, readonly, nullable) id<HUBContentOperationRecorder> contentOperationRecorder;
+
+/// The cache that keeps the UI states of components while they are being reused. See `HUBComponentUIStateCache` for more info.
+@property (nonatomic, strong, readonly) id<HUBComponentUIStateCache> componentUIStateCache;
+
+/**
+ *  Any object that observes performance measurements made by the framework
+ *
+ *  Assigning an observer enables instrumentation of content loading, view model building & diffing, layout, component
+ *  configuration and image loading for all views created by this manager. Nothing is measured while this property is
+ *  `nil`. The observer is not retained. See `HUBPerformanceObserver` for more info.
+ */
+@property (nonatomic, weak, nullable) id<HUBPerformanceObserver> performanceObserver;
+
 /**
  *  Initialize an instance of this class with all available customization options
  *
@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+/// Enum describing the events that the Hub Framework measures the performance of
+typedef NS_ENUM(NSUInteger, HUBPerformanceEvent) {
+    /// A content operation was performed by a view model loader. The label is the class name of the operation, and
+    /// the item count is the number of body components in the view model builder once the operation finished. If the
+    /// operation failed, the interval's error is set.
+    HUBPerformanceEventContentOperation,
+    /// A view model was built. The item count is the number of body components in the view model.
+    HUBPerformanceEventViewModelBuild,
+    /// A diff was computed between two view models. The item count is the number of changed body components.
+    HUBPerformanceEventViewModelDiff,
+    /// The layout of a view controller's collection view was computed. The item count is the number of body components.
+    HUBPerformanceEventLayout,
+    /// A component was configured with a model. The label is the component identifier.
+    HUBPerformanceEventComponentConfiguration,
+    /// An image was loaded for one or more components. The label is the image URL and the item count is the number of components.
+    HUBPerformanceEventImageLoad,
+    /// A view controller appeared and rendered its first loaded view model. The item count is the number of body components.
+    HUBPerformanceEventTimeToFirstRender,
+    /// A content operation requested to be rescheduled. The label is the class name of the operation. The interval lasts
+    /// until the resulting view model was loaded, and the item count is the number of body components in it.
+    HUBPerformanceEventContentOperationRescheduling,
+    /// Content was reloaded because the connectivity state changed. The label is either "online" or "offline". The interval
+    /// lasts until the resulting view model was loaded, and the item count is the number of body components in it.
+    HUBPerformanceEventConnectivityStateChange,
+    /// The images of a view controller's rendered components were loaded. The interval starts when images are requested
+    /// for rendered components, and lasts until none of the requested images are loading anymore - also covering any
+    /// images requested meanwhile. The item count is the number of images that were requested.
+    HUBPerformanceEventViewportImageLoad
+};
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Protocol defining the public API of a measured performance interval
+ *
+ *  You don't conform to this protocol yourself, instead the Hub Framework will create instances conforming to
+ *  this protocol and pass them to any `HUBPerformanceObserver` that was assigned to a `HUBManager`.
+ */
+@protocol HUBPerformanceInterval <NSObject>
+
+/// The event that this interval measures
+@property (nonatomic, readonly) HUBPerformanceEvent event;
+
+/**
+ *  The identifier of this interval
+ *
+ *  Identifiers are unique within the process, and are never `0` or `UINT64_MAX`. That makes them valid values
+ *  for `os_signpost_id_t`, so an observer can emit matching begin and end signposts for each interval.
+ */
+@property (nonatomic, readonly) uint64_t identifier;
+
+/// The identifier of the feature that the interval was measured for
+@property (nonatomic, copy, readonly) NSString *featureIdentifier;
+
+/// The URI of the view that the interval was measured for
+@property (nonatomic, copy, readonly) NSURL *viewURI;
+
+/// Any event-specific label for the interval. See `HUBPerformanceEvent` for what each event uses.
+@property (nonatomic, copy, readonly, nullable) NSString *label;
+
+/// The time the interval started, in seconds, using the same clock as `CACurrentMediaTime()`
+@property (nonatomic, readonly) NSTimeInterval startTime;
+
+/// The duration of the interval in seconds. Always `0` until the interval has ended.
+@property (nonatomic, readonly) NSTimeInterval duration;
+
+/// The number of items that the interval processed. See `HUBPerformanceEvent` for what each event counts.
+@property (nonatomic, readonly) NSUInteger itemCount;
+
+/// Any error that the measured event ended with. Always `nil` until the interval has ended.
+@property (nonatomic, strong, readonly, nullable) NSError *error;
+
+@end
+
+/**
+ *  Protocol implemented by objects that want to observe performance measurements made by the Hub Framework
+ *
+ *  Assign an object conforming to this protocol as the `performanceObserver` of a `HUBManager` to start receiving
+ *  measurements. Nothing is measured while no observer is assigned, so instrumentation has a negligible cost when it
+ *  is not being used. All methods are called on the main queue, and should return quickly, since they are called
+ *  from performance critical code paths - such as when components are configured while scrolling.
+ */
+@protocol HUBPerformanceObserver <NSObject>
+
+/**
+ *  Sent to the observer when an interval was ended
+ *
+ *  @param interval The interval that was ended, with its duration and item count set
+ */
+- (void)performanceIntervalDidEnd:(id<HUBPerformanceInterval>)interval;
+
+@optional
+
+/**
+ *  Sent to the observer when an interval was started
+ *
+ *  @param interval The interval that was started. The same instance is later passed to `performanceIntervalDidEnd:`.
+ *
+ *  Implement this method if you want to emit signposts when intervals start, rather than only recording them once
+ *  they have ended.
+ */
+- (void)performanceIntervalDidBegin:(id<HUBPerformanceInterval>)interval;
+
+@end
+
+NS_ASSUME_NONNULL_END
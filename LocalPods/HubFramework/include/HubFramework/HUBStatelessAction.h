@@ -19,9 +19,23 @@
  *  under the License.
  */
 
-#import "HUBComponentModelJSONSchema.h"
+#import "HUBAction.h"
 
-/// Concrete implementation of the `HUBComponentModelJSONSchema` API
-@interface HUBComponentModelJSONSchemaImplementation : NSObject <HUBComponentModelJSONSchema>
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Extended action protocol used to define actions that don't keep any state between invocations
+ *
+ *  Conform to this protocol instead of `HUBAction` if your action can safely be performed multiple times,
+ *  in any context, using the same instance. The Hub Framework will then only ask your `HUBActionFactory`
+ *  to create the action once per identifier, and reuse that instance for all subsequent invocations,
+ *  until the factory is unregistered.
+ *
+ *  Asynchronous actions (see `HUBAsyncAction`) are never reused, even if they conform to this protocol,
+ *  since the framework assigns a delegate to each performed asynchronous action.
+ */
+@protocol HUBStatelessAction <HUBAction>
 
 @end
+
+NS_ASSUME_NONNULL_END
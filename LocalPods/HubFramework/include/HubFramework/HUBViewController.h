@@ -191,6 +191,15 @@ NS_ASSUME_NONNULL_BEGIN
 /// Whether the view controller's content view is currently being scrolled
 @property (nonatomic, assign, readonly) BOOL isViewScrolling;
 
+/**
+ *  The number of view models that were never rendered, because a newer one arrived before they could be
+ *
+ *  View model updates are coalesced into at most one render per display frame. If several view models are
+ *  loaded while a render is in progress, or within the same frame, only the newest one is rendered, and the
+ *  rendering is performed as a single update from the view model that is currently displayed.
+ */
+@property (nonatomic, assign, readonly) NSUInteger droppedViewModelCount;
+
 /**
  *  Return the frame used to render a body component at a given index
  *
@@ -22,6 +22,7 @@
 #import "HUBManager.h"
 #import "HUBConnectivityStateResolver.h"
 #import "HUBDefaults.h"
+#import "HUBPerformanceObserver.h"
 
 // JSON
 #import "HUBJSONSchema.h"
@@ -44,6 +45,7 @@
 #import "HUBContentOperation.h"
 #import "HUBContentOperationWithInitialContent.h"
 #import "HUBContentOperationWithPaginatedContent.h"
+#import "HUBContentOperationWithConnectivityIndependentContent.h"
 #import "HUBContentOperationActionObserver.h"
 #import "HUBContentOperationActionPerformer.h"
 #import "HUBContentOperationContext.h"
@@ -64,9 +66,11 @@
 // Components
 #import "HUBComponent.h"
 #import "HUBComponentWithChildren.h"
+#import "HUBComponentWithRecyclableChildren.h"
 #import "HUBComponentWithScrolling.h"
 #import "HUBComponentWithImageHandling.h"
 #import "HUBComponentWithRestorableUIState.h"
+#import "HUBComponentUIStateCache.h"
 #import "HUBComponentWithSelectionState.h"
 #import "HUBComponentContentOffsetObserver.h"
 #import "HUBComponentViewObserver.h"
@@ -94,12 +98,15 @@
 // Images & Icons
 #import "HUBImageLoaderFactory.h"
 #import "HUBImageLoader.h"
+#import "HUBImageLoaderWithBatchedRequests.h"
+#import "HUBImageLoaderWithSizeVariants.h"
 #import "HUBIcon.h"
 #import "HUBIconImageResolver.h"
 
 // Actions
 #import "HUBAction.h"
 #import "HUBAsyncAction.h"
+#import "HUBStatelessAction.h"
 #import "HUBActionFactory.h"
 #import "HUBActionRegistry.h"
 #import "HUBActionPerformer.h"
@@ -109,3 +116,5 @@
 
 // Live
 #import "HUBLiveService.h"
+#import "HUBFrameProfiler.h"
+#import "HUBContentOperationRecorder.h"
@@ -55,6 +55,9 @@ NS_ASSUME_NONNULL_BEGIN
  *
  *  This method will return `nil` if no `HUBActionFactory` was found matching
  *  the given identifier's namespace, or if that factory in turn returned `nil`.
+ *
+ *  Actions conforming to `HUBStatelessAction` are only created once per identifier,
+ *  and are then reused until their factory is unregistered.
  */
 - (nullable id<HUBAction>)createCustomActionForIdentifier:(HUBIdentifier *)identifier;
 
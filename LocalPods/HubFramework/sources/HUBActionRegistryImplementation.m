@@ -22,6 +22,8 @@
 #import "HUBActionRegistryImplementation.h"
 
 #import "HUBActionFactory.h"
+#import "HUBAsyncAction.h"
+#import "HUBStatelessAction.h"
 #import "HUBIdentifier.h"
 #import "HUBSelectionAction.h"
 
@@ -30,6 +32,7 @@ NS_ASSUME_NONNULL_BEGIN
 @interface HUBActionRegistryImplementation ()
 
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, id<HUBActionFactory>> *actionFactories;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, id<HUBAction>> *> *statelessActionsByNamespace;
 
 @end
 
@@ -51,6 +54,7 @@ NS_ASSUME_NONNULL_BEGIN
     if (self) {
         _selectionAction = selectionAction;
         _actionFactories = [NSMutableDictionary new];
+        _statelessActionsByNamespace = [NSMutableDictionary new];
     }
     
     return self;
@@ -60,8 +64,23 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable id<HUBAction>)createCustomActionForIdentifier:(HUBIdentifier *)identifier
 {
-    id<HUBActionFactory> const factory = self.actionFactories[identifier.namespacePart];
-    return [factory createActionForName:identifier.namePart];
+    NSString * const actionNamespace = identifier.namespacePart;
+    NSString * const actionName = identifier.namePart;
+    NSMutableDictionary<NSString *, id<HUBAction>> * const statelessActions = self.statelessActionsByNamespace[actionNamespace];
+    id<HUBAction> const cachedAction = statelessActions[actionName];
+    
+    if (cachedAction != nil) {
+        return cachedAction;
+    }
+    
+    id<HUBActionFactory> const factory = self.actionFactories[actionNamespace];
+    id<HUBAction> const action = [factory createActionForName:actionName];
+    
+    if (statelessActions != nil && [self isActionReusable:action]) {
+        statelessActions[actionName] = action;
+    }
+    
+    return action;
 }
 
 #pragma mark - HUBActionRegistry
@@ -75,11 +94,25 @@ NS_ASSUME_NONNULL_BEGIN
     }
     
     self.actionFactories[actionNamespace] = actionFactory;
+    self.statelessActionsByNamespace[actionNamespace] = [NSMutableDictionary new];
 }
 
 - (void)unregisterActionFactoryForNamespace:(NSString *)actionNamespace
 {
     self.actionFactories[actionNamespace] = nil;
+    self.statelessActionsByNamespace[actionNamespace] = nil;
+}
+
+#pragma mark - Private utilities
+
+- (BOOL)isActionReusable:(nullable id<HUBAction>)action
+{
+    if (![action conformsToProtocol:@protocol(HUBStatelessAction)]) {
+        return NO;
+    }
+    
+    // Async actions get a delegate assigned each time they are performed, so they can't be shared
+    return ![action conformsToProtocol:@protocol(HUBAsyncAction)];
 }
 
 @end
@@ -29,6 +29,7 @@
 #import "HUBIdentifier.h"
 #import "HUBComponentLayoutManager.h"
 #import "HUBViewModelDiff.h"
+#import "HUBWindowedComponentModelArray.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -42,6 +43,11 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, NSMutableSet<NSIndexPath *> *> *indexPathsByVerticalGroup;
 @property (nonatomic, strong, nullable) NSMutableDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *previousLayoutAttributesByIndexPath;
 @property (nonatomic, strong, nullable) HUBViewModelDiff *lastViewModelDiff;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSNumber *> *measuredComponentHeightsByIdentifier;
+@property (nonatomic) CGFloat totalMeasuredComponentHeight;
+@property (nonatomic) NSRange computedWindowRange;
+@property (nonatomic) CGSize computedCollectionViewSize;
+@property (nonatomic) BOOL computedWithHeaderMargin;
 
 @property (nonatomic) CGSize contentSize;
 
@@ -60,6 +66,7 @@ NS_ASSUME_NONNULL_BEGIN
         _componentCache = [NSMutableDictionary new];
         _layoutAttributesByIndexPath = [NSMutableDictionary new];
         _indexPathsByVerticalGroup = [NSMutableDictionary new];
+        _measuredComponentHeightsByIdentifier = [NSMutableDictionary new];
     }
     
     return self;
@@ -74,10 +81,25 @@ NS_ASSUME_NONNULL_BEGIN
     self.viewModel = viewModel;
 
     self.previousLayoutAttributesByIndexPath = [self.layoutAttributesByIndexPath copy];
+    self.computedCollectionViewSize = collectionViewSize;
+    self.computedWithHeaderMargin = addHeaderMargin;
 
+    [self computeLayoutAttributes];
+}
+
+- (void)computeLayoutAttributes
+{
+    CGSize const collectionViewSize = self.computedCollectionViewSize;
+    BOOL const addHeaderMargin = self.computedWithHeaderMargin;
+    
     [self.layoutAttributesByIndexPath removeAllObjects];
     [self.indexPathsByVerticalGroup removeAllObjects];
     
+    // Rows of windowed arrays that are outside of the window get an estimated size, to avoid building their models
+    HUBWindowedComponentModelArray * const windowedComponentModels = [self windowedBodyComponentModels];
+    NSArray<NSString *> * const windowedComponentIdentifiers = windowedComponentModels.componentModelIdentifiers;
+    NSRange const windowRange = windowedComponentModels.windowRange;
+    
     BOOL componentIsInTopRow = YES;
     NSMutableArray<id<HUBComponent>> * const componentsOnCurrentRow = [NSMutableArray new];
     CGFloat currentRowMaxY = 0;
@@ -88,80 +110,113 @@ NS_ASSUME_NONNULL_BEGIN
     CGFloat maxBottomRowHeightWithMargins = 0;
     
     for (NSUInteger componentIndex = 0; componentIndex < allComponentsCount; componentIndex++) {
-        id<HUBComponentModel> const componentModel = self.viewModel.bodyComponentModels[componentIndex];
-        id<HUBComponent> const component = [self componentForModel:componentModel];
-        NSSet<HUBComponentLayoutTrait> * const componentLayoutTraits = component.layoutTraits;
-        BOOL isLastComponent = (componentIndex == allComponentsCount - 1);
+        // Models of very long lists are built on demand, so make sure they can be released as soon as they are laid out
+        @autoreleasepool {
+            BOOL isLastComponent = (componentIndex == allComponentsCount - 1);
+            
+            if (windowedComponentModels != nil && !NSLocationInRange(componentIndex, windowRange)) {
+                CGFloat const estimatedHeight = [self estimatedHeightForComponentWithIdentifier:windowedComponentIdentifiers[componentIndex]];
+                
+                if (estimatedHeight > 0) {
+                    if (componentsOnCurrentRow.count > 0) {
+                        [self updateLayoutAttributesForComponentsIfNeeded:componentsOnCurrentRow
+                                                       lastComponentIndex:(NSInteger)componentIndex - 1
+                                                          firstComponentX:firstComponentOnCurrentRowOrigin.x
+                                                           lastComponentX:currentPoint.x
+                                                                 rowWidth:collectionViewSize.width];
+                        
+                        [componentsOnCurrentRow removeAllObjects];
+                    }
+                    
+                    // Estimated rows always fill the width of the collection view, so the next component starts a new row
+                    CGRect const estimatedViewFrame = CGRectMake(0, currentRowMaxY, collectionViewSize.width, estimatedHeight);
+                    [self registerComponentViewFrame:estimatedViewFrame forIndex:componentIndex];
+                    
+                    componentIsInTopRow = NO;
+                    currentPoint = CGPointMake(collectionViewSize.width, CGRectGetMinY(estimatedViewFrame));
+                    currentRowMaxY = CGRectGetMaxY(estimatedViewFrame);
+                    continue;
+                }
+            }
+            
+            id<HUBComponentModel> const componentModel = self.viewModel.bodyComponentModels[componentIndex];
+            id<HUBComponent> const component = [self componentForModel:componentModel];
+            NSSet<HUBComponentLayoutTrait> * const componentLayoutTraits = component.layoutTraits;
 
-        CGRect componentViewFrame = [self defaultViewFrameForComponent:component
-                                                                 model:componentModel
-                                                          currentPoint:currentPoint
-                                                    collectionViewSize:collectionViewSize];
+            CGRect componentViewFrame = [self defaultViewFrameForComponent:component
+                                                                     model:componentModel
+                                                              currentPoint:currentPoint
+                                                        collectionViewSize:collectionViewSize];
 
-        UIEdgeInsets margins = [self defaultMarginsForComponent:component
-                                                     isInTopRow:componentIsInTopRow
-                                         componentsOnCurrentRow:componentsOnCurrentRow
-                                             collectionViewSize:collectionViewSize
-                                                addHeaderMargin:addHeaderMargin];
+            UIEdgeInsets margins = [self defaultMarginsForComponent:component
+                                                         isInTopRow:componentIsInTopRow
+                                             componentsOnCurrentRow:componentsOnCurrentRow
+                                                 collectionViewSize:collectionViewSize
+                                                    addHeaderMargin:addHeaderMargin];
 
-        componentViewFrame.origin.x = currentPoint.x + margins.left;
+            componentViewFrame.origin.x = currentPoint.x + margins.left;
 
-        BOOL couldFitOnTheRow = CGRectGetMaxX(componentViewFrame) + margins.right <= collectionViewSize.width;
-        
-        if (couldFitOnTheRow == NO) {
-            [self updateLayoutAttributesForComponentsIfNeeded:componentsOnCurrentRow
-                                           lastComponentIndex:(NSInteger)componentIndex - 1
-                                              firstComponentX:firstComponentOnCurrentRowOrigin.x
-                                               lastComponentX:currentPoint.x
-                                                     rowWidth:collectionViewSize.width];
-
-            if (componentsOnCurrentRow.count > 0) {
-                margins.top = 0;
-                
-                for (id<HUBComponent> const verticallyPrecedingComponent in componentsOnCurrentRow) {
-                    CGFloat const marginToComponent = [self.componentLayoutManager verticalMarginForComponentWithLayoutTraits:componentLayoutTraits
-                                                                                               precedingComponentLayoutTraits:verticallyPrecedingComponent.layoutTraits];
+            BOOL couldFitOnTheRow = CGRectGetMaxX(componentViewFrame) + margins.right <= collectionViewSize.width;
+            
+            if (couldFitOnTheRow == NO) {
+                [self updateLayoutAttributesForComponentsIfNeeded:componentsOnCurrentRow
+                                               lastComponentIndex:(NSInteger)componentIndex - 1
+                                                  firstComponentX:firstComponentOnCurrentRowOrigin.x
+                                                   lastComponentX:currentPoint.x
+                                                         rowWidth:collectionViewSize.width];
+
+                if (componentsOnCurrentRow.count > 0) {
+                    margins.top = 0;
                     
-                    if (marginToComponent > margins.top) {
-                        margins.top = marginToComponent;
+                    for (id<HUBComponent> const verticallyPrecedingComponent in componentsOnCurrentRow) {
+                        CGFloat const marginToComponent = [self.componentLayoutManager verticalMarginForComponentWithLayoutTraits:componentLayoutTraits
+                                                                                                   precedingComponentLayoutTraits:verticallyPrecedingComponent.layoutTraits];
+                        
+                        if (marginToComponent > margins.top) {
+                            margins.top = marginToComponent;
+                        }
                     }
                 }
+                
+                componentViewFrame.origin.x = [self.componentLayoutManager marginBetweenComponentWithLayoutTraits:componentLayoutTraits
+                                                                                                   andContentEdge:HUBComponentLayoutContentEdgeLeft];
+                
+                componentViewFrame.origin.y = currentRowMaxY + margins.top;
+                componentIsInTopRow = NO;
+                [componentsOnCurrentRow removeAllObjects];
+                currentPoint.y = CGRectGetMinY(componentViewFrame);
+                currentRowMaxY = CGRectGetMaxY(componentViewFrame) + margins.bottom;
+            } else {
+                componentViewFrame.origin.y = currentPoint.y + margins.top;
             }
             
-            componentViewFrame.origin.x = [self.componentLayoutManager marginBetweenComponentWithLayoutTraits:componentLayoutTraits
-                                                                                               andContentEdge:HUBComponentLayoutContentEdgeLeft];
+            componentViewFrame = [self horizontallyAdjustComponentViewFrame:componentViewFrame
+                                                      forCollectionViewSize:collectionViewSize
+                                                                    margins:margins];
             
-            componentViewFrame.origin.y = currentRowMaxY + margins.top;
-            componentIsInTopRow = NO;
-            [componentsOnCurrentRow removeAllObjects];
-            currentPoint.y = CGRectGetMinY(componentViewFrame);
-            currentRowMaxY = CGRectGetMaxY(componentViewFrame) + margins.bottom;
-        } else {
-            componentViewFrame.origin.y = currentPoint.y + margins.top;
-        }
-        
-        componentViewFrame = [self horizontallyAdjustComponentViewFrame:componentViewFrame
-                                                  forCollectionViewSize:collectionViewSize
-                                                                margins:margins];
-        
-        currentPoint.x = CGRectGetMaxX(componentViewFrame);
-        currentRowMaxY = MAX(currentRowMaxY, CGRectGetMaxY(componentViewFrame));
-        
-        [self registerComponentViewFrame:componentViewFrame forIndex:componentIndex];
-        
-        [componentsOnCurrentRow addObject:component];
+            currentPoint.x = CGRectGetMaxX(componentViewFrame);
+            currentRowMaxY = MAX(currentRowMaxY, CGRectGetMaxY(componentViewFrame));
+            
+            [self registerComponentViewFrame:componentViewFrame forIndex:componentIndex];
+            
+            if (windowedComponentModels != nil) {
+                [self registerMeasuredHeight:CGRectGetHeight(componentViewFrame) forComponentWithIdentifier:componentModel.identifier];
+            }
+            
+            [componentsOnCurrentRow addObject:component];
 
-        if (componentsOnCurrentRow.count == 1) {
-            firstComponentOnCurrentRowOrigin = componentViewFrame.origin;
-        }
+            if (componentsOnCurrentRow.count == 1) {
+                firstComponentOnCurrentRowOrigin = componentViewFrame.origin;
+            }
 
-        if (isLastComponent) {
-            // We center components if needed when we go to a new row. If it is the last row we need to center it here
-            [self updateLayoutAttributesForComponentsIfNeeded:componentsOnCurrentRow
-                                           lastComponentIndex:(NSInteger)componentIndex
-                                              firstComponentX:firstComponentOnCurrentRowOrigin.x
-                                               lastComponentX:currentPoint.x
-                                                     rowWidth:collectionViewSize.width];
+            if (isLastComponent) {
+                // We center components if needed when we go to a new row. If it is the last row we need to center it here
+                [self updateLayoutAttributesForComponentsIfNeeded:componentsOnCurrentRow
+                                               lastComponentIndex:(NSInteger)componentIndex
+                                                  firstComponentX:firstComponentOnCurrentRowOrigin.x
+                                                   lastComponentX:currentPoint.x
+                                                         rowWidth:collectionViewSize.width];
+            }
         }
     }
 
@@ -169,6 +224,8 @@ NS_ASSUME_NONNULL_BEGIN
                                      bottomRowComponents:componentsOnCurrentRow
                                      minimumBottomMargin:maxBottomRowHeightWithMargins - maxBottomRowComponentHeight
                                       collectionViewSize:collectionViewSize];
+    
+    self.computedWindowRange = windowedComponentModels.windowRange;
 }
 
 - (CGPoint)targetContentOffsetForProposedContentOffset:(CGPoint)proposedContentOffset
@@ -242,6 +299,22 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - UICollectionViewLayout
 
+- (void)prepareLayout
+{
+    [super prepareLayout];
+    
+    HUBWindowedComponentModelArray * const windowedComponentModels = [self windowedBodyComponentModels];
+    
+    if (windowedComponentModels == nil) {
+        return;
+    }
+    
+    // Once the window has moved (as cells are being displayed), the rows that it moved to need to be measured
+    if (!NSEqualRanges(windowedComponentModels.windowRange, self.computedWindowRange)) {
+        [self computeLayoutAttributes];
+    }
+}
+
 - (nullable NSArray<UICollectionViewLayoutAttributes *> *)layoutAttributesForElementsInRect:(CGRect)rect
 {
     NSMutableArray<UICollectionViewLayoutAttributes *> * const layoutAttributes = [NSMutableArray new];
@@ -276,6 +349,46 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Private utilities
 
+- (nullable HUBWindowedComponentModelArray *)windowedBodyComponentModels
+{
+    NSArray<id<HUBComponentModel>> * const bodyComponentModels = self.viewModel.bodyComponentModels;
+    
+    if (![bodyComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]]) {
+        return nil;
+    }
+    
+    return (HUBWindowedComponentModelArray *)bodyComponentModels;
+}
+
+- (CGFloat)estimatedHeightForComponentWithIdentifier:(NSString *)componentIdentifier
+{
+    NSNumber * const measuredHeight = self.measuredComponentHeightsByIdentifier[componentIdentifier];
+    
+    if (measuredHeight != nil) {
+        return (CGFloat)measuredHeight.doubleValue;
+    }
+    
+    NSUInteger const measuredCount = self.measuredComponentHeightsByIdentifier.count;
+    
+    if (measuredCount == 0) {
+        return 0;
+    }
+    
+    return self.totalMeasuredComponentHeight / (CGFloat)measuredCount;
+}
+
+- (void)registerMeasuredHeight:(CGFloat)height forComponentWithIdentifier:(NSString *)componentIdentifier
+{
+    NSNumber * const previousHeight = self.measuredComponentHeightsByIdentifier[componentIdentifier];
+    
+    if (previousHeight != nil) {
+        self.totalMeasuredComponentHeight -= (CGFloat)previousHeight.doubleValue;
+    }
+    
+    self.measuredComponentHeightsByIdentifier[componentIdentifier] = @(height);
+    self.totalMeasuredComponentHeight += height;
+}
+
 - (id<HUBComponent>)componentForModel:(id<HUBComponentModel>)model
 {
     id<HUBComponent> const cachedComponent = self.componentCache[model.componentIdentifier];
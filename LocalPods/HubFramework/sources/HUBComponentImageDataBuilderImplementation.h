@@ -25,12 +25,28 @@
 @protocol HUBComponentImageDataJSONSchema;
 @protocol HUBIconImageResolver;
 @class HUBComponentImageDataImplementation;
+@class HUBComponentImageDataBuilderImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Delegate protocol for `HUBComponentImageDataBuilderImplementation`
+@protocol HUBComponentImageDataBuilderDelegate <NSObject>
+
+/**
+ *  Sent to the delegate of an image data builder whenever any of its values have been changed
+ *
+ *  @param imageDataBuilder The builder that was changed
+ */
+- (void)componentImageDataBuilderDidChange:(HUBComponentImageDataBuilderImplementation *)imageDataBuilder;
+
+@end
+
 /// Concrete implementation of the `HUBComponentImageDataBuilder` API
 @interface HUBComponentImageDataBuilderImplementation : NSObject <HUBComponentImageDataBuilder, NSCopying>
 
+/// The builder's delegate. Copies of the builder don't share it.
+@property (nonatomic, weak, nullable) id<HUBComponentImageDataBuilderDelegate> delegate;
+
 /// Any specific bundle that the builder should use to load local images (defaults to the main bundle)
 @property (nonatomic, weak, nullable) NSBundle *bundle;
 
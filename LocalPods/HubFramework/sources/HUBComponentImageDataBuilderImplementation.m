@@ -130,6 +130,48 @@ NS_ASSUME_NONNULL_BEGIN
                                                                 customData:self.customData];
 }
 
+#pragma mark - Property overrides
+
+- (void)setURL:(nullable NSURL *)URL
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _URL = [URL copy];
+#pragma clang diagnostic pop
+    
+    [self.delegate componentImageDataBuilderDidChange:self];
+}
+
+- (void)setPlaceholderIconIdentifier:(nullable NSString *)placeholderIconIdentifier
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _placeholderIconIdentifier = [placeholderIconIdentifier copy];
+#pragma clang diagnostic pop
+    
+    [self.delegate componentImageDataBuilderDidChange:self];
+}
+
+- (void)setLocalImage:(nullable UIImage *)localImage
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _localImage = localImage;
+#pragma clang diagnostic pop
+    
+    [self.delegate componentImageDataBuilderDidChange:self];
+}
+
+- (void)setCustomData:(nullable NSDictionary<NSString *, id> *)customData
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _customData = customData;
+#pragma clang diagnostic pop
+    
+    [self.delegate componentImageDataBuilderDidChange:self];
+}
+
 #pragma mark - Private utilities
 
 - (nullable id<HUBIcon>)buildPlaceholderIcon
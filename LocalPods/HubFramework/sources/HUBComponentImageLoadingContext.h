@@ -34,6 +34,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// The identifier of the image that this object is for
 @property (nonatomic, copy, readonly, nullable) NSString *imageIdentifier;
 
+/// The URL of the image data that this object is for. May differ from the URL that is loaded, in case a size variant is used.
+@property (nonatomic, copy, readonly) NSURL *imageURL;
+
 /// The identifier of the wrapper for the component that the image is for
 @property (nonatomic, copy, readonly) NSUUID *wrapperIdentifier;
 
@@ -48,12 +51,14 @@ NS_ASSUME_NONNULL_BEGIN
  *
  *  @param imageType The type of the image that this object is for
  *  @param imageIdentifier Any identifier for the image that this object is for
+ *  @param imageURL The URL of the image data that this object is for
  *  @param wrapperIdentifier The identifier of the wrapper for the component that the image is for
  *  @param childIndex Any index of a child component that the image is for
  *  @param timestamp The creation timestamp
  */
 - (instancetype)initWithImageType:(HUBComponentImageType)imageType
                   imageIdentifier:(nullable NSString *)imageIdentifier
+                         imageURL:(NSURL *)imageURL
                 wrapperIdentifier:(NSUUID *)wrapperIdentifier
                        childIndex:(nullable NSNumber *)childIndex
                         timestamp:(NSTimeInterval)timestamp HUB_DESIGNATED_INITIALIZER;
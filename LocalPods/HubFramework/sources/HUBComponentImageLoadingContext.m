@@ -27,15 +27,19 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)initWithImageType:(HUBComponentImageType)imageType
                   imageIdentifier:(nullable NSString *)imageIdentifier
+                         imageURL:(NSURL *)imageURL
                 wrapperIdentifier:(NSUUID *)wrapperIdentifier
                        childIndex:(nullable NSNumber *)childIndex
                         timestamp:(NSTimeInterval)timestamp
 {
+    NSParameterAssert(imageURL != nil);
+    
     self = [super init];
     
     if (self) {
         _imageType = imageType;
         _imageIdentifier = [imageIdentifier copy];
+        _imageURL = [imageURL copy];
         _wrapperIdentifier = [wrapperIdentifier copy];
         _childIndex = [childIndex copy];
         _timestamp = timestamp;
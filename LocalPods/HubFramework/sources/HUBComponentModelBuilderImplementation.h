@@ -34,6 +34,15 @@ NS_ASSUME_NONNULL_BEGIN
 /// Concrete implementation of the `HUBComponentModelBuilder` API
 @interface HUBComponentModelBuilderImplementation : NSObject <HUBComponentModelBuilder, NSCopying>
 
+/**
+ *  A stamp identifying the current content of this builder
+ *
+ *  Used to check whether two builders would build equal component models, without having to build them. Copies of a
+ *  builder share its revision, and a new one is assigned whenever the builder, or any of its child, image data or
+ *  target builders, is changed.
+ */
+@property (nonatomic, assign, readonly) uint64_t contentRevision;
+
 /**
  *  Build an array of component models from a collection of builders
  *
@@ -48,6 +57,18 @@ NS_ASSUME_NONNULL_BEGIN
                                                       identifierOrder:(NSArray<NSString *> *)identifierOrder
                                                                parent:(nullable id<HUBComponentModel>)parent;
 
+/**
+ *  Sort a collection of builders into the order that their component models should have
+ *
+ *  @param builders The builders to sort. The keys should be model identifiers.
+ *  @param identifierOrder An ordered array of identifiers of the builders to sort.
+ *
+ *  The order is the same as the one used by `+buildComponentModelsUsingBuilders:identifierOrder:parent:`, so the builder
+ *  at each position of the returned array should build the component model for that index.
+ */
++ (NSArray<HUBComponentModelBuilderImplementation *> *)sortedBuildersFromBuilders:(NSDictionary<NSString *, HUBComponentModelBuilderImplementation *> *)builders
+                                                                  identifierOrder:(NSArray<NSString *> *)identifierOrder;
+
 /**
  *  Initialize an instance of this class with its required dependencies
  *
@@ -29,11 +29,15 @@
 #import "HUBComponentTargetImplementation.h"
 #import "HUBJSONSchema.h"
 #import "HUBComponentModelJSONSchema.h"
+#import "HUBComponentModelJSONSchemaImplementation.h"
+#import "HUBJSONExtractionPlan.h"
 #import "HUBJSONPath.h"
 #import "HUBComponentDefaults.h"
 #import "HUBIconImplementation.h"
 #import "HUBUtilities.h"
 
+#import <stdatomic.h>
+
 NS_ASSUME_NONNULL_BEGIN
 
 @protocol HUBComponentModelBuilderDelegate <NSObject>
@@ -42,9 +46,17 @@ NS_ASSUME_NONNULL_BEGIN
      groupIdentifierDidChange:(nullable NSString *)newGroupIdentifier
            oldGroupIdentifier:(nullable NSString *)oldGroupIdentifier;
 
+- (void)componentModelBuilderDidChange:(id<HUBComponentModelBuilder>)componentModelBuilder;
+
 @end
 
-@interface HUBComponentModelBuilderImplementation () <HUBComponentModelBuilderDelegate>
+static uint64_t HUBComponentModelBuilderNextContentRevision(void)
+{
+    static atomic_uint_fast64_t lastContentRevision = 0;
+    return (uint64_t)atomic_fetch_add_explicit(&lastContentRevision, 1, memory_order_relaxed) + 1;
+}
+
+@interface HUBComponentModelBuilderImplementation () <HUBComponentModelBuilderDelegate, HUBComponentImageDataBuilderDelegate, HUBComponentTargetBuilderDelegate>
 
 @property (nonatomic, weak) id<HUBComponentModelBuilderDelegate> delegate;
 @property (nonatomic, assign, readonly) HUBComponentType type;
@@ -58,6 +70,9 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, HUBComponentModelBuilderImplementation *> *childBuilders;
 @property (nonatomic, strong, readonly) NSMutableArray<NSString *> *childIdentifierOrder;
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSMutableArray<id<HUBComponentModelBuilder>> *> *childBuildersByGroupIdentifier;
+@property (nonatomic, copy, nullable) NSArray<HUBComponentModelBuilderImplementation *> *childBuildersSnapshot;
+@property (atomic, strong, nullable) HUBIdentifier *lastBuiltComponentIdentifier;
+@property (nonatomic, assign, readwrite) uint64_t contentRevision;
 
 @end
 
@@ -87,8 +102,24 @@ NS_ASSUME_NONNULL_BEGIN
                                                       identifierOrder:(NSArray<NSString *> *)identifierOrder
                                                                parent:(nullable id<HUBComponentModel>)parent
 {
-    NSMutableOrderedSet<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [NSMutableOrderedSet new];
-    NSMutableDictionary<NSNumber *, HUBComponentModelBuilderImplementation *> * const buildersByPreferredIndex = [NSMutableDictionary new];
+    NSArray<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [self sortedBuildersFromBuilders:builders
+                                                                                                identifierOrder:identifierOrder];
+    
+    NSMutableArray<id<HUBComponentModel>> * const models = [NSMutableArray new];
+    
+    for (HUBComponentModelBuilderImplementation * const builder in sortedBuilders) {
+        id<HUBComponentModel> const model = [builder buildForIndex:models.count parent:parent];
+        [models addObject:model];
+    }
+    
+    return [models copy];
+}
+
++ (NSArray<HUBComponentModelBuilderImplementation *> *)sortedBuildersFromBuilders:(NSDictionary<NSString *, HUBComponentModelBuilderImplementation *> *)builders
+                                                                  identifierOrder:(NSArray<NSString *> *)identifierOrder
+{
+    NSMutableArray<HUBComponentModelBuilderImplementation *> * const orderedBuilders = [NSMutableArray new];
+    NSMutableDictionary<NSNumber *, NSNumber *> * const builderPositionsByPreferredIndex = [NSMutableDictionary new];
     
     for (NSString * const identifier in identifierOrder) {
         HUBComponentModelBuilderImplementation * const builder = builders[identifier];
@@ -100,34 +131,121 @@ NS_ASSUME_NONNULL_BEGIN
         NSNumber * const preferredIndex = builder.preferredIndex;
         
         if (preferredIndex != nil) {
-            buildersByPreferredIndex[preferredIndex] = builder;
+            builderPositionsByPreferredIndex[preferredIndex] = @(orderedBuilders.count);
         }
         
-        [sortedBuilders addObject:builder];
+        [orderedBuilders addObject:builder];
+    }
+    
+    if (builderPositionsByPreferredIndex.count == 0) {
+        return [orderedBuilders copy];
     }
+    
+    return [self buildersBySortingBuilders:orderedBuilders usingPositionsByPreferredIndex:builderPositionsByPreferredIndex];
+}
 
-    NSArray *sortedPreferredIndexes = [[buildersByPreferredIndex allKeys] sortedArrayUsingSelector:@selector(compare:)];
-    for (NSNumber * const preferredIndex in sortedPreferredIndexes) {
-        HUBComponentModelBuilderImplementation * const builder = buildersByPreferredIndex[preferredIndex];
-        NSUInteger decodedPreferredIndex = preferredIndex.unsignedIntegerValue;
+/**
+ *  Resolve the preferred indexes of a sequence of builders in a single pass
+ *
+ *  The result is identical to removing each pinned builder and re-inserting it at its preferred index (or
+ *  appending it, if the index is out of bounds), in ascending preferred index order. Pinned builders always
+ *  end up in ascending preferred index order, interleaved with the unpinned ones in their original order, so
+ *  all that needs to be resolved is how many unpinned builders precede each pinned one. When a pinned builder
+ *  is placed, the builders before it are all previously placed ones plus a prefix of the builders that are
+ *  still in their original positions - and only the unpinned ones in that prefix stay ahead of it. Since that
+ *  prefix never shrinks for in-bounds indexes, it can be tracked with a single forward cursor.
+ */
++ (NSArray<HUBComponentModelBuilderImplementation *> *)buildersBySortingBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders
+                                                  usingPositionsByPreferredIndex:(NSDictionary<NSNumber *, NSNumber *> *)positionsByPreferredIndex
+{
+    NSArray<NSNumber *> * const sortedPreferredIndexes = [positionsByPreferredIndex.allKeys sortedArrayUsingComparator:^NSComparisonResult(NSNumber *indexA, NSNumber *indexB) {
+        NSUInteger const decodedIndexA = indexA.unsignedIntegerValue;
+        NSUInteger const decodedIndexB = indexB.unsignedIntegerValue;
         
-        [sortedBuilders removeObject:builder];
+        if (decodedIndexA == decodedIndexB) {
+            return NSOrderedSame;
+        }
         
-        if (decodedPreferredIndex >= sortedBuilders.count) {
-            [sortedBuilders addObject:builder];
-        } else {
-            [sortedBuilders insertObject:builder atIndex:decodedPreferredIndex];
+        return (decodedIndexA < decodedIndexB) ? NSOrderedAscending : NSOrderedDescending;
+    }];
+    
+    NSUInteger const builderCount = builders.count;
+    NSUInteger const pinnedCount = sortedPreferredIndexes.count;
+    
+    // 1-based rank of each pinned builder by its original position, 0 for unpinned builders
+    NSMutableData * const ranksData = [NSMutableData dataWithLength:builderCount * sizeof(NSUInteger)];
+    NSUInteger * const ranks = ranksData.mutableBytes;
+    
+    NSMutableData * const pinnedPositionsData = [NSMutableData dataWithLength:pinnedCount * sizeof(NSUInteger)];
+    NSUInteger * const pinnedPositions = pinnedPositionsData.mutableBytes;
+    
+    NSMutableData * const unpinnedCountsData = [NSMutableData dataWithLength:pinnedCount * sizeof(NSUInteger)];
+    NSUInteger * const unpinnedCountsBeforePinned = unpinnedCountsData.mutableBytes;
+    
+    for (NSUInteger pinnedIndex = 0; pinnedIndex < pinnedCount; pinnedIndex++) {
+        NSUInteger const position = positionsByPreferredIndex[sortedPreferredIndexes[pinnedIndex]].unsignedIntegerValue;
+        pinnedPositions[pinnedIndex] = position;
+        ranks[position] = pinnedIndex + 1;
+    }
+    
+    NSUInteger placedCount = 0;
+    NSUInteger cursor = 0;
+    NSUInteger cursorRemainingCount = 0;
+    NSUInteger cursorUnpinnedCount = 0;
+    
+    for (; placedCount < pinnedCount; placedCount++) {
+        NSUInteger const preferredIndex = sortedPreferredIndexes[placedCount].unsignedIntegerValue;
+        
+        // Out of bounds builders are appended, and stay after everything placed before them
+        if (preferredIndex >= builderCount - 1) {
+            break;
+        }
+        
+        if (pinnedPositions[placedCount] < cursor) {
+            cursorRemainingCount--;
         }
+        
+        NSUInteger const remainingCountBefore = preferredIndex - placedCount;
+        
+        while (cursorRemainingCount < remainingCountBefore) {
+            NSUInteger const rank = ranks[cursor];
+            
+            if (rank == 0) {
+                cursorRemainingCount++;
+                cursorUnpinnedCount++;
+            } else if (rank > placedCount + 1) {
+                cursorRemainingCount++;
+            }
+            
+            cursor++;
+        }
+        
+        unpinnedCountsBeforePinned[placedCount] = cursorUnpinnedCount;
     }
     
-    NSMutableArray<id<HUBComponentModel>> * const models = [NSMutableArray new];
+    NSMutableArray<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [NSMutableArray arrayWithCapacity:builderCount];
+    NSUInteger nextPinnedIndex = 0;
+    NSUInteger unpinnedCount = 0;
     
-    for (HUBComponentModelBuilderImplementation * const builder in sortedBuilders) {
-        id<HUBComponentModel> const model = [builder buildForIndex:models.count parent:parent];
-        [models addObject:model];
+    for (NSUInteger position = 0; position < builderCount; position++) {
+        if (ranks[position] != 0) {
+            continue;
+        }
+        
+        while (nextPinnedIndex < placedCount && unpinnedCountsBeforePinned[nextPinnedIndex] <= unpinnedCount) {
+            [sortedBuilders addObject:builders[pinnedPositions[nextPinnedIndex]]];
+            nextPinnedIndex++;
+        }
+        
+        [sortedBuilders addObject:builders[position]];
+        unpinnedCount++;
     }
     
-    return [models copy];
+    for (; nextPinnedIndex < pinnedCount; nextPinnedIndex++) {
+        [sortedBuilders addObject:builders[pinnedPositions[nextPinnedIndex]]];
+    }
+    
+    return sortedBuilders;
 }
 
 #pragma mark - Initializer
@@ -176,10 +294,13 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                                              iconImageResolver:iconImageResolver];
         }
         
+        _mainImageDataBuilderImplementation.delegate = self;
+        _backgroundImageDataBuilderImplementation.delegate = self;
         _customImageDataBuilders = [NSMutableDictionary new];
         _childBuilders = [NSMutableDictionary new];
         _childIdentifierOrder = [NSMutableArray new];
         _childBuildersByGroupIdentifier = [NSMutableDictionary new];
+        _contentRevision = HUBComponentModelBuilderNextContentRevision();
     }
     
     return self;
@@ -282,6 +403,12 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)removeBuilderForChildWithIdentifier:(NSString *)identifier
 {
     id<HUBComponentModelBuilder> builder = self.childBuilders[identifier];
+    
+    if (builder == nil) {
+        return;
+    }
+    
+    [self builderDidChange];
     self.childBuilders[identifier] = nil;
     [self.childIdentifierOrder removeObject:identifier];
 
@@ -298,6 +425,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)removeAllChildBuilders
 {
+    [self builderDidChange];
     [self.childBuilders removeAllObjects];
     [self.childIdentifierOrder removeAllObjects];
     [self.childBuildersByGroupIdentifier removeAllObjects];
@@ -313,93 +441,100 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)addJSONDictionary:(NSDictionary<NSString *, NSObject *> *)dictionary
 {
     id<HUBComponentModelJSONSchema> componentModelSchema = self.JSONSchema.componentModelSchema;
+    HUBJSONExtractionPlan * const extractionPlan = [HUBComponentModelJSONSchemaImplementation extractionPlanForSchema:componentModelSchema];
+    NSArray<NSArray<NSObject *> *> * const values = [extractionPlan valuesFromJSONDictionary:dictionary];
     
-    NSString * const componentIdentifierString = [componentModelSchema.componentIdentifierPath stringFromJSONDictionary:dictionary];
+    NSString * const componentIdentifierString = (NSString *)values[HUBComponentModelJSONSchemaPathIndexComponentIdentifier].firstObject;
     
     if (componentIdentifierString != nil) {
-        NSArray * const componentIdentifierParts = [componentIdentifierString componentsSeparatedByString:@":"];
+        NSRange const separatorRange = [componentIdentifierString rangeOfString:@":" options:NSLiteralSearch];
         
-        if (componentIdentifierParts.count > 1) {
-            self.componentNamespace = componentIdentifierParts[0];
-            self.componentName = componentIdentifierParts[1];
-        } else if (componentIdentifierParts.count == 1) {
-            self.componentName = componentIdentifierParts[0];
+        if (separatorRange.location == NSNotFound) {
+            self.componentName = componentIdentifierString;
+        } else {
+            NSUInteger const nameLocation = NSMaxRange(separatorRange);
+            NSRange const remainderRange = NSMakeRange(nameLocation, componentIdentifierString.length - nameLocation);
+            NSRange const trailingSeparatorRange = [componentIdentifierString rangeOfString:@":" options:NSLiteralSearch range:remainderRange];
+            NSUInteger const nameEnd = trailingSeparatorRange.location == NSNotFound ? componentIdentifierString.length : trailingSeparatorRange.location;
+            
+            self.componentNamespace = [componentIdentifierString substringToIndex:separatorRange.location];
+            self.componentName = [componentIdentifierString substringWithRange:NSMakeRange(nameLocation, nameEnd - nameLocation)];
         }
     }
     
-    NSString * const groupIdentifier = [componentModelSchema.groupIdentifierPath stringFromJSONDictionary:dictionary];
+    NSString * const groupIdentifier = (NSString *)values[HUBComponentModelJSONSchemaPathIndexGroupIdentifier].firstObject;
     
     if (groupIdentifier != nil) {
         self.groupIdentifier = groupIdentifier;
     }
     
-    NSString * const componentCategory = [componentModelSchema.componentCategoryPath stringFromJSONDictionary:dictionary];
+    NSString * const componentCategory = (NSString *)values[HUBComponentModelJSONSchemaPathIndexComponentCategory].firstObject;
     
     if (componentCategory != nil) {
         self.componentCategory = componentCategory;
     }
     
-    NSString * const title = [componentModelSchema.titlePath stringFromJSONDictionary:dictionary];
+    NSString * const title = (NSString *)values[HUBComponentModelJSONSchemaPathIndexTitle].firstObject;
     
     if (title != nil) {
         self.title = title;
     }
     
-    NSString * const subtitle = [componentModelSchema.subtitlePath stringFromJSONDictionary:dictionary];
+    NSString * const subtitle = (NSString *)values[HUBComponentModelJSONSchemaPathIndexSubtitle].firstObject;
     
     if (subtitle != nil) {
         self.subtitle = subtitle;
     }
     
-    NSString * const accessoryTitle = [componentModelSchema.accessoryTitlePath stringFromJSONDictionary:dictionary];
+    NSString * const accessoryTitle = (NSString *)values[HUBComponentModelJSONSchemaPathIndexAccessoryTitle].firstObject;
     
     if (accessoryTitle != nil) {
         self.accessoryTitle = accessoryTitle;
     }
     
-    NSString * const descriptionText = [componentModelSchema.descriptionTextPath stringFromJSONDictionary:dictionary];
+    NSString * const descriptionText = (NSString *)values[HUBComponentModelJSONSchemaPathIndexDescriptionText].firstObject;
     
     if (descriptionText != nil) {
         self.descriptionText = descriptionText;
     }
     
-    NSDictionary * const targetDictionary = [componentModelSchema.targetDictionaryPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const targetDictionary = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexTargetDictionary].firstObject;
     
     if (targetDictionary != nil) {
         [[self getOrCreateTargetBuilder] addJSONDictionary:targetDictionary];
     }
     
-    NSDictionary * const metadata = [componentModelSchema.metadataPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const metadata = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexMetadata].firstObject;
     
     if (metadata != nil) {
         self.metadata = HUBMergeDictionaries(self.metadata, metadata);
     }
     
-    NSDictionary * const loggingData = [componentModelSchema.loggingDataPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const loggingData = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexLoggingData].firstObject;
     
     if (loggingData != nil) {
         self.loggingData = HUBMergeDictionaries(self.loggingData, loggingData);
     }
     
-    NSDictionary * const customData = [componentModelSchema.customDataPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const customData = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexCustomData].firstObject;
     
     if (customData != nil) {
         self.customData = HUBMergeDictionaries(self.customData, customData);
     }
     
-    NSDictionary * const mainImageDataDictionary = [componentModelSchema.mainImageDataDictionaryPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const mainImageDataDictionary = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexMainImageDataDictionary].firstObject;
     
     if (mainImageDataDictionary != nil) {
         [self.mainImageDataBuilderImplementation addJSONDictionary:mainImageDataDictionary];
     }
     
-    NSDictionary * const backgroundImageDataDictionary = [componentModelSchema.backgroundImageDataDictionaryPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const backgroundImageDataDictionary = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexBackgroundImageDataDictionary].firstObject;
     
     if (backgroundImageDataDictionary != nil) {
         [self.backgroundImageDataBuilderImplementation addJSONDictionary:backgroundImageDataDictionary];
     }
     
-    NSDictionary * const customImageDataDictionary = [componentModelSchema.customImageDataDictionaryPath dictionaryFromJSONDictionary:dictionary];
+    NSDictionary * const customImageDataDictionary = (NSDictionary *)values[HUBComponentModelJSONSchemaPathIndexCustomImageDataDictionary].firstObject;
     
     for (NSString * const imageIdentifier in customImageDataDictionary) {
         NSDictionary * const imageDataDictionary = customImageDataDictionary[imageIdentifier];
@@ -410,13 +545,13 @@ NS_ASSUME_NONNULL_BEGIN
         }
     }
     
-    NSString * const iconIdentifier = [componentModelSchema.iconIdentifierPath stringFromJSONDictionary:dictionary];
+    NSString * const iconIdentifier = (NSString *)values[HUBComponentModelJSONSchemaPathIndexIconIdentifier].firstObject;
     
     if (iconIdentifier != nil) {
         self.iconIdentifier = iconIdentifier;
     }
     
-    NSArray * const childDictionaries = [componentModelSchema.childDictionariesPath valuesFromJSONDictionary:dictionary];
+    NSArray * const childDictionaries = values[HUBComponentModelJSONSchemaPathIndexChildDictionaries];
     
     for (NSDictionary * const childDictionary in childDictionaries) {
         NSString * const childModelIdentifier = [componentModelSchema.identifierPath stringFromJSONDictionary:childDictionary];
@@ -447,9 +582,9 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                                                 iconImageResolver:self.iconImageResolver
                                                                                                              mainImageDataBuilder:mainImageDataBuilder
                                                                                                        backgroundImageDataBuilder:backgroundImageDataBuilder];
-    copy.delegate = self.delegate;
     copy.componentNamespace = self.componentNamespace;
     copy.componentName = self.componentName;
+    copy.lastBuiltComponentIdentifier = self.lastBuiltComponentIdentifier;
     copy.componentCategory = self.componentCategory;
     copy.preferredIndex = self.preferredIndex;
     copy.groupIdentifier = self.groupIdentifier;
@@ -459,16 +594,20 @@ NS_ASSUME_NONNULL_BEGIN
     copy.descriptionText = self.descriptionText;
     copy.iconIdentifier = self.iconIdentifier;
     copy.targetBuilderImplementation = [self.targetBuilderImplementation copy];
+    copy.targetBuilderImplementation.delegate = copy;
     copy.customData = self.customData;
     copy.metadata = self.metadata;
     copy.loggingData = self.loggingData;
     
     for (NSString * const customImageIdentifier in self.customImageDataBuilders) {
-        copy.customImageDataBuilders[customImageIdentifier] = [self.customImageDataBuilders[customImageIdentifier] copy];
+        HUBComponentImageDataBuilderImplementation * const customImageDataBuilder = [self.customImageDataBuilders[customImageIdentifier] copy];
+        customImageDataBuilder.delegate = copy;
+        copy.customImageDataBuilders[customImageIdentifier] = customImageDataBuilder;
     }
 
     for (NSString * const childIdentifier in self.childBuilders) {
         HUBComponentModelBuilderImplementation *childBuilder = [self.childBuilders[childIdentifier] copy];
+        childBuilder.delegate = copy;
         copy.childBuilders[childIdentifier] = childBuilder;
 
         if (childBuilder.groupIdentifier != nil) {
@@ -484,6 +623,11 @@ NS_ASSUME_NONNULL_BEGIN
 
     [copy.childIdentifierOrder addObjectsFromArray:self.childIdentifierOrder];
     
+    // Assigned last, since setting up the copy above reports changes to it
+    copy.childBuildersSnapshot = self.childBuildersSnapshot;
+    copy.contentRevision = self.contentRevision;
+    copy.delegate = self.delegate;
+    
     return copy;
 }
 
@@ -491,8 +635,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (id<HUBComponentModel>)buildForIndex:(NSUInteger)index parent:(nullable id<HUBComponentModel>)parent
 {
-    HUBIdentifier * const componentIdentifier = [[HUBIdentifier alloc] initWithNamespace:self.componentNamespace
-                                                                                    name:self.componentName];
+    HUBIdentifier * const componentIdentifier = [self buildComponentIdentifier];
     
     id<HUBComponentImageData> const mainImageData = [self.mainImageDataBuilderImplementation buildWithIdentifier:nil
                                                                                                             type:HUBComponentImageTypeMain];
@@ -500,16 +643,7 @@ NS_ASSUME_NONNULL_BEGIN
     id<HUBComponentImageData> const backgroundImageData = [self.backgroundImageDataBuilderImplementation buildWithIdentifier:nil
                                                                                                                         type:HUBComponentImageTypeBackground];
     
-    NSMutableDictionary * const customImageData = [NSMutableDictionary new];
-    
-    for (NSString * const imageIdentifier in self.customImageDataBuilders) {
-        HUBComponentImageDataBuilderImplementation * const builder = self.customImageDataBuilders[imageIdentifier];
-        id<HUBComponentImageData> const imageData = [builder buildWithIdentifier:imageIdentifier type:HUBComponentImageTypeCustom];
-        
-        if (imageData != nil) {
-            [customImageData setObject:imageData forKey:imageIdentifier];
-        }
-    }
+    NSDictionary<NSString *, id<HUBComponentImageData>> * const customImageData = [self buildCustomImageData];
     
     id<HUBIcon> const icon = [self buildIconForPlaceholder:NO];
     id<HUBComponentTarget> const target = [self.targetBuilderImplementation build];
@@ -534,15 +668,175 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                                      customData:self.customData
                                                                                                          parent:parent];
     
-    model.children = [HUBComponentModelBuilderImplementation buildComponentModelsUsingBuilders:self.childBuilders
-                                                                               identifierOrder:self.childIdentifierOrder
-                                                                                        parent:model];
+    if (self.childIdentifierOrder.count == 0) {
+        model.children = @[];
+        return model;
+    }
+    
+    // Children are built on first access, from a snapshot of the child builders, since this builder may keep being mutated
+    NSArray<HUBComponentModelBuilderImplementation *> * const childBuilders = [self getOrCreateChildBuildersSnapshot];
+    
+    [model setChildrenBuilder:^(id<HUBComponentModel> parentModel) {
+        NSMutableArray<id<HUBComponentModel>> * const children = [NSMutableArray arrayWithCapacity:childBuilders.count];
+        
+        for (HUBComponentModelBuilderImplementation * const childBuilder in childBuilders) {
+            [children addObject:[childBuilder buildForIndex:children.count parent:parentModel]];
+        }
+        
+        return [children copy];
+    } snapshot:childBuilders];
     
     return model;
 }
 
+#pragma mark - Property overrides
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+
+- (void)setPreferredIndex:(nullable NSNumber *)preferredIndex
+{
+    _preferredIndex = [preferredIndex copy];
+    [self builderDidChange];
+}
+
+- (void)setComponentNamespace:(NSString *)componentNamespace
+{
+    _componentNamespace = [componentNamespace copy];
+    [self builderDidChange];
+}
+
+- (void)setComponentName:(NSString *)componentName
+{
+    _componentName = [componentName copy];
+    [self builderDidChange];
+}
+
+- (void)setComponentCategory:(HUBComponentCategory)componentCategory
+{
+    _componentCategory = [componentCategory copy];
+    [self builderDidChange];
+}
+
+- (void)setTitle:(nullable NSString *)title
+{
+    _title = [title copy];
+    [self builderDidChange];
+}
+
+- (void)setSubtitle:(nullable NSString *)subtitle
+{
+    _subtitle = [subtitle copy];
+    [self builderDidChange];
+}
+
+- (void)setAccessoryTitle:(nullable NSString *)accessoryTitle
+{
+    _accessoryTitle = [accessoryTitle copy];
+    [self builderDidChange];
+}
+
+- (void)setDescriptionText:(nullable NSString *)descriptionText
+{
+    _descriptionText = [descriptionText copy];
+    [self builderDidChange];
+}
+
+- (void)setIconIdentifier:(nullable NSString *)iconIdentifier
+{
+    _iconIdentifier = [iconIdentifier copy];
+    [self builderDidChange];
+}
+
+- (void)setMetadata:(nullable NSDictionary<NSString *, id> *)metadata
+{
+    _metadata = metadata;
+    [self builderDidChange];
+}
+
+- (void)setLoggingData:(nullable NSDictionary<NSString *, id> *)loggingData
+{
+    _loggingData = loggingData;
+    [self builderDidChange];
+}
+
+- (void)setCustomData:(nullable NSDictionary<NSString *, id> *)customData
+{
+    _customData = customData;
+    [self builderDidChange];
+}
+
+#pragma clang diagnostic pop
+
 #pragma mark - Private utilities
 
+- (NSArray<HUBComponentModelBuilderImplementation *> *)getOrCreateChildBuildersSnapshot
+{
+    // Shared builders of windowed arrays may be building models on multiple threads
+    @synchronized (self) {
+        NSArray<HUBComponentModelBuilderImplementation *> * const existingSnapshot = self.childBuildersSnapshot;
+        
+        if (existingSnapshot != nil) {
+            return existingSnapshot;
+        }
+        
+        // The snapshot is immutable, so every model built until the next change to this builder or any of its descendants can share it
+        NSArray<HUBComponentModelBuilderImplementation *> * const sortedChildBuilders = [HUBComponentModelBuilderImplementation sortedBuildersFromBuilders:self.childBuilders
+                                                                                                                                          identifierOrder:self.childIdentifierOrder];
+        
+        NSArray<HUBComponentModelBuilderImplementation *> * const snapshot = [[NSArray alloc] initWithArray:sortedChildBuilders copyItems:YES];
+        self.childBuildersSnapshot = snapshot;
+        return snapshot;
+    }
+}
+
+- (void)builderDidChange
+{
+    @synchronized (self) {
+        self.childBuildersSnapshot = nil;
+        self.contentRevision = HUBComponentModelBuilderNextContentRevision();
+    }
+    
+    // Child builders can be changed through any reference to them, so the change needs to reach every ancestor
+    [self.delegate componentModelBuilderDidChange:self];
+}
+
+- (HUBIdentifier *)buildComponentIdentifier
+{
+    NSString * const componentNamespace = self.componentNamespace;
+    NSString * const componentName = self.componentName;
+    HUBIdentifier * const lastBuiltIdentifier = self.lastBuiltComponentIdentifier;
+    
+    // Identifiers are interned, so reusing the last one saves a throwaway allocation and a lock for every model
+    if ([lastBuiltIdentifier.namespacePart isEqualToString:componentNamespace] && [lastBuiltIdentifier.namePart isEqualToString:componentName]) {
+        return lastBuiltIdentifier;
+    }
+    
+    HUBIdentifier * const identifier = [[HUBIdentifier alloc] initWithNamespace:componentNamespace name:componentName];
+    self.lastBuiltComponentIdentifier = identifier;
+    return identifier;
+}
+
+- (NSDictionary<NSString *, id<HUBComponentImageData>> *)buildCustomImageData
+{
+    if (self.customImageDataBuilders.count == 0) {
+        return @{};
+    }
+    
+    NSMutableDictionary<NSString *, id<HUBComponentImageData>> * const customImageData = [NSMutableDictionary new];
+    
+    for (NSString * const imageIdentifier in self.customImageDataBuilders) {
+        HUBComponentImageDataBuilderImplementation * const builder = self.customImageDataBuilders[imageIdentifier];
+        id<HUBComponentImageData> const imageData = [builder buildWithIdentifier:imageIdentifier type:HUBComponentImageTypeCustom];
+        
+        if (imageData != nil) {
+            [customImageData setObject:imageData forKey:imageIdentifier];
+        }
+    }
+    
+    return [customImageData copy];
+}
+
 - (HUBComponentTargetBuilderImplementation *)getOrCreateTargetBuilder
 {
     if (self.targetBuilderImplementation == nil) {
@@ -550,6 +844,8 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                              componentDefaults:self.componentDefaults
                                                                                              iconImageResolver:self.iconImageResolver
                                                                                              actionIdentifiers:nil];
+        
+        self.targetBuilderImplementation.delegate = self;
     }
     
     HUBComponentTargetBuilderImplementation * const targetBuilder = self.targetBuilderImplementation;
@@ -567,7 +863,9 @@ NS_ASSUME_NONNULL_BEGIN
     HUBComponentImageDataBuilderImplementation * const newBuilder = [[HUBComponentImageDataBuilderImplementation alloc] initWithJSONSchema:self.JSONSchema
                                                                                                                          iconImageResolver:self.iconImageResolver];
     
+    newBuilder.delegate = self;
     [self.customImageDataBuilders setObject:newBuilder forKey:identifier];
+    [self builderDidChange];
     
     return newBuilder;
 }
@@ -585,6 +883,7 @@ NS_ASSUME_NONNULL_BEGIN
 #pragma clang diagnostic pop
 
     [self.delegate componentModelBuilder:self groupIdentifierDidChange:self.groupIdentifier oldGroupIdentifier:oldGroupIdentifier];
+    [self builderDidChange];
 }
 
 - (HUBComponentModelBuilderImplementation *)getOrCreateBuilderForChildWithIdentifier:(nullable NSString *)identifier
@@ -609,6 +908,7 @@ NS_ASSUME_NONNULL_BEGIN
     
     self.childBuilders[newBuilder.modelIdentifier] = newBuilder;
     [self.childIdentifierOrder addObject:newBuilder.modelIdentifier];
+    [self builderDidChange];
     
     return newBuilder;
 }
@@ -655,6 +955,25 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+- (void)componentModelBuilderDidChange:(id<HUBComponentModelBuilder>)componentModelBuilder
+{
+    [self builderDidChange];
+}
+
+#pragma mark - HUBComponentImageDataBuilderDelegate
+
+- (void)componentImageDataBuilderDidChange:(HUBComponentImageDataBuilderImplementation *)imageDataBuilder
+{
+    [self builderDidChange];
+}
+
+#pragma mark - HUBComponentTargetBuilderDelegate
+
+- (void)componentTargetBuilderDidChange:(HUBComponentTargetBuilderImplementation *)targetBuilder
+{
+    [self builderDidChange];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
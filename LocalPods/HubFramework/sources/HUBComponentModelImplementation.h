@@ -81,6 +81,22 @@ NS_ASSUME_NONNULL_BEGIN
 /// The component models that are children of this one
 @property (nonatomic, strong, nullable) NSArray<id<HUBComponentModel>> *children;
 
+/**
+ *  Set a block that builds the children of this model on demand
+ *
+ *  @param childrenBuilder The block to use to build the children. It's passed this model as the parent.
+ *  @param snapshot The immutable object that the block builds the children from
+ *
+ *  The block is called the first time the children are accessed, either directly or through any of the
+ *  child lookup APIs, and is then released. Building is synchronized, so the block is only ever called once.
+ *  Setting `children` directly discards any pending block.
+ *
+ *  Models that share the same snapshot are known to have equal children, so they can be compared without building
+ *  their children.
+ */
+- (void)setChildrenBuilder:(NSArray<id<HUBComponentModel>> *(^)(id<HUBComponentModel> parent))childrenBuilder
+                  snapshot:(id)snapshot;
+
 @end
 
 NS_ASSUME_NONNULL_END
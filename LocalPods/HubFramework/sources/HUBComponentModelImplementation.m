@@ -34,6 +34,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, strong, nullable) NSDictionary<NSString *, NSNumber *> *childIdentifierToIndexMap;
 @property (nonatomic, strong, nullable) NSDictionary<NSString *, NSArray<id<HUBComponentModel>> *> *childrenByGroupIdentifier;
+@property (nonatomic, copy, nullable) NSArray<id<HUBComponentModel>> *(^pendingChildrenBuilder)(id<HUBComponentModel> parent);
+@property (nonatomic, strong, nullable) id childrenSnapshot;
 
 @end
 
@@ -63,9 +65,16 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (nullable NSSet<NSString *> *)ignoredAutoEquatablePropertyNames
 {
+    // The child lookup maps are derived from `children`, and are only populated once the children have been built.
+    // Children are compared separately, so that they don't have to be built when they are known to be equal.
     return [NSSet setWithObjects:HUBKeyPath((id<HUBComponentModel>)nil, parent),
         HUBKeyPath((id<HUBComponentModel>)nil, index),
         HUBKeyPath((id<HUBComponentModel>)nil, indexPath),
+        HUBKeyPath((id<HUBComponentModel>)nil, children),
+        HUBKeyPath((HUBComponentModelImplementation *)nil, childIdentifierToIndexMap),
+        HUBKeyPath((HUBComponentModelImplementation *)nil, childrenByGroupIdentifier),
+        HUBKeyPath((HUBComponentModelImplementation *)nil, pendingChildrenBuilder),
+        HUBKeyPath((HUBComponentModelImplementation *)nil, childrenSnapshot),
         nil];
 }
 
@@ -125,37 +134,59 @@ NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - API
 
+- (nullable NSArray<id<HUBComponentModel>> *)children
+{
+    [self buildChildrenIfNeeded];
+    return _children;
+}
+
 - (void)setChildren:(nullable NSArray<id<HUBComponentModel>> *)children
 {
-    _children = children;
-    
-    NSMutableDictionary<NSString *, NSNumber *> * const identifierToIndexMap = [NSMutableDictionary new];
-    NSMutableDictionary<NSString *, NSMutableArray<id<HUBComponentModel>> *> *childrenByGroupIdentifier = [NSMutableDictionary new];
+    @synchronized (self) {
+        self.pendingChildrenBuilder = nil;
+        self.childrenSnapshot = nil;
+        [self updateChildren:children];
+    }
+}
+
+- (void)setChildrenBuilder:(NSArray<id<HUBComponentModel>> *(^)(id<HUBComponentModel> parent))childrenBuilder
+                  snapshot:(id)snapshot
+{
+    NSParameterAssert(childrenBuilder != nil);
+    NSParameterAssert(snapshot != nil);
     
-    for (id<HUBComponentModel> const child in children) {
-        identifierToIndexMap[child.identifier] = @(child.index);
+    @synchronized (self) {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+        _children = nil;
+#pragma clang diagnostic pop
         
-        if (child.groupIdentifier != nil) {
-            NSString * const groupIdentifier = child.groupIdentifier;
-            NSMutableArray<id<HUBComponentModel>> * const childrenInGroup = childrenByGroupIdentifier[groupIdentifier];
-            
-            if (childrenInGroup != nil) {
-                [childrenInGroup addObject:child];
-            } else {
-                childrenByGroupIdentifier[groupIdentifier] = [NSMutableArray arrayWithObject:child];
-            }
-        }
+        self.pendingChildrenBuilder = childrenBuilder;
+        self.childrenSnapshot = snapshot;
+        self.childIdentifierToIndexMap = nil;
+        self.childrenByGroupIdentifier = nil;
+    }
+}
+
+#pragma mark - NSObject
+
+- (BOOL)isEqual:(id)object
+{
+    if (![super isEqual:object]) {
+        return NO;
     }
     
-    self.childIdentifierToIndexMap = [identifierToIndexMap copy];
+    HUBComponentModelImplementation * const componentModel = object;
+    id const childrenSnapshot = self.childrenSnapshot;
     
-    if (childrenByGroupIdentifier.count > 0) {
-        self.childrenByGroupIdentifier = [childrenByGroupIdentifier copy];
+    // The children built from the same snapshot are equal, whether or not they have been built yet
+    if (childrenSnapshot != nil && childrenSnapshot == componentModel.childrenSnapshot) {
+        return YES;
     }
+    
+    return HUBPropertyIsEqual(self, componentModel, HUBKeyPath((id<HUBComponentModel>)nil, children));
 }
 
-#pragma mark - NSObject
-
 - (nullable id)valueForKey:(NSString *)key
 {
     // For some reason KVC won't work with this property name, so this workaround is required
@@ -222,6 +253,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable id<HUBComponentModel>)childWithIdentifier:(NSString *)identifier
 {
+    [self buildChildrenIfNeeded];
+    
     NSNumber * const index = self.childIdentifierToIndexMap[identifier];
     
     if (index == nil) {
@@ -233,11 +266,67 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (nullable NSArray<id<HUBComponentModel>> *)childrenInGroupWithIdentifier:(NSString *)groupIdentifier
 {
+    [self buildChildrenIfNeeded];
+    
     return self.childrenByGroupIdentifier[groupIdentifier];
 }
 
 #pragma mark - Private utilities
 
+- (void)buildChildrenIfNeeded
+{
+    // Models may be accessed from multiple threads, which must not build the same children twice
+    @synchronized (self) {
+        NSArray<id<HUBComponentModel>> *(^ const childrenBuilder)(id<HUBComponentModel>) = self.pendingChildrenBuilder;
+        
+        if (childrenBuilder == nil) {
+            return;
+        }
+        
+        self.pendingChildrenBuilder = nil;
+        [self updateChildren:childrenBuilder(self)];
+    }
+}
+
+- (void)updateChildren:(nullable NSArray<id<HUBComponentModel>> *)children
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _children = children;
+#pragma clang diagnostic pop
+    
+    // Most models are leaves, so avoid allocating empty lookup maps for each one of them
+    if (children.count == 0) {
+        self.childIdentifierToIndexMap = nil;
+        self.childrenByGroupIdentifier = nil;
+        return;
+    }
+    
+    NSMutableDictionary<NSString *, NSNumber *> * const identifierToIndexMap = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, NSMutableArray<id<HUBComponentModel>> *> *childrenByGroupIdentifier = [NSMutableDictionary new];
+    
+    for (id<HUBComponentModel> const child in children) {
+        identifierToIndexMap[child.identifier] = @(child.index);
+        
+        if (child.groupIdentifier != nil) {
+            NSString * const groupIdentifier = child.groupIdentifier;
+            NSMutableArray<id<HUBComponentModel>> * const childrenInGroup = childrenByGroupIdentifier[groupIdentifier];
+            
+            if (childrenInGroup != nil) {
+                [childrenInGroup addObject:child];
+            } else {
+                childrenByGroupIdentifier[groupIdentifier] = [NSMutableArray arrayWithObject:child];
+            }
+        }
+    }
+    
+    self.childIdentifierToIndexMap = [identifierToIndexMap copy];
+    
+    if (childrenByGroupIdentifier.count > 0) {
+        self.childrenByGroupIdentifier = [childrenByGroupIdentifier copy];
+    }
+}
+
 - (NSDictionary<NSString *, NSObject<NSCoding> *> *)serializedComponentData
 {
     return @{
@@ -0,0 +1,64 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBComponentModelJSONSchema.h"
+
+@class HUBJSONExtractionPlan;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Indexes of the values extracted by a component model schema's extraction plan, one for each path of the schema
+typedef NS_ENUM(NSUInteger, HUBComponentModelJSONSchemaPathIndex) {
+    HUBComponentModelJSONSchemaPathIndexIdentifier,
+    HUBComponentModelJSONSchemaPathIndexGroupIdentifier,
+    HUBComponentModelJSONSchemaPathIndexComponentIdentifier,
+    HUBComponentModelJSONSchemaPathIndexComponentCategory,
+    HUBComponentModelJSONSchemaPathIndexTitle,
+    HUBComponentModelJSONSchemaPathIndexSubtitle,
+    HUBComponentModelJSONSchemaPathIndexAccessoryTitle,
+    HUBComponentModelJSONSchemaPathIndexDescriptionText,
+    HUBComponentModelJSONSchemaPathIndexMainImageDataDictionary,
+    HUBComponentModelJSONSchemaPathIndexBackgroundImageDataDictionary,
+    HUBComponentModelJSONSchemaPathIndexCustomImageDataDictionary,
+    HUBComponentModelJSONSchemaPathIndexIconIdentifier,
+    HUBComponentModelJSONSchemaPathIndexTargetDictionary,
+    HUBComponentModelJSONSchemaPathIndexMetadata,
+    HUBComponentModelJSONSchemaPathIndexLoggingData,
+    HUBComponentModelJSONSchemaPathIndexCustomData,
+    HUBComponentModelJSONSchemaPathIndexChildDictionaries
+};
+
+/// Concrete implementation of the `HUBComponentModelJSONSchema` API
+@interface HUBComponentModelJSONSchemaImplementation : NSObject <HUBComponentModelJSONSchema>
+
+/**
+ *  Return a plan for extracting the values of all paths of a component model schema in a single pass
+ *
+ *  @param schema The schema to return an extraction plan for
+ *
+ *  The values extracted by the returned plan are indexed by `HUBComponentModelJSONSchemaPathIndex`. Plans are
+ *  cached per schema instance, and only recompiled once any of the schema's paths have been replaced.
+ */
++ (HUBJSONExtractionPlan *)extractionPlanForSchema:(id<HUBComponentModelJSONSchema>)schema;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -22,8 +22,82 @@
 #import "HUBComponentModelJSONSchemaImplementation.h"
 
 #import "HUBMutableJSONPathImplementation.h"
+#import "HUBJSONExtractionPlan.h"
 #import "HUBJSONKeys.h"
 
+static NSUInteger const HUBComponentModelJSONSchemaPathCount = HUBComponentModelJSONSchemaPathIndexChildDictionaries + 1;
+
+static id<HUBJSONPath> HUBComponentModelJSONSchemaPathAtIndex(id<HUBComponentModelJSONSchema> schema, HUBComponentModelJSONSchemaPathIndex index) {
+    switch (index) {
+        case HUBComponentModelJSONSchemaPathIndexIdentifier:
+            return schema.identifierPath;
+        case HUBComponentModelJSONSchemaPathIndexGroupIdentifier:
+            return schema.groupIdentifierPath;
+        case HUBComponentModelJSONSchemaPathIndexComponentIdentifier:
+            return schema.componentIdentifierPath;
+        case HUBComponentModelJSONSchemaPathIndexComponentCategory:
+            return schema.componentCategoryPath;
+        case HUBComponentModelJSONSchemaPathIndexTitle:
+            return schema.titlePath;
+        case HUBComponentModelJSONSchemaPathIndexSubtitle:
+            return schema.subtitlePath;
+        case HUBComponentModelJSONSchemaPathIndexAccessoryTitle:
+            return schema.accessoryTitlePath;
+        case HUBComponentModelJSONSchemaPathIndexDescriptionText:
+            return schema.descriptionTextPath;
+        case HUBComponentModelJSONSchemaPathIndexMainImageDataDictionary:
+            return schema.mainImageDataDictionaryPath;
+        case HUBComponentModelJSONSchemaPathIndexBackgroundImageDataDictionary:
+            return schema.backgroundImageDataDictionaryPath;
+        case HUBComponentModelJSONSchemaPathIndexCustomImageDataDictionary:
+            return schema.customImageDataDictionaryPath;
+        case HUBComponentModelJSONSchemaPathIndexIconIdentifier:
+            return schema.iconIdentifierPath;
+        case HUBComponentModelJSONSchemaPathIndexTargetDictionary:
+            return schema.targetDictionaryPath;
+        case HUBComponentModelJSONSchemaPathIndexMetadata:
+            return schema.metadataPath;
+        case HUBComponentModelJSONSchemaPathIndexLoggingData:
+            return schema.loggingDataPath;
+        case HUBComponentModelJSONSchemaPathIndexCustomData:
+            return schema.customDataPath;
+        case HUBComponentModelJSONSchemaPathIndexChildDictionaries:
+            return schema.childDictionariesPath;
+    }
+}
+
+static HUBJSONExtractionPlan *HUBComponentModelJSONSchemaCompileExtractionPlan(id<HUBComponentModelJSONSchema> schema) {
+    NSMutableArray<id<HUBJSONPath>> * const paths = [NSMutableArray arrayWithCapacity:HUBComponentModelJSONSchemaPathCount];
+    
+    for (NSUInteger index = 0; index < HUBComponentModelJSONSchemaPathCount; index++) {
+        [paths addObject:HUBComponentModelJSONSchemaPathAtIndex(schema, (HUBComponentModelJSONSchemaPathIndex)index)];
+    }
+    
+    return [[HUBJSONExtractionPlan alloc] initWithPaths:paths];
+}
+
+static BOOL HUBComponentModelJSONSchemaMatchesExtractionPlan(id<HUBComponentModelJSONSchema> schema, HUBJSONExtractionPlan * _Nullable plan) {
+    NSArray<id<HUBJSONPath>> * const planPaths = plan.paths;
+    
+    if (planPaths.count != HUBComponentModelJSONSchemaPathCount) {
+        return NO;
+    }
+    
+    for (NSUInteger index = 0; index < HUBComponentModelJSONSchemaPathCount; index++) {
+        if (planPaths[index] != HUBComponentModelJSONSchemaPathAtIndex(schema, (HUBComponentModelJSONSchemaPathIndex)index)) {
+            return NO;
+        }
+    }
+    
+    return YES;
+}
+
+@interface HUBComponentModelJSONSchemaImplementation ()
+
+@property (atomic, strong, nullable) HUBJSONExtractionPlan *extractionPlan;
+
+@end
+
 @implementation HUBComponentModelJSONSchemaImplementation
 
 @synthesize identifierPath = _identifierPath;
@@ -113,6 +187,44 @@
     return self;
 }
 
+#pragma mark - API
+
++ (HUBJSONExtractionPlan *)extractionPlanForSchema:(id<HUBComponentModelJSONSchema>)schema
+{
+    // Paths can be replaced at any time, so a cached plan is only used if it was compiled from the current ones
+    if ([schema isKindOfClass:[HUBComponentModelJSONSchemaImplementation class]]) {
+        HUBComponentModelJSONSchemaImplementation * const schemaImplementation = (HUBComponentModelJSONSchemaImplementation *)schema;
+        HUBJSONExtractionPlan * const cachedPlan = schemaImplementation.extractionPlan;
+        
+        if (HUBComponentModelJSONSchemaMatchesExtractionPlan(schema, cachedPlan)) {
+            return (HUBJSONExtractionPlan *)cachedPlan;
+        }
+        
+        HUBJSONExtractionPlan * const plan = HUBComponentModelJSONSchemaCompileExtractionPlan(schema);
+        schemaImplementation.extractionPlan = plan;
+        return plan;
+    }
+    
+    static NSMapTable<id<HUBComponentModelJSONSchema>, HUBJSONExtractionPlan *> *extractionPlansByCustomSchema;
+    static dispatch_once_t onceToken;
+    
+    dispatch_once(&onceToken, ^{
+        extractionPlansByCustomSchema = [NSMapTable weakToStrongObjectsMapTable];
+    });
+    
+    @synchronized (extractionPlansByCustomSchema) {
+        HUBJSONExtractionPlan * const cachedPlan = [extractionPlansByCustomSchema objectForKey:schema];
+        
+        if (HUBComponentModelJSONSchemaMatchesExtractionPlan(schema, cachedPlan)) {
+            return (HUBJSONExtractionPlan *)cachedPlan;
+        }
+        
+        HUBJSONExtractionPlan * const plan = HUBComponentModelJSONSchemaCompileExtractionPlan(schema);
+        [extractionPlansByCustomSchema setObject:plan forKey:schema];
+        return plan;
+    }
+}
+
 #pragma mark - HUBComponentModelJSONSchema
 
 - (id)copy
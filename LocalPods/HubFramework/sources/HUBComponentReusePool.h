@@ -25,7 +25,7 @@
 @protocol HUBComponentWrapperDelegate;
 @protocol HUBComponentRegistry;
 @class HUBComponentWrapper;
-@class HUBComponentUIStateManager;
+@class HUBComponentUIStateCacheImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -33,11 +33,13 @@ NS_ASSUME_NONNULL_BEGIN
 @interface HUBComponentReusePool : NSObject
 
 /**
- *  Initialize an instance of this class with a component registry and a UI state manager
+ *  Initialize an instance of this class with a component registry and a UI state cache
  *
  *  @param componentRegistry The component registry to use to create new component instances
+ *  @param UIStateCache The cache that determines how the UI states of the pool's components are kept
  */
-- (instancetype)initWithComponentRegistry:(id<HUBComponentRegistry>)componentRegistry HUB_DESIGNATED_INITIALIZER;
+- (instancetype)initWithComponentRegistry:(id<HUBComponentRegistry>)componentRegistry
+                             UIStateCache:(HUBComponentUIStateCacheImplementation *)UIStateCache HUB_DESIGNATED_INITIALIZER;
 
 /**
  *  Add a component wrapper to the reuse pool, enabling it to be used for other models
@@ -59,6 +61,13 @@ NS_ASSUME_NONNULL_BEGIN
                                          delegate:(id<HUBComponentWrapperDelegate>)delegate
                                            parent:(nullable HUBComponentWrapper *)parent;
 
+/**
+ *  Discard all UI states that have been saved by the components managed by this pool
+ *
+ *  Should be called when the system is low on memory.
+ */
+- (void)purgeSavedUIStates;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -41,14 +41,16 @@ NS_ASSUME_NONNULL_BEGIN
 @implementation HUBComponentReusePool
 
 - (instancetype)initWithComponentRegistry:(id<HUBComponentRegistry>)componentRegistry
+                             UIStateCache:(HUBComponentUIStateCacheImplementation *)UIStateCache
 {
     NSParameterAssert(componentRegistry != nil);
+    NSParameterAssert(UIStateCache != nil);
     
     self = [super init];
     
     if (self) {
         _componentRegistry = componentRegistry;
-        _UIStateManager = [HUBComponentUIStateManager new];
+        _UIStateManager = [[HUBComponentUIStateManager alloc] initWithCache:UIStateCache];
         _componentWrappers = [NSMutableDictionary new];
     }
     
@@ -91,6 +93,11 @@ NS_ASSUME_NONNULL_BEGIN
                                                    parent:parent];
 }
 
+- (void)purgeSavedUIStates
+{
+    [self.UIStateManager purgeAllStates];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
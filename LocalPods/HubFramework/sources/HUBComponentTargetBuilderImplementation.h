@@ -26,12 +26,31 @@
 @protocol HUBIconImageResolver;
 @protocol HUBComponentTarget;
 @class HUBComponentDefaults;
+@class HUBComponentTargetBuilderImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Delegate protocol for `HUBComponentTargetBuilderImplementation`
+@protocol HUBComponentTargetBuilderDelegate <NSObject>
+
+/**
+ *  Sent to the delegate of a target builder whenever it has been changed, or may be about to be changed
+ *
+ *  @param targetBuilder The builder that was changed
+ *
+ *  Since the action identifiers and the initial view model builder are mutable objects that can't be observed,
+ *  handing out any of them is treated as a change.
+ */
+- (void)componentTargetBuilderDidChange:(HUBComponentTargetBuilderImplementation *)targetBuilder;
+
+@end
+
 /// Concrete implementation of the `HUBComponentTargetBuilder` API
 @interface HUBComponentTargetBuilderImplementation : NSObject <HUBComponentTargetBuilder, NSCopying>
 
+/// The builder's delegate. Copies of the builder don't share it.
+@property (nonatomic, weak, nullable) id<HUBComponentTargetBuilderDelegate> delegate;
+
 /**
  *  Initialize an instance of this class with its required dependencies
  *
@@ -36,13 +36,13 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) HUBComponentDefaults *componentDefaults;
 @property (nonatomic, strong, nullable, readonly) id<HUBIconImageResolver> iconImageResolver;
 @property (nonatomic, strong, nullable) HUBViewModelBuilderImplementation *initialViewModelBuilderImplementation;
+@property (nonatomic, strong, readonly) NSMutableOrderedSet<HUBIdentifier *> *mutableActionIdentifiers;
 
 @end
 
 @implementation HUBComponentTargetBuilderImplementation
 
 @synthesize URI = _URI;
-@synthesize actionIdentifiers = _actionIdentifiers;
 @synthesize customData = _customData;
 
 #pragma mark - Initializer
@@ -61,7 +61,7 @@ NS_ASSUME_NONNULL_BEGIN
         _JSONSchema = JSONSchema;
         _componentDefaults = componentDefaults;
         _iconImageResolver = iconImageResolver;
-        _actionIdentifiers = (NSMutableOrderedSet *)([actionIdentifiers mutableCopy] ?: [NSMutableOrderedSet new]);
+        _mutableActionIdentifiers = (NSMutableOrderedSet *)([actionIdentifiers mutableCopy] ?: [NSMutableOrderedSet new]);
     }
     
     return self;
@@ -72,7 +72,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (id<HUBComponentTarget>)build
 {
     id<HUBViewModel> const initialViewModel = [self.initialViewModelBuilderImplementation build];
-    NSArray<HUBIdentifier *> * const actionIdentifiers = self.actionIdentifiers.count > 0 ? self.actionIdentifiers.array : nil;
+    NSArray<HUBIdentifier *> * const actionIdentifiers = self.mutableActionIdentifiers.count > 0 ? self.mutableActionIdentifiers.array : nil;
     
     return [[HUBComponentTargetImplementation alloc] initWithURI:self.URI
                                                 initialViewModel:initialViewModel
@@ -84,13 +84,41 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (id<HUBViewModelBuilder>)initialViewModelBuilder
 {
+    [self.delegate componentTargetBuilderDidChange:self];
     return [self getOrCreateInitialViewModelBuilder];
 }
 
+- (NSMutableOrderedSet<HUBIdentifier *> *)actionIdentifiers
+{
+    [self.delegate componentTargetBuilderDidChange:self];
+    return self.mutableActionIdentifiers;
+}
+
+- (void)setURI:(nullable NSURL *)URI
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _URI = [URI copy];
+#pragma clang diagnostic pop
+    
+    [self.delegate componentTargetBuilderDidChange:self];
+}
+
+- (void)setCustomData:(nullable NSDictionary<NSString *, id> *)customData
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _customData = [customData copy];
+#pragma clang diagnostic pop
+    
+    [self.delegate componentTargetBuilderDidChange:self];
+}
+
 - (void)addActionWithNamespace:(NSString *)actionNamespace name:(NSString *)actionName
 {
     HUBIdentifier * const identifier = [[HUBIdentifier alloc] initWithNamespace:actionNamespace name:actionName];
-    [self.actionIdentifiers addObject:identifier];
+    [self.mutableActionIdentifiers addObject:identifier];
+    [self.delegate componentTargetBuilderDidChange:self];
 }
 
 #pragma mark - HUBJSONCompatibleBuilder
@@ -114,6 +142,7 @@ NS_ASSUME_NONNULL_BEGIN
     
     if (initialViewModelDictionary != nil) {
         [[self getOrCreateInitialViewModelBuilder] addJSONDictionary:initialViewModelDictionary];
+        [self.delegate componentTargetBuilderDidChange:self];
     }
     
     NSArray<NSString *> * const actionIdentifierStrings = [schema.actionIdentifiersPath valuesFromJSONDictionary:dictionary];
@@ -122,7 +151,8 @@ NS_ASSUME_NONNULL_BEGIN
         HUBIdentifier * const actionIdentifier = [[HUBIdentifier alloc] initWithString:actionIdentifierString];
         
         if (actionIdentifier != nil) {
-            [self.actionIdentifiers addObject:actionIdentifier];
+            [self.mutableActionIdentifiers addObject:actionIdentifier];
+            [self.delegate componentTargetBuilderDidChange:self];
         }
     }
     
@@ -140,7 +170,7 @@ NS_ASSUME_NONNULL_BEGIN
     HUBComponentTargetBuilderImplementation * const copy = [[HUBComponentTargetBuilderImplementation alloc] initWithJSONSchema:self.JSONSchema
                                                                                                              componentDefaults:self.componentDefaults
                                                                                                              iconImageResolver:self.iconImageResolver
-                                                                                                             actionIdentifiers:self.actionIdentifiers];
+                                                                                                             actionIdentifiers:self.mutableActionIdentifiers];
     
     copy.URI = self.URI;
     copy.initialViewModelBuilderImplementation = [self.initialViewModelBuilderImplementation copy];
@@ -0,0 +1,48 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBComponentUIStateCache.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The default maximum number of UI states that each view controller keeps in memory
+static NSUInteger const HUBComponentUIStateCacheDefaultCountLimit = 500;
+
+/**
+ *  Concrete implementation of the `HUBComponentUIStateCache` API
+ *
+ *  Holds the settings that all `HUBComponentUIStateManager` instances of a `HUBManager` share, and the counters that
+ *  they report their evictions, spills and purges to.
+ */
+@interface HUBComponentUIStateCacheImplementation : NSObject <HUBComponentUIStateCache>
+
+/// Record that a number of states were evicted
+- (void)recordEvictionCount:(NSUInteger)count;
+
+/// Record that a number of evicted states were spilled
+- (void)recordSpillCount:(NSUInteger)count;
+
+/// Record that a number of states were purged
+- (void)recordPurgeCount:(NSUInteger)count;
+
+@end
+
+NS_ASSUME_NONNULL_END
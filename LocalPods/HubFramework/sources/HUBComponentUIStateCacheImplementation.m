@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBComponentUIStateCacheImplementation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBComponentUIStateCacheImplementation ()
+
+@property (nonatomic, assign, readwrite) NSUInteger evictionCount;
+@property (nonatomic, assign, readwrite) NSUInteger spillCount;
+@property (nonatomic, assign, readwrite) NSUInteger purgeCount;
+
+@end
+
+@implementation HUBComponentUIStateCacheImplementation
+
+@synthesize countLimit = _countLimit;
+@synthesize totalCostLimit = _totalCostLimit;
+@synthesize spillsEvictedStates = _spillsEvictedStates;
+@synthesize spilledStatesByteLimit = _spilledStatesByteLimit;
+@synthesize evictionCount = _evictionCount;
+@synthesize spillCount = _spillCount;
+@synthesize purgeCount = _purgeCount;
+
+#pragma mark - Initializer
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _countLimit = HUBComponentUIStateCacheDefaultCountLimit;
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (void)recordEvictionCount:(NSUInteger)count
+{
+    self.evictionCount += count;
+}
+
+- (void)recordSpillCount:(NSUInteger)count
+{
+    self.spillCount += count;
+}
+
+- (void)recordPurgeCount:(NSUInteger)count
+{
+    self.purgeCount += count;
+}
+
+#pragma mark - HUBComponentUIStateCache
+
+- (void)resetCounters
+{
+    self.evictionCount = 0;
+    self.spillCount = 0;
+    self.purgeCount = 0;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -19,22 +19,38 @@
  *  under the License.
  */
 
-#import <Foundation/Foundation.h>
+#import "HUBHeaderMacros.h"
 
 @protocol HUBComponentModel;
+@class HUBComponentUIStateCacheImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
-/// Class that manages UI state for a component that has restorable UI state
+/**
+ *  Class that manages UI state for a component that has restorable UI state
+ *
+ *  Saved states are kept in a least-recently-used order, and the least recently saved or restored states
+ *  are evicted once either of the limits of the cache that the manager was created with is exceeded. Evicted
+ *  states that conform to `NSCoding` may optionally be spilled into a compact archived form, from which they
+ *  can still be restored. See `HUBComponentUIStateCache` for more info.
+ */
 @interface HUBComponentUIStateManager : NSObject
 
 /**
- *  Save a UI state for a component, for a certain model
+ *  Initialize an instance of this class with the cache that it should use
+ *
+ *  @param cache The cache to read limits from, and to report evictions, spills and purges to
+ */
+- (instancetype)initWithCache:(HUBComponentUIStateCacheImplementation *)cache HUB_DESIGNATED_INITIALIZER;
+
+/**
+ *  Save a UI state for a component, for a certain model, with a given cost
  *
  *  @param state The UI state to save
  *  @param componentModel The component model to associate the state with
+ *  @param cost The cost of the state, which counts towards the `totalCostLimit` of the cache
  */
-- (void)saveUIState:(id)state forComponentModel:(id<HUBComponentModel>)componentModel;
+- (void)saveUIState:(id)state forComponentModel:(id<HUBComponentModel>)componentModel cost:(NSUInteger)cost;
 
 /**
  *  Restore a previously saved UI state for a component, for a certain model
@@ -50,6 +66,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)removeSavedUIStateForComponentModel:(id<HUBComponentModel>)componentModel;
 
+/**
+ *  Discard all saved UI states, including any spilled ones
+ *
+ *  Should be called when the system is low on memory.
+ */
+- (void)purgeAllStates;
+
 @end
 
 NS_ASSUME_NONNULL_END
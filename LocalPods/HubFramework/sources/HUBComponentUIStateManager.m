@@ -0,0 +1,304 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBComponentUIStateManager.h"
+
+#import "HUBComponentModel.h"
+#import "HUBComponentUIStateCacheImplementation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A saved UI state, linked into the least-recently-used list while it is kept in memory
+@interface HUBComponentUIStateEntry : NSObject
+
+@property (nonatomic, copy, readonly) NSString *modelIdentifier;
+@property (nonatomic, strong) id state;
+@property (nonatomic, assign) NSUInteger cost;
+@property (nonatomic, weak, nullable) HUBComponentUIStateEntry *previousEntry;
+@property (nonatomic, strong, nullable) HUBComponentUIStateEntry *nextEntry;
+
+@end
+
+@implementation HUBComponentUIStateEntry
+
+- (instancetype)initWithModelIdentifier:(NSString *)modelIdentifier state:(id)state cost:(NSUInteger)cost
+{
+    self = [super init];
+    
+    if (self) {
+        _modelIdentifier = [modelIdentifier copy];
+        _state = state;
+        _cost = cost;
+    }
+    
+    return self;
+}
+
+@end
+
+@interface HUBComponentUIStateManager ()
+
+@property (nonatomic, strong, readonly) HUBComponentUIStateCacheImplementation *cache;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, HUBComponentUIStateEntry *> *entriesForComponentModelIdentifiers;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, HUBComponentUIStateEntry *> *spilledEntriesForComponentModelIdentifiers;
+@property (nonatomic, strong, readonly) NSMutableOrderedSet<NSString *> *spilledStateIdentifierOrder;
+@property (nonatomic, strong, nullable) HUBComponentUIStateEntry *mostRecentlyUsedEntry;
+@property (nonatomic, weak, nullable) HUBComponentUIStateEntry *leastRecentlyUsedEntry;
+@property (nonatomic, assign) NSUInteger totalCost;
+@property (nonatomic, assign) NSUInteger totalSpilledBytes;
+
+@end
+
+@implementation HUBComponentUIStateManager
+
+#pragma mark - Initializer
+
+- (instancetype)initWithCache:(HUBComponentUIStateCacheImplementation *)cache
+{
+    NSParameterAssert(cache != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _cache = cache;
+        _entriesForComponentModelIdentifiers = [NSMutableDictionary new];
+        _spilledEntriesForComponentModelIdentifiers = [NSMutableDictionary new];
+        _spilledStateIdentifierOrder = [NSMutableOrderedSet new];
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (void)saveUIState:(id)state forComponentModel:(id<HUBComponentModel>)componentModel cost:(NSUInteger)cost
+{
+    NSString * const modelIdentifier = componentModel.identifier;
+    [self removeSpilledStateForModelIdentifier:modelIdentifier];
+    
+    HUBComponentUIStateEntry *entry = self.entriesForComponentModelIdentifiers[modelIdentifier];
+    
+    if (entry != nil) {
+        self.totalCost -= entry.cost;
+        entry.state = state;
+        entry.cost = cost;
+        [self unlinkEntry:entry];
+    } else {
+        entry = [[HUBComponentUIStateEntry alloc] initWithModelIdentifier:modelIdentifier state:state cost:cost];
+        self.entriesForComponentModelIdentifiers[modelIdentifier] = entry;
+    }
+    
+    self.totalCost += cost;
+    [self linkEntryAsMostRecentlyUsed:entry];
+    [self evictEntriesIfNeeded];
+}
+
+- (nullable id)restoreUIStateForComponentModel:(id<HUBComponentModel>)componentModel
+{
+    NSString * const modelIdentifier = componentModel.identifier;
+    HUBComponentUIStateEntry * const entry = self.entriesForComponentModelIdentifiers[modelIdentifier];
+    
+    if (entry != nil) {
+        [self unlinkEntry:entry];
+        [self linkEntryAsMostRecentlyUsed:entry];
+        return entry.state;
+    }
+    
+    HUBComponentUIStateEntry * const spilledEntry = self.spilledEntriesForComponentModelIdentifiers[modelIdentifier];
+    
+    if (spilledEntry == nil) {
+        return nil;
+    }
+    
+    id state = nil;
+    
+    @try {
+        state = [NSKeyedUnarchiver unarchiveObjectWithData:spilledEntry.state];
+    } @catch (NSException *exception) {
+        state = nil;
+    }
+    
+    if (state == nil) {
+        [self removeSpilledStateForModelIdentifier:modelIdentifier];
+        return nil;
+    }
+    
+    [self saveUIState:state forComponentModel:componentModel cost:spilledEntry.cost];
+    return state;
+}
+
+- (void)removeSavedUIStateForComponentModel:(id<HUBComponentModel>)componentModel
+{
+    NSString * const modelIdentifier = componentModel.identifier;
+    HUBComponentUIStateEntry * const entry = self.entriesForComponentModelIdentifiers[modelIdentifier];
+    
+    if (entry != nil) {
+        [self removeEntry:entry];
+    }
+    
+    [self removeSpilledStateForModelIdentifier:modelIdentifier];
+}
+
+- (void)purgeAllStates
+{
+    [self.cache recordPurgeCount:self.entriesForComponentModelIdentifiers.count + self.spilledEntriesForComponentModelIdentifiers.count];
+    
+    [self.entriesForComponentModelIdentifiers removeAllObjects];
+    [self.spilledEntriesForComponentModelIdentifiers removeAllObjects];
+    [self.spilledStateIdentifierOrder removeAllObjects];
+    self.mostRecentlyUsedEntry = nil;
+    self.leastRecentlyUsedEntry = nil;
+    self.totalCost = 0;
+    self.totalSpilledBytes = 0;
+}
+
+#pragma mark - Private utilities
+
+- (void)linkEntryAsMostRecentlyUsed:(HUBComponentUIStateEntry *)entry
+{
+    HUBComponentUIStateEntry * const previousMostRecentlyUsedEntry = self.mostRecentlyUsedEntry;
+    
+    entry.previousEntry = nil;
+    entry.nextEntry = previousMostRecentlyUsedEntry;
+    previousMostRecentlyUsedEntry.previousEntry = entry;
+    self.mostRecentlyUsedEntry = entry;
+    
+    if (self.leastRecentlyUsedEntry == nil) {
+        self.leastRecentlyUsedEntry = entry;
+    }
+}
+
+- (void)unlinkEntry:(HUBComponentUIStateEntry *)entry
+{
+    HUBComponentUIStateEntry * const previousEntry = entry.previousEntry;
+    HUBComponentUIStateEntry * const nextEntry = entry.nextEntry;
+    
+    if (previousEntry != nil) {
+        previousEntry.nextEntry = nextEntry;
+    } else {
+        self.mostRecentlyUsedEntry = nextEntry;
+    }
+    
+    if (nextEntry != nil) {
+        nextEntry.previousEntry = previousEntry;
+    } else {
+        self.leastRecentlyUsedEntry = previousEntry;
+    }
+    
+    entry.previousEntry = nil;
+    entry.nextEntry = nil;
+}
+
+- (void)removeEntry:(HUBComponentUIStateEntry *)entry
+{
+    [self unlinkEntry:entry];
+    self.totalCost -= entry.cost;
+    self.entriesForComponentModelIdentifiers[entry.modelIdentifier] = nil;
+}
+
+- (BOOL)isOverLimit
+{
+    NSUInteger const countLimit = self.cache.countLimit;
+    
+    if (countLimit > 0 && self.entriesForComponentModelIdentifiers.count > countLimit) {
+        return YES;
+    }
+    
+    NSUInteger const totalCostLimit = self.cache.totalCostLimit;
+    return totalCostLimit > 0 && self.totalCost > totalCostLimit;
+}
+
+- (void)evictEntriesIfNeeded
+{
+    while ([self isOverLimit]) {
+        HUBComponentUIStateEntry * const entry = self.leastRecentlyUsedEntry;
+        
+        if (entry == nil) {
+            return;
+        }
+        
+        [self removeEntry:entry];
+        [self.cache recordEvictionCount:1];
+        
+        if (self.cache.spillsEvictedStates) {
+            [self spillEntry:entry];
+        }
+    }
+}
+
+- (void)spillEntry:(HUBComponentUIStateEntry *)entry
+{
+    if (![entry.state conformsToProtocol:@protocol(NSCoding)]) {
+        return;
+    }
+    
+    NSData *archivedState = nil;
+    
+    @try {
+        archivedState = [NSKeyedArchiver archivedDataWithRootObject:entry.state];
+    } @catch (NSException *exception) {
+        return;
+    }
+    
+    NSString * const modelIdentifier = entry.modelIdentifier;
+    NSUInteger const byteLimit = self.cache.spilledStatesByteLimit;
+    
+    if (byteLimit > 0 && archivedState.length > byteLimit) {
+        return;
+    }
+    
+    [self removeSpilledStateForModelIdentifier:modelIdentifier];
+    
+    while (byteLimit > 0 && self.totalSpilledBytes + archivedState.length > byteLimit) {
+        NSString * const oldestIdentifier = self.spilledStateIdentifierOrder.firstObject;
+        
+        if (oldestIdentifier == nil) {
+            break;
+        }
+        
+        [self removeSpilledStateForModelIdentifier:oldestIdentifier];
+    }
+    
+    // The cost is kept, so that it can be applied again if the state is restored
+    self.spilledEntriesForComponentModelIdentifiers[modelIdentifier] = [[HUBComponentUIStateEntry alloc] initWithModelIdentifier:modelIdentifier
+                                                                                                                           state:archivedState
+                                                                                                                            cost:entry.cost];
+    [self.spilledStateIdentifierOrder addObject:modelIdentifier];
+    self.totalSpilledBytes += archivedState.length;
+    [self.cache recordSpillCount:1];
+}
+
+- (void)removeSpilledStateForModelIdentifier:(NSString *)modelIdentifier
+{
+    HUBComponentUIStateEntry * const spilledEntry = self.spilledEntriesForComponentModelIdentifiers[modelIdentifier];
+    
+    if (spilledEntry == nil) {
+        return;
+    }
+    
+    self.totalSpilledBytes -= ((NSData *)spilledEntry.state).length;
+    self.spilledEntriesForComponentModelIdentifiers[modelIdentifier] = nil;
+    [self.spilledStateIdentifierOrder removeObject:modelIdentifier];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
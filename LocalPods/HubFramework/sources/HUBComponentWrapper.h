@@ -26,6 +26,7 @@
 #import "HUBComponentWithRestorableUIState.h"
 #import "HUBComponentWithSelectionState.h"
 #import "HUBComponentWithScrolling.h"
+#import "HUBComponentWithRecyclableChildren.h"
 #import "HUBHeaderMacros.h"
 
 @protocol HUBComponent;
@@ -158,12 +159,18 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState;
 /// Whether the wrapped component is capable of handling images
 @property (nonatomic, readonly) BOOL handlesImages;
 
+/// Whether the wrapped component is capable of displaying child components
+@property (nonatomic, readonly) BOOL handlesChildren;
+
 /// Whether the wrapped component is observing the container view's content offset
 @property (nonatomic, readonly) BOOL isContentOffsetObserver;
 
 /// Whether the wrapped component is observing actions
 @property (nonatomic, readonly) BOOL isActionObserver;
 
+/// The namespaces of the custom actions that the wrapped component is observing, or nil if it's observing all of them
+@property (nonatomic, copy, readonly, nullable) NSSet<NSString *> *observedCustomActionNamespaces;
+
 /// Whether the wrapped component's view has appeared since the model was last changed
 @property (nonatomic, readonly) BOOL viewHasAppearedSinceLastModelChange;
 
@@ -214,6 +221,13 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState;
  */
 - (nullable HUBComponentWrapper *)visibleChildComponentAtIndex:(NSUInteger)index;
 
+/**
+ *  Returns whether the wrapped component has already created a child component at the provided index
+ *
+ *  @param index The index of the child component to check for
+ */
+- (BOOL)hasChildComponentAtIndex:(NSUInteger)index;
+
 @end
 
 NS_ASSUME_NONNULL_END
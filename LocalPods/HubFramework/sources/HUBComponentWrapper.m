@@ -28,6 +28,7 @@
 #import "HUBActionPerformer.h"
 #import "HUBComponentGestureRecognizer.h"
 #import "HUBUtilities.h"
+#import "HUBIndexMap.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -37,8 +38,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign) BOOL viewHasAppearedSinceLastModelChange;
 @property (nonatomic, strong, readonly) id<HUBComponent> component;
 @property (nonatomic, strong, readonly) HUBComponentUIStateManager *UIStateManager;
-@property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, HUBComponentWrapper *> *childrenByIndex;
-@property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, UIView *> *visibleChildViewsByIndex;
+@property (nonatomic, strong, readonly) HUBIndexMap<HUBComponentWrapper *> *childrenByIndex;
+@property (nonatomic, strong, readonly) HUBIndexMap<UIView *> *visibleChildViewsByIndex;
 @property (nonatomic, strong, readonly) HUBComponentGestureRecognizer *gestureRecognizer;
 @property (nonatomic, assign) BOOL hasBeenConfigured;
 @property (nonatomic, assign) BOOL shouldPerformDelayedHighlight;
@@ -75,8 +76,8 @@ NS_ASSUME_NONNULL_BEGIN
         _gestureRecognizer = gestureRecognizer;
         _delegate = delegate;
         _parent = parent;
-        _childrenByIndex = [NSMutableDictionary new];
-        _visibleChildViewsByIndex = [NSMutableDictionary new];
+        _childrenByIndex = [HUBIndexMap new];
+        _visibleChildViewsByIndex = [HUBIndexMap new];
 
         _gestureRecognizer.delegate = self;
         [_gestureRecognizer addTarget:self action:@selector(handleGestureRecognizer:)];
@@ -112,33 +113,45 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
     
-    id currentUIState = [(id<HUBComponentWithRestorableUIState>)self.component currentUIState];
+    id<HUBComponentWithRestorableUIState> const component = (id<HUBComponentWithRestorableUIState>)self.component;
+    id currentUIState = [component currentUIState];
     
     if (currentUIState == nil) {
         [self.UIStateManager removeSavedUIStateForComponentModel:self.model];
-    } else {
-        [self.UIStateManager saveUIState:currentUIState forComponentModel:self.model];
+        return;
+    }
+    
+    NSUInteger cost = 0;
+    
+    if ([component respondsToSelector:@selector(costForUIState:)]) {
+        cost = [component costForUIState:currentUIState];
     }
+    
+    [self.UIStateManager saveUIState:currentUIState forComponentModel:self.model cost:cost];
 }
 
 - (nullable HUBComponentWrapper *)visibleChildComponentAtIndex:(NSUInteger)index
 {
-    NSNumber * const boxedIndex = @(index);
-    if (self.visibleChildViewsByIndex[boxedIndex] != nil) {
-        return self.childrenByIndex[boxedIndex];
+    if (self.visibleChildViewsByIndex[index] != nil) {
+        return self.childrenByIndex[index];
     }
     return nil;
 }
 
+- (BOOL)hasChildComponentAtIndex:(NSUInteger)index
+{
+    return self.childrenByIndex[index] != nil;
+}
+
 - (NSArray<HUBComponentWrapper *> *)visibleChildren
 {
     NSMutableArray<HUBComponentWrapper *> *visibleChildren = [NSMutableArray array];
-    for (NSNumber *visibleViewIndex in self.visibleChildViewsByIndex) {
+    [self.visibleChildViewsByIndex enumerateIndexesAndObjectsUsingBlock:^(NSUInteger visibleViewIndex, UIView *visibleView, BOOL *stop) {
         HUBComponentWrapper *childComponentWrapper = self.childrenByIndex[visibleViewIndex];
         if (childComponentWrapper != nil) {
             [visibleChildren addObject:childComponentWrapper];
         }
-    }
+    }];
     return [visibleChildren copy];
 }
 
@@ -149,6 +162,11 @@ NS_ASSUME_NONNULL_BEGIN
     return [self.component conformsToProtocol:@protocol(HUBComponentWithImageHandling)];
 }
 
+- (BOOL)handlesChildren
+{
+    return [self.component conformsToProtocol:@protocol(HUBComponentWithChildren)];
+}
+
 - (BOOL)isContentOffsetObserver
 {
     return [self.component conformsToProtocol:@protocol(HUBComponentContentOffsetObserver)];
@@ -159,6 +177,15 @@ NS_ASSUME_NONNULL_BEGIN
     return [self.component conformsToProtocol:@protocol(HUBComponentActionObserver)];
 }
 
+- (nullable NSSet<NSString *> *)observedCustomActionNamespaces
+{
+    if (![self.component respondsToSelector:@selector(observedActionNamespaces)]) {
+        return nil;
+    }
+    
+    return [[(id<HUBComponentActionObserver>)self.component observedActionNamespaces] copy];
+}
+
 - (BOOL)isRootComponent
 {
     return self.parent == nil;
@@ -225,7 +252,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)prepareViewForReuse
 {
-    NSNumber * const index = @(self.model.index);
+    NSUInteger const index = self.model.index;
     
     HUBComponentWrapper * const parent = self.parent;
     if (parent.childrenByIndex[index] == self) {
@@ -273,9 +300,8 @@ NS_ASSUME_NONNULL_BEGIN
         [(id<HUBComponentViewObserver>)self.component viewWillAppear];
     }
     
-    for (NSNumber * const childIndex in self.visibleChildViewsByIndex) {
+    [self.visibleChildViewsByIndex enumerateIndexesAndObjectsUsingBlock:^(NSUInteger childIndex, UIView *childView, BOOL *stop) {
         HUBComponentWrapper * const childComponent = self.childrenByIndex[childIndex];
-        UIView *childView = self.visibleChildViewsByIndex[childIndex];
         
         if (childComponent != nil) {
             [childComponent viewWillAppear];
@@ -284,8 +310,8 @@ NS_ASSUME_NONNULL_BEGIN
         [self.delegate componentWrapper:self
                          childComponent:childComponent
                               childView:childView
-                      willAppearAtIndex:childIndex.unsignedIntegerValue];
-    }
+                      willAppearAtIndex:childIndex];
+    }];
     
     self.viewHasAppearedSinceLastModelChange = YES;
 }
@@ -348,7 +374,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (id<HUBComponent>)component:(id<HUBComponentWithChildren>)component childComponentForModel:(id<HUBComponentModel>)childComponentModel
 {
     HUBComponentWrapper * const childComponent = [self.delegate componentWrapper:self childComponentForModel:childComponentModel];
-    self.childrenByIndex[@(childComponentModel.index)] = childComponent;
+    self.childrenByIndex[childComponentModel.index] = childComponent;
     return childComponent;
 }
 
@@ -358,13 +384,13 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
     
-    HUBComponentWrapper * const childComponent = self.childrenByIndex[@(childIndex)];
+    HUBComponentWrapper * const childComponent = self.childrenByIndex[childIndex];
     
     if (childComponent != nil) {
         [childComponent viewWillAppear];
     }
     
-    self.visibleChildViewsByIndex[@(childIndex)] = childView;
+    self.visibleChildViewsByIndex[childIndex] = childView;
     [self.delegate componentWrapper:self
                      childComponent:childComponent
                           childView:childView
@@ -377,13 +403,22 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
     
-    HUBComponentWrapper * const childComponent = self.childrenByIndex[@(childIndex)];
-    self.visibleChildViewsByIndex[@(childIndex)] = nil;
+    HUBComponentWrapper * const childComponent = self.childrenByIndex[childIndex];
+    self.visibleChildViewsByIndex[childIndex] = nil;
 
     [self.delegate componentWrapper:self
                      childComponent:childComponent
                           childView:childView
                 didDisappearAtIndex:childIndex];
+    
+    if (childComponent == nil || ![component conformsToProtocol:@protocol(HUBComponentWithRecyclableChildren)]) {
+        return;
+    }
+    
+    // The component will ask for the child again before redisplaying it, so it can be reused for other children meanwhile
+    HUBComponentWrapper * const recyclableChildComponent = childComponent;
+    [recyclableChildComponent saveComponentUIState];
+    [recyclableChildComponent prepareViewForReuse];
 }
 
 - (void)component:(id<HUBComponentWithChildren>)component
@@ -395,7 +430,7 @@ NS_ASSUME_NONNULL_BEGIN
     }
     
     // If this is accidentially called by the API user (for a managed component) - simply ignore it
-    if (self.childrenByIndex[@(childIndex)] != nil) {
+    if (self.childrenByIndex[childIndex] != nil) {
         return;
     }
     
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBContentOperationRecorder.h"
+#import "HUBConnectivityState.h"
+
+@class HUBContentOperationRecording;
+@protocol HUBFeatureInfo;
+@protocol HUBContentOperation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Concrete implementation of the `HUBContentOperationRecorder` API
+ *
+ *  View model loaders record their events into a recording that they get from `recordingForViewModelLoader:...`. Since
+ *  that returns `nil` while the recorder isn't recording, and when sent to a `nil` recorder, loaders don't need to do
+ *  any work to record their events unless a recording is actually being made.
+ */
+@interface HUBContentOperationRecorderImplementation : NSObject <HUBContentOperationRecorder>
+
+/**
+ *  Get the recording that a view model loader should record its events into
+ *
+ *  @param viewModelLoader The view model loader to get the recording for. It's not retained by the recorder.
+ *  @param viewURI The URI of the view that the loader loads view models for
+ *  @param featureInfo Information about the feature that the view belongs to
+ *  @param contentOperations The content operations of the loader's content loading chain
+ *  @param connectivityState The current connectivity state of the loader
+ *
+ *  @return The recording for the loader, created the first time it's requested after recording started, or `nil` if
+ *  the recorder isn't recording.
+ */
+- (nullable HUBContentOperationRecording *)recordingForViewModelLoader:(id)viewModelLoader
+                                                               viewURI:(NSURL *)viewURI
+                                                           featureInfo:(id<HUBFeatureInfo>)featureInfo
+                                                     contentOperations:(NSArray<id<HUBContentOperation>> *)contentOperations
+                                                     connectivityState:(HUBConnectivityState)connectivityState;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBContentOperationRecorderImplementation.h"
+
+#import "HUBContentOperationRecording.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBContentOperationRecorderImplementation ()
+
+@property (nonatomic, assign, readwrite, getter=isRecording) BOOL recording;
+@property (nonatomic, assign) CFTimeInterval recordingStartTime;
+@property (nonatomic, strong, readonly) NSMutableArray<HUBContentOperationRecording *> *recordings;
+@property (nonatomic, strong, readonly) NSMapTable<id, HUBContentOperationRecording *> *recordingsByViewModelLoader;
+
+@end
+
+@implementation HUBContentOperationRecorderImplementation
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _recordings = [NSMutableArray new];
+        _recordingsByViewModelLoader = [NSMapTable weakToStrongObjectsMapTable];
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (nullable HUBContentOperationRecording *)recordingForViewModelLoader:(id)viewModelLoader
+                                                               viewURI:(NSURL *)viewURI
+                                                           featureInfo:(id<HUBFeatureInfo>)featureInfo
+                                                     contentOperations:(NSArray<id<HUBContentOperation>> *)contentOperations
+                                                     connectivityState:(HUBConnectivityState)connectivityState
+{
+    if (!self.recording) {
+        return nil;
+    }
+    
+    HUBContentOperationRecording * const existingRecording = [self.recordingsByViewModelLoader objectForKey:viewModelLoader];
+    
+    if (existingRecording != nil) {
+        return existingRecording;
+    }
+    
+    HUBContentOperationRecording * const newRecording = [[HUBContentOperationRecording alloc] initWithViewURI:viewURI
+                                                                                                  featureInfo:featureInfo
+                                                                                            contentOperations:contentOperations
+                                                                                            connectivityState:connectivityState
+                                                                                                referenceTime:self.recordingStartTime];
+    
+    // Recordings are kept in a separate array, so that they outlive the loaders that they were made for
+    [self.recordings addObject:newRecording];
+    [self.recordingsByViewModelLoader setObject:newRecording forKey:viewModelLoader];
+    return newRecording;
+}
+
+#pragma mark - HUBContentOperationRecorder
+
+- (NSUInteger)recordedEventCount
+{
+    NSUInteger eventCount = 0;
+    
+    for (HUBContentOperationRecording * const recording in self.recordings) {
+        eventCount += recording.events.count;
+    }
+    
+    return eventCount;
+}
+
+- (void)startRecording
+{
+    [self.recordings removeAllObjects];
+    [self.recordingsByViewModelLoader removeAllObjects];
+    self.recordingStartTime = CACurrentMediaTime();
+    self.recording = YES;
+}
+
+- (BOOL)stopRecordingAndWriteToURL:(NSURL *)fileURL error:(NSError * _Nullable __autoreleasing *)error
+{
+    self.recording = NO;
+    
+    NSArray<HUBContentOperationRecording *> * const recordings = [self.recordings copy];
+    [self.recordings removeAllObjects];
+    [self.recordingsByViewModelLoader removeAllObjects];
+    
+    NSData * const data = [HUBContentOperationRecording JSONDataForRecordings:recordings error:error];
+    
+    if (data == nil) {
+        return NO;
+    }
+    
+    return [data writeToURL:fileURL options:NSDataWritingAtomic error:error];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,179 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <QuartzCore/QuartzCore.h>
+
+#import "HUBConnectivityState.h"
+#import "HUBHeaderMacros.h"
+
+@protocol HUBFeatureInfo;
+@protocol HUBContentOperation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Enum describing the types of events that a content operation recording contains
+typedef NS_ENUM(NSUInteger, HUBContentOperationRecordedEventType) {
+    /// The view model loader started loading content, from its first content operation
+    HUBContentOperationRecordedEventTypeLoad,
+    /// The view model loader started loading the next page of content
+    HUBContentOperationRecordedEventTypeLoadNextPage,
+    /// A content operation requested to be rescheduled. The operation index is the index of that operation.
+    HUBContentOperationRecordedEventTypeRescheduling,
+    /// Content was reloaded because the connectivity state changed. The connectivity state is the new state.
+    HUBContentOperationRecordedEventTypeConnectivityStateChange,
+    /// A content operation finished, either successfully or with an error
+    HUBContentOperationRecordedEventTypeContentOperation
+};
+
+/// Return the name that is used for an event type in recording files, such as "load" or "contentOperation"
+extern NSString *HUBContentOperationRecordedEventTypeName(HUBContentOperationRecordedEventType type);
+
+/// Class representing a single event that was recorded for a view
+@interface HUBContentOperationRecordedEvent : NSObject
+
+/// The type of the event
+@property (nonatomic, assign, readonly) HUBContentOperationRecordedEventType type;
+
+/// The time at which the event started, in seconds since recording started
+@property (nonatomic, assign, readonly) NSTimeInterval time;
+
+/// The duration of the event in seconds. Always `0` for events other than content operations.
+@property (nonatomic, assign, readonly) NSTimeInterval duration;
+
+/// The index of the content operation that the event is for, or `0` if the event isn't for a specific operation
+@property (nonatomic, assign, readonly) NSUInteger operationIndex;
+
+/// The connectivity state of the view model loader when the event was recorded
+@property (nonatomic, assign, readonly) HUBConnectivityState connectivityState;
+
+/// For content operations, the serialized content of the view model builder once the operation had finished
+@property (nonatomic, copy, readonly, nullable) NSDictionary<NSString *, id> *content;
+
+/// For content operations, any error that the operation ended with
+@property (nonatomic, strong, readonly, nullable) NSError *error;
+
+/**
+ *  Initialize an instance of this class
+ *
+ *  @param type The type of the event
+ *  @param time The time at which the event started, in seconds since recording started
+ *  @param duration The duration of the event in seconds
+ *  @param operationIndex The index of the content operation that the event is for
+ *  @param connectivityState The connectivity state of the view model loader when the event was recorded
+ *  @param content The serialized content of the view model builder once a content operation had finished
+ *  @param error Any error that a content operation ended with
+ */
+- (instancetype)initWithType:(HUBContentOperationRecordedEventType)type
+                        time:(NSTimeInterval)time
+                    duration:(NSTimeInterval)duration
+              operationIndex:(NSUInteger)operationIndex
+           connectivityState:(HUBConnectivityState)connectivityState
+                     content:(nullable NSDictionary<NSString *, id> *)content
+                       error:(nullable NSError *)error HUB_DESIGNATED_INITIALIZER;
+
+@end
+
+/**
+ *  Class containing the events recorded for the content loading chain of a single view
+ *
+ *  Recordings are created by `HUBContentOperationRecorderImplementation` while a session is being recorded, and are read
+ *  back from a recording file by `HUBContentOperationReplayer` using `recordingsFromJSONData:error:`.
+ */
+@interface HUBContentOperationRecording : NSObject
+
+/// The URI of the view that was recorded
+@property (nonatomic, copy, readonly) NSURL *viewURI;
+
+/// The identifier of the feature that the view belongs to
+@property (nonatomic, copy, readonly) NSString *featureIdentifier;
+
+/// The title of the feature that the view belongs to
+@property (nonatomic, copy, readonly) NSString *featureTitle;
+
+/// The class names of the view's content operations, in the order that they are performed
+@property (nonatomic, copy, readonly) NSArray<NSString *> *contentOperationClassNames;
+
+/// The indexes of the content operations that conform to `HUBContentOperationWithPaginatedContent`
+@property (nonatomic, copy, readonly) NSIndexSet *paginatedContentOperationIndexes;
+
+/// The indexes of the content operations that conform to `HUBContentOperationWithConnectivityIndependentContent`
+@property (nonatomic, copy, readonly) NSIndexSet *connectivityIndependentContentOperationIndexes;
+
+/// The connectivity state of the view model loader when recording of the view started
+@property (nonatomic, assign, readonly) HUBConnectivityState initialConnectivityState;
+
+/// The media time (see `CACurrentMediaTime()`) that event times are relative to. Always `0` for recordings read from JSON.
+@property (nonatomic, assign, readonly) CFTimeInterval referenceTime;
+
+/// The events that have been recorded for the view, in the order that they were recorded
+@property (nonatomic, copy, readonly) NSArray<HUBContentOperationRecordedEvent *> *events;
+
+/**
+ *  Read the recordings that a recording file contains
+ *
+ *  @param data The JSON data of the file, as written by `JSONDataForRecordings:error:`
+ *  @param error Any error that occurred because the data wasn't a valid recording
+ *
+ *  @return The recordings of all views in the file, or `nil` if an error occurred
+ */
++ (nullable NSArray<HUBContentOperationRecording *> *)recordingsFromJSONData:(NSData *)data
+                                                                      error:(NSError * _Nullable __autoreleasing *)error;
+
+/**
+ *  Encode a set of recordings as the JSON data of a recording file
+ *
+ *  @param recordings The recordings to encode
+ *  @param error Any error that occurred while encoding the recordings
+ */
++ (nullable NSData *)JSONDataForRecordings:(NSArray<HUBContentOperationRecording *> *)recordings
+                                     error:(NSError * _Nullable __autoreleasing *)error;
+
+/**
+ *  Initialize an instance of this class for recording a view
+ *
+ *  @param viewURI The URI of the view to record
+ *  @param featureInfo Information about the feature that the view belongs to
+ *  @param contentOperations The content operations of the view's content loading chain
+ *  @param connectivityState The current connectivity state of the view's model loader
+ *  @param referenceTime The media time that event times should be relative to
+ */
+- (instancetype)initWithViewURI:(NSURL *)viewURI
+                    featureInfo:(id<HUBFeatureInfo>)featureInfo
+              contentOperations:(NSArray<id<HUBContentOperation>> *)contentOperations
+              connectivityState:(HUBConnectivityState)connectivityState
+                  referenceTime:(CFTimeInterval)referenceTime;
+
+/**
+ *  Add an event to the recording
+ *
+ *  @param event The event to add
+ */
+- (void)addEvent:(HUBContentOperationRecordedEvent *)event;
+
+/// Unavailable. Use one of the other initializers or factory methods instead.
++ (instancetype)new NS_UNAVAILABLE;
+
+/// Unavailable. Use one of the other initializers or factory methods instead.
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
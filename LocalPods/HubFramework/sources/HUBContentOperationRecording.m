@@ -0,0 +1,477 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBContentOperationRecording.h"
+
+#import "HUBFeatureInfo.h"
+#import "HUBContentOperationWithPaginatedContent.h"
+#import "HUBContentOperationWithConnectivityIndependentContent.h"
+#import "HUBUtilities.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSString * const HUBContentOperationRecordingErrorDomain = @"spotify.com.hubFramework.contentOperationRecording";
+static NSInteger const HUBContentOperationRecordingVersion = 1;
+
+static NSString * const HUBContentOperationRecordingKeyVersion = @"version";
+static NSString * const HUBContentOperationRecordingKeyViews = @"views";
+static NSString * const HUBContentOperationRecordingKeyViewURI = @"viewURI";
+static NSString * const HUBContentOperationRecordingKeyFeatureIdentifier = @"featureIdentifier";
+static NSString * const HUBContentOperationRecordingKeyFeatureTitle = @"featureTitle";
+static NSString * const HUBContentOperationRecordingKeyContentOperations = @"contentOperations";
+static NSString * const HUBContentOperationRecordingKeyClassName = @"className";
+static NSString * const HUBContentOperationRecordingKeyPaginated = @"paginated";
+static NSString * const HUBContentOperationRecordingKeyConnectivityIndependent = @"connectivityIndependent";
+static NSString * const HUBContentOperationRecordingKeyInitialConnectivityState = @"initialConnectivityState";
+static NSString * const HUBContentOperationRecordingKeyEvents = @"events";
+static NSString * const HUBContentOperationRecordingKeyType = @"type";
+static NSString * const HUBContentOperationRecordingKeyTime = @"time";
+static NSString * const HUBContentOperationRecordingKeyDuration = @"duration";
+static NSString * const HUBContentOperationRecordingKeyOperationIndex = @"operationIndex";
+static NSString * const HUBContentOperationRecordingKeyConnectivityState = @"connectivityState";
+static NSString * const HUBContentOperationRecordingKeyContent = @"content";
+static NSString * const HUBContentOperationRecordingKeyError = @"error";
+static NSString * const HUBContentOperationRecordingKeyErrorDomain = @"domain";
+static NSString * const HUBContentOperationRecordingKeyErrorCode = @"code";
+static NSString * const HUBContentOperationRecordingKeyErrorDescription = @"description";
+
+/// Error codes used in `HUBContentOperationRecordingErrorDomain`
+typedef NS_ENUM(NSInteger, HUBContentOperationRecordingErrorCode) {
+    /// The data wasn't a recording, or was written by an unsupported version of the recorder
+    HUBContentOperationRecordingErrorCodeInvalidRecording,
+    /// A recording contained content that can't be encoded as JSON, such as non-JSON custom data
+    HUBContentOperationRecordingErrorCodeInvalidContent
+};
+
+NSString *HUBContentOperationRecordedEventTypeName(HUBContentOperationRecordedEventType type)
+{
+    switch (type) {
+        case HUBContentOperationRecordedEventTypeLoad:
+            return @"load";
+        case HUBContentOperationRecordedEventTypeLoadNextPage:
+            return @"loadNextPage";
+        case HUBContentOperationRecordedEventTypeRescheduling:
+            return @"rescheduling";
+        case HUBContentOperationRecordedEventTypeConnectivityStateChange:
+            return @"connectivityStateChange";
+        case HUBContentOperationRecordedEventTypeContentOperation:
+            return @"contentOperation";
+    }
+}
+
+static BOOL HUBContentOperationRecordedEventTypeFromName(NSString *name, HUBContentOperationRecordedEventType *outType)
+{
+    HUBContentOperationRecordedEventType const types[] = {
+        HUBContentOperationRecordedEventTypeLoad,
+        HUBContentOperationRecordedEventTypeLoadNextPage,
+        HUBContentOperationRecordedEventTypeRescheduling,
+        HUBContentOperationRecordedEventTypeConnectivityStateChange,
+        HUBContentOperationRecordedEventTypeContentOperation
+    };
+    
+    for (size_t index = 0; index < sizeof(types) / sizeof(types[0]); index++) {
+        if ([HUBContentOperationRecordedEventTypeName(types[index]) isEqualToString:name]) {
+            *outType = types[index];
+            return YES;
+        }
+    }
+    
+    return NO;
+}
+
+static NSString *HUBContentOperationRecordingConnectivityStateName(HUBConnectivityState connectivityState)
+{
+    return (connectivityState == HUBConnectivityStateOnline) ? @"online" : @"offline";
+}
+
+static HUBConnectivityState HUBContentOperationRecordingConnectivityStateFromName(id _Nullable name)
+{
+    return [name isEqual:@"offline"] ? HUBConnectivityStateOffline : HUBConnectivityStateOnline;
+}
+
+static id _Nullable HUBContentOperationRecordingValue(id _Nullable object, Class valueClass)
+{
+    return [object isKindOfClass:valueClass] ? object : nil;
+}
+
+static NSError *HUBContentOperationRecordingError(HUBContentOperationRecordingErrorCode code, NSString *description)
+{
+    return [NSError errorWithDomain:HUBContentOperationRecordingErrorDomain
+                               code:code
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+#pragma mark - HUBContentOperationRecordedEvent
+
+@interface HUBContentOperationRecordedEvent ()
+
+- (nullable instancetype)initWithDictionary:(NSDictionary<NSString *, id> *)dictionary;
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation;
+
+@end
+
+@implementation HUBContentOperationRecordedEvent
+
+- (instancetype)initWithType:(HUBContentOperationRecordedEventType)type
+                        time:(NSTimeInterval)time
+                    duration:(NSTimeInterval)duration
+              operationIndex:(NSUInteger)operationIndex
+           connectivityState:(HUBConnectivityState)connectivityState
+                     content:(nullable NSDictionary<NSString *, id> *)content
+                       error:(nullable NSError *)error
+{
+    self = [super init];
+    
+    if (self) {
+        _type = type;
+        _time = time;
+        _duration = duration;
+        _operationIndex = operationIndex;
+        _connectivityState = connectivityState;
+        _content = [content copy];
+        _error = error;
+    }
+    
+    return self;
+}
+
+- (nullable instancetype)initWithDictionary:(NSDictionary<NSString *, id> *)dictionary
+{
+    NSString * const typeName = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyType], [NSString class]);
+    HUBContentOperationRecordedEventType type = HUBContentOperationRecordedEventTypeLoad;
+    
+    if (typeName == nil || !HUBContentOperationRecordedEventTypeFromName(typeName, &type)) {
+        return nil;
+    }
+    
+    NSNumber * const time = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyTime], [NSNumber class]);
+    NSNumber * const duration = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyDuration], [NSNumber class]);
+    NSNumber * const operationIndex = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyOperationIndex], [NSNumber class]);
+    NSDictionary * const content = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyContent], [NSDictionary class]);
+    NSDictionary * const errorDictionary = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyError], [NSDictionary class]);
+    NSError *error = nil;
+    
+    if (errorDictionary != nil) {
+        NSString * const domain = HUBContentOperationRecordingValue(errorDictionary[HUBContentOperationRecordingKeyErrorDomain], [NSString class]);
+        NSNumber * const code = HUBContentOperationRecordingValue(errorDictionary[HUBContentOperationRecordingKeyErrorCode], [NSNumber class]);
+        NSString * const description = HUBContentOperationRecordingValue(errorDictionary[HUBContentOperationRecordingKeyErrorDescription], [NSString class]);
+        
+        error = [NSError errorWithDomain:domain ?: HUBContentOperationRecordingErrorDomain
+                                    code:code.integerValue
+                                userInfo:(description != nil) ? @{NSLocalizedDescriptionKey: description} : nil];
+    }
+    
+    return [self initWithType:type
+                         time:time.doubleValue
+                     duration:duration.doubleValue
+               operationIndex:operationIndex.unsignedIntegerValue
+            connectivityState:HUBContentOperationRecordingConnectivityStateFromName(dictionary[HUBContentOperationRecordingKeyConnectivityState])
+                      content:content
+                        error:error];
+}
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation
+{
+    NSMutableDictionary<NSString *, id> * const dictionary = [NSMutableDictionary new];
+    dictionary[HUBContentOperationRecordingKeyType] = HUBContentOperationRecordedEventTypeName(self.type);
+    dictionary[HUBContentOperationRecordingKeyTime] = @(self.time);
+    dictionary[HUBContentOperationRecordingKeyDuration] = @(self.duration);
+    dictionary[HUBContentOperationRecordingKeyOperationIndex] = @(self.operationIndex);
+    dictionary[HUBContentOperationRecordingKeyConnectivityState] = HUBContentOperationRecordingConnectivityStateName(self.connectivityState);
+    dictionary[HUBContentOperationRecordingKeyContent] = self.content;
+    
+    NSError * const error = self.error;
+    
+    if (error != nil) {
+        dictionary[HUBContentOperationRecordingKeyError] = @{
+            HUBContentOperationRecordingKeyErrorDomain: error.domain,
+            HUBContentOperationRecordingKeyErrorCode: @(error.code),
+            HUBContentOperationRecordingKeyErrorDescription: error.localizedDescription
+        };
+    }
+    
+    return [dictionary copy];
+}
+
+@end
+
+#pragma mark - HUBContentOperationRecording
+
+@interface HUBContentOperationRecording ()
+
+@property (nonatomic, strong, readonly) NSMutableArray<HUBContentOperationRecordedEvent *> *mutableEvents;
+
+- (nullable instancetype)initWithDictionary:(nullable NSDictionary<NSString *, id> *)dictionary;
+
+- (instancetype)initWithViewURI:(NSURL *)viewURI
+              featureIdentifier:(NSString *)featureIdentifier
+                   featureTitle:(NSString *)featureTitle
+     contentOperationClassNames:(NSArray<NSString *> *)contentOperationClassNames
+paginatedContentOperationIndexes:(NSIndexSet *)paginatedContentOperationIndexes
+connectivityIndependentContentOperationIndexes:(NSIndexSet *)connectivityIndependentContentOperationIndexes
+       initialConnectivityState:(HUBConnectivityState)initialConnectivityState
+                  referenceTime:(CFTimeInterval)referenceTime
+                         events:(NSArray<HUBContentOperationRecordedEvent *> *)events;
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation;
+
+@end
+
+@implementation HUBContentOperationRecording
+
+#pragma mark - Class methods
+
++ (nullable NSArray<HUBContentOperationRecording *> *)recordingsFromJSONData:(NSData *)data
+                                                                      error:(NSError * _Nullable __autoreleasing *)error
+{
+    NSError *JSONError = nil;
+    NSDictionary * const dictionary = HUBContentOperationRecordingValue([NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:&JSONError], [NSDictionary class]);
+    
+    if (dictionary == nil) {
+        HUBSetOutError(error, JSONError ?: HUBContentOperationRecordingError(HUBContentOperationRecordingErrorCodeInvalidRecording,
+                                                                             @"The data doesn't contain a recording"));
+        return nil;
+    }
+    
+    NSNumber * const version = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyVersion], [NSNumber class]);
+    NSArray * const viewDictionaries = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyViews], [NSArray class]);
+    
+    if (version.integerValue != HUBContentOperationRecordingVersion || viewDictionaries == nil) {
+        HUBSetOutError(error, HUBContentOperationRecordingError(HUBContentOperationRecordingErrorCodeInvalidRecording,
+                                                                @"The recording was written by an unsupported version of the recorder"));
+        return nil;
+    }
+    
+    NSMutableArray<HUBContentOperationRecording *> * const recordings = [NSMutableArray new];
+    
+    for (id const viewDictionary in viewDictionaries) {
+        HUBContentOperationRecording * const recording = [[HUBContentOperationRecording alloc] initWithDictionary:HUBContentOperationRecordingValue(viewDictionary, [NSDictionary class])];
+        
+        if (recording == nil) {
+            HUBSetOutError(error, HUBContentOperationRecordingError(HUBContentOperationRecordingErrorCodeInvalidRecording,
+                                                                    @"The recording contains an invalid view"));
+            return nil;
+        }
+        
+        [recordings addObject:recording];
+    }
+    
+    return [recordings copy];
+}
+
++ (nullable NSData *)JSONDataForRecordings:(NSArray<HUBContentOperationRecording *> *)recordings
+                                     error:(NSError * _Nullable __autoreleasing *)error
+{
+    NSMutableArray<NSDictionary<NSString *, id> *> * const viewDictionaries = [NSMutableArray new];
+    
+    for (HUBContentOperationRecording * const recording in recordings) {
+        [viewDictionaries addObject:[recording dictionaryRepresentation]];
+    }
+    
+    NSDictionary<NSString *, id> * const dictionary = @{
+        HUBContentOperationRecordingKeyVersion: @(HUBContentOperationRecordingVersion),
+        HUBContentOperationRecordingKeyViews: viewDictionaries
+    };
+    
+    // NSJSONSerialization throws rather than failing for objects that it can't encode
+    if (![NSJSONSerialization isValidJSONObject:dictionary]) {
+        HUBSetOutError(error, HUBContentOperationRecordingError(HUBContentOperationRecordingErrorCodeInvalidContent,
+                                                                @"The recording contains content that can't be encoded as JSON"));
+        return nil;
+    }
+    
+    return [NSJSONSerialization dataWithJSONObject:dictionary options:(NSJSONWritingOptions)0 error:error];
+}
+
+#pragma mark - Initializers
+
+- (instancetype)initWithViewURI:(NSURL *)viewURI
+                    featureInfo:(id<HUBFeatureInfo>)featureInfo
+              contentOperations:(NSArray<id<HUBContentOperation>> *)contentOperations
+              connectivityState:(HUBConnectivityState)connectivityState
+                  referenceTime:(CFTimeInterval)referenceTime
+{
+    NSParameterAssert(viewURI != nil);
+    NSParameterAssert(featureInfo != nil);
+    NSParameterAssert(contentOperations != nil);
+    
+    NSMutableArray<NSString *> * const contentOperationClassNames = [NSMutableArray new];
+    NSMutableIndexSet * const paginatedContentOperationIndexes = [NSMutableIndexSet new];
+    NSMutableIndexSet * const connectivityIndependentContentOperationIndexes = [NSMutableIndexSet new];
+    
+    [contentOperations enumerateObjectsUsingBlock:^(id<HUBContentOperation> operation, NSUInteger operationIndex, BOOL *stop) {
+        [contentOperationClassNames addObject:NSStringFromClass([operation class])];
+        
+        if ([operation conformsToProtocol:@protocol(HUBContentOperationWithPaginatedContent)]) {
+            [paginatedContentOperationIndexes addIndex:operationIndex];
+        }
+        
+        if ([operation conformsToProtocol:@protocol(HUBContentOperationWithConnectivityIndependentContent)]) {
+            [connectivityIndependentContentOperationIndexes addIndex:operationIndex];
+        }
+    }];
+    
+    return [self initWithViewURI:viewURI
+               featureIdentifier:featureInfo.identifier
+                    featureTitle:featureInfo.title
+      contentOperationClassNames:contentOperationClassNames
+paginatedContentOperationIndexes:paginatedContentOperationIndexes
+connectivityIndependentContentOperationIndexes:connectivityIndependentContentOperationIndexes
+        initialConnectivityState:connectivityState
+                   referenceTime:referenceTime
+                          events:@[]];
+}
+
+- (nullable instancetype)initWithDictionary:(nullable NSDictionary<NSString *, id> *)dictionary
+{
+    NSString * const viewURIString = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyViewURI], [NSString class]);
+    NSURL * const viewURI = (viewURIString != nil) ? [NSURL URLWithString:viewURIString] : nil;
+    NSString * const featureIdentifier = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyFeatureIdentifier], [NSString class]);
+    NSString * const featureTitle = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyFeatureTitle], [NSString class]);
+    NSArray * const operationDictionaries = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyContentOperations], [NSArray class]);
+    NSArray * const eventDictionaries = HUBContentOperationRecordingValue(dictionary[HUBContentOperationRecordingKeyEvents], [NSArray class]);
+    
+    if (viewURI == nil || featureIdentifier == nil || featureTitle == nil || operationDictionaries.count == 0 || eventDictionaries == nil) {
+        return nil;
+    }
+    
+    NSMutableArray<NSString *> * const contentOperationClassNames = [NSMutableArray new];
+    NSMutableIndexSet * const paginatedContentOperationIndexes = [NSMutableIndexSet new];
+    NSMutableIndexSet * const connectivityIndependentContentOperationIndexes = [NSMutableIndexSet new];
+    
+    for (id const operationObject in operationDictionaries) {
+        NSDictionary * const operationDictionary = HUBContentOperationRecordingValue(operationObject, [NSDictionary class]);
+        NSString * const className = HUBContentOperationRecordingValue(operationDictionary[HUBContentOperationRecordingKeyClassName], [NSString class]);
+        
+        if (className == nil) {
+            return nil;
+        }
+        
+        if ([HUBContentOperationRecordingValue(operationDictionary[HUBContentOperationRecordingKeyPaginated], [NSNumber class]) boolValue]) {
+            [paginatedContentOperationIndexes addIndex:contentOperationClassNames.count];
+        }
+        
+        if ([HUBContentOperationRecordingValue(operationDictionary[HUBContentOperationRecordingKeyConnectivityIndependent], [NSNumber class]) boolValue]) {
+            [connectivityIndependentContentOperationIndexes addIndex:contentOperationClassNames.count];
+        }
+        
+        [contentOperationClassNames addObject:className];
+    }
+    
+    NSMutableArray<HUBContentOperationRecordedEvent *> * const events = [NSMutableArray new];
+    
+    for (id const eventObject in eventDictionaries) {
+        NSDictionary * const eventDictionary = HUBContentOperationRecordingValue(eventObject, [NSDictionary class]);
+        HUBContentOperationRecordedEvent * const event = (eventDictionary != nil) ? [[HUBContentOperationRecordedEvent alloc] initWithDictionary:eventDictionary] : nil;
+        
+        if (event == nil || event.operationIndex >= contentOperationClassNames.count) {
+            return nil;
+        }
+        
+        [events addObject:event];
+    }
+    
+    return [self initWithViewURI:viewURI
+               featureIdentifier:featureIdentifier
+                    featureTitle:featureTitle
+      contentOperationClassNames:contentOperationClassNames
+paginatedContentOperationIndexes:paginatedContentOperationIndexes
+connectivityIndependentContentOperationIndexes:connectivityIndependentContentOperationIndexes
+        initialConnectivityState:HUBContentOperationRecordingConnectivityStateFromName(dictionary[HUBContentOperationRecordingKeyInitialConnectivityState])
+                   referenceTime:0
+                          events:events];
+}
+
+- (instancetype)initWithViewURI:(NSURL *)viewURI
+              featureIdentifier:(NSString *)featureIdentifier
+                   featureTitle:(NSString *)featureTitle
+     contentOperationClassNames:(NSArray<NSString *> *)contentOperationClassNames
+paginatedContentOperationIndexes:(NSIndexSet *)paginatedContentOperationIndexes
+connectivityIndependentContentOperationIndexes:(NSIndexSet *)connectivityIndependentContentOperationIndexes
+       initialConnectivityState:(HUBConnectivityState)initialConnectivityState
+                  referenceTime:(CFTimeInterval)referenceTime
+                         events:(NSArray<HUBContentOperationRecordedEvent *> *)events
+{
+    self = [super init];
+    
+    if (self) {
+        _viewURI = [viewURI copy];
+        _featureIdentifier = [featureIdentifier copy];
+        _featureTitle = [featureTitle copy];
+        _contentOperationClassNames = [contentOperationClassNames copy];
+        _paginatedContentOperationIndexes = [paginatedContentOperationIndexes copy];
+        _connectivityIndependentContentOperationIndexes = [connectivityIndependentContentOperationIndexes copy];
+        _initialConnectivityState = initialConnectivityState;
+        _referenceTime = referenceTime;
+        _mutableEvents = [events mutableCopy];
+    }
+    
+    return self;
+}
+
+#pragma mark - Accessor overrides
+
+- (NSArray<HUBContentOperationRecordedEvent *> *)events
+{
+    return [self.mutableEvents copy];
+}
+
+#pragma mark - API
+
+- (void)addEvent:(HUBContentOperationRecordedEvent *)event
+{
+    [self.mutableEvents addObject:event];
+}
+
+#pragma mark - Private utilities
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation
+{
+    NSMutableArray<NSDictionary<NSString *, id> *> * const operationDictionaries = [NSMutableArray new];
+    
+    [self.contentOperationClassNames enumerateObjectsUsingBlock:^(NSString *className, NSUInteger operationIndex, BOOL *stop) {
+        [operationDictionaries addObject:@{
+            HUBContentOperationRecordingKeyClassName: className,
+            HUBContentOperationRecordingKeyPaginated: @([self.paginatedContentOperationIndexes containsIndex:operationIndex]),
+            HUBContentOperationRecordingKeyConnectivityIndependent: @([self.connectivityIndependentContentOperationIndexes containsIndex:operationIndex])
+        }];
+    }];
+    
+    NSMutableArray<NSDictionary<NSString *, id> *> * const eventDictionaries = [NSMutableArray new];
+    
+    for (HUBContentOperationRecordedEvent * const event in self.mutableEvents) {
+        [eventDictionaries addObject:[event dictionaryRepresentation]];
+    }
+    
+    return @{
+        HUBContentOperationRecordingKeyViewURI: self.viewURI.absoluteString ?: @"",
+        HUBContentOperationRecordingKeyFeatureIdentifier: self.featureIdentifier,
+        HUBContentOperationRecordingKeyFeatureTitle: self.featureTitle,
+        HUBContentOperationRecordingKeyContentOperations: operationDictionaries,
+        HUBContentOperationRecordingKeyInitialConnectivityState: HUBContentOperationRecordingConnectivityStateName(self.initialConnectivityState),
+        HUBContentOperationRecordingKeyEvents: eventDictionaries
+    };
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
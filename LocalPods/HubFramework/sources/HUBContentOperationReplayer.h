@@ -0,0 +1,81 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+@class HUBContentOperationRecording;
+@class HUBComponentDefaults;
+@protocol HUBViewModel;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Class that replays the recording of a view's content loading, to profile it without any of its content sources
+ *
+ *  The replayer drives a `HUBViewModelLoaderImplementation` headlessly, using stand-in content operations that apply the
+ *  content and errors that the recorded operations ended with, in the order that they were recorded. Loading is
+ *  triggered the same way it was during the recorded session: initially, for the next page, by rescheduled operations
+ *  and by connectivity state changes.
+ *
+ *  Time is virtual: the clock jumps to the time at which each load was triggered, and moves forward by the recorded
+ *  duration of each performed operation, as well as by the time that the framework actually spent processing. Replays
+ *  are therefore deterministic, take no longer than the framework's own work, and can be compared across builds.
+ *
+ *  Replaying must be done on the main queue, since that's where view model loaders perform their work.
+ */
+@interface HUBContentOperationReplayer : NSObject
+
+/// The virtual time that the replay has reached, in seconds since recording started
+@property (nonatomic, assign, readonly) NSTimeInterval virtualTime;
+
+/// The number of operations performed during replay that had no recorded result left. Non-zero if the replay diverged.
+@property (nonatomic, assign, readonly) NSUInteger unmatchedContentOperationCount;
+
+/// The view model that was most recently loaded during replay
+@property (nonatomic, strong, readonly, nullable) id<HUBViewModel> viewModel;
+
+/**
+ *  Initialize an instance of this class
+ *
+ *  @param recording The recording to replay
+ *  @param componentDefaults The component defaults to use when applying recorded content
+ */
+- (instancetype)initWithRecording:(HUBContentOperationRecording *)recording
+                componentDefaults:(HUBComponentDefaults *)componentDefaults HUB_DESIGNATED_INITIALIZER;
+
+/**
+ *  Replay the recording
+ *
+ *  @return A JSON compatible profile for each time that loading was triggered, in order. Each dictionary contains the
+ *  type of event that triggered loading (`event`, see `HUBContentOperationRecordedEventTypeName()`), the virtual time
+ *  at which it did (`startTime`), the virtual time until the view model was loaded (`latency`), how much of that time
+ *  the framework spent processing (`processingDuration`), the number of content operations that were performed
+ *  (`contentOperationCount`), the number of heap bytes and allocations that loading left behind (`heapBytes` and
+ *  `heapAllocations`), the number of body components in the loaded view model (`componentCount`) and the description of
+ *  any error that loading failed with (`error`). All times are in seconds.
+ *
+ *  A replayer can only replay its recording once.
+ */
+- (NSArray<NSDictionary<NSString *, id> *> *)replay;
+
+@end
+
+NS_ASSUME_NONNULL_END
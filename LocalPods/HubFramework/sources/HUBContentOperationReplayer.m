@@ -0,0 +1,387 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBContentOperationReplayer.h"
+
+#import "HUBContentOperationRecording.h"
+#import "HUBContentOperationWithPaginatedContent.h"
+#import "HUBContentOperationWithConnectivityIndependentContent.h"
+#import "HUBConnectivityStateResolver.h"
+#import "HUBFeatureInfoImplementation.h"
+#import "HUBJSONSchemaImplementation.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBViewModel.h"
+#import "HUBViewModelBuilder.h"
+#import "HUBViewModelLoaderImplementation.h"
+
+#import <malloc/malloc.h>
+#import <objc/runtime.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class HUBReplayedContentOperation;
+
+@interface HUBContentOperationReplayer () <HUBViewModelLoaderDelegate>
+
+@property (nonatomic, strong, readonly) HUBContentOperationRecording *recording;
+@property (nonatomic, strong, readonly) HUBComponentDefaults *componentDefaults;
+@property (nonatomic, assign, readwrite) NSTimeInterval virtualTime;
+@property (nonatomic, assign, readwrite) NSUInteger unmatchedContentOperationCount;
+@property (nonatomic, strong, readwrite, nullable) id<HUBViewModel> viewModel;
+@property (nonatomic, strong, nullable) NSError *error;
+@property (nonatomic, assign) NSUInteger performedContentOperationCount;
+@property (nonatomic, assign) BOOL hasReplayed;
+
+- (void)replayedContentOperationDidApplyEvent:(nullable HUBContentOperationRecordedEvent *)event;
+
+@end
+
+#pragma mark - HUBReplayedContentOperation
+
+/// Content operation standing in for a recorded one, by applying its recorded results in order
+@interface HUBReplayedContentOperation : NSObject <HUBContentOperationWithPaginatedContent, HUBContentOperationWithConnectivityIndependentContent>
+
+@property (nonatomic, weak, nullable) id<HUBContentOperationDelegate> delegate;
+@property (nonatomic, weak, nullable) HUBContentOperationReplayer *replayer;
+@property (nonatomic, assign, readonly) BOOL paginated;
+@property (nonatomic, assign, readonly) BOOL connectivityIndependent;
+@property (nonatomic, strong, readonly) NSMutableArray<HUBContentOperationRecordedEvent *> *pendingEvents;
+
+@end
+
+@implementation HUBReplayedContentOperation
+
+- (instancetype)initWithPaginated:(BOOL)paginated connectivityIndependent:(BOOL)connectivityIndependent
+{
+    self = [super init];
+    
+    if (self) {
+        _paginated = paginated;
+        _connectivityIndependent = connectivityIndependent;
+        _pendingEvents = [NSMutableArray new];
+    }
+    
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (BOOL)conformsToProtocol:(Protocol *)protocol
+{
+    // The view model loader treats operations differently based on these protocols, so mirror the recorded operation
+    if (protocol_isEqual(protocol, @protocol(HUBContentOperationWithPaginatedContent))) {
+        return self.paginated;
+    }
+    
+    if (protocol_isEqual(protocol, @protocol(HUBContentOperationWithConnectivityIndependentContent))) {
+        return self.connectivityIndependent;
+    }
+    
+    return [super conformsToProtocol:protocol];
+}
+
+#pragma mark - HUBContentOperation
+
+- (void)performForViewURI:(NSURL *)viewURI
+              featureInfo:(id<HUBFeatureInfo>)featureInfo
+        connectivityState:(HUBConnectivityState)connectivityState
+         viewModelBuilder:(id<HUBViewModelBuilder>)viewModelBuilder
+            previousError:(nullable NSError *)previousError
+{
+    [self applyNextEventToViewModelBuilder:viewModelBuilder previousError:previousError];
+}
+
+#pragma mark - HUBContentOperationWithPaginatedContent
+
+- (void)appendContentForPageIndex:(NSUInteger)pageIndex
+               toViewModelBuilder:(id<HUBViewModelBuilder>)viewModelBuilder
+                          viewURI:(NSURL *)viewURI
+                      featureInfo:(id<HUBFeatureInfo>)featureInfo
+                connectivityState:(HUBConnectivityState)connectivityState
+                    previousError:(nullable NSError *)previousError
+{
+    [self applyNextEventToViewModelBuilder:viewModelBuilder previousError:previousError];
+}
+
+#pragma mark - Private utilities
+
+- (void)applyNextEventToViewModelBuilder:(id<HUBViewModelBuilder>)viewModelBuilder previousError:(nullable NSError *)previousError
+{
+    HUBContentOperationRecordedEvent * const event = self.pendingEvents.firstObject;
+    [self.replayer replayedContentOperationDidApplyEvent:event];
+    
+    if (event == nil) {
+        // The replay diverged from the recording, so pass the chain through unchanged to let it complete
+        [self finishWithError:previousError];
+        return;
+    }
+    
+    [self.pendingEvents removeObjectAtIndex:0];
+    
+    NSDictionary<NSString *, id> * const content = event.content;
+    
+    // The recorded content is the builder's state once the operation finished, so it replaces whatever the builder has
+    if (content != nil) {
+        [viewModelBuilder removeAllComponentModelBuilders];
+        viewModelBuilder.viewIdentifier = nil;
+        viewModelBuilder.navigationBarTitle = nil;
+        viewModelBuilder.customData = nil;
+        [viewModelBuilder addJSONDictionary:content];
+    }
+    
+    [self finishWithError:event.error];
+}
+
+- (void)finishWithError:(nullable NSError *)error
+{
+    id<HUBContentOperationDelegate> const delegate = self.delegate;
+    
+    if (error == nil) {
+        [delegate contentOperationDidFinish:self];
+    } else {
+        NSError * const nonNilError = error;
+        [delegate contentOperation:self didFailWithError:nonNilError];
+    }
+}
+
+@end
+
+#pragma mark - HUBReplayConnectivityStateResolver
+
+/// Connectivity state resolver that reports the recorded connectivity state changes
+@interface HUBReplayConnectivityStateResolver : NSObject <HUBConnectivityStateResolver>
+
+@property (nonatomic, assign) HUBConnectivityState connectivityState;
+@property (nonatomic, strong, readonly) NSHashTable<id<HUBConnectivityStateResolverObserver>> *observers;
+
+@end
+
+@implementation HUBReplayConnectivityStateResolver
+
+- (instancetype)initWithConnectivityState:(HUBConnectivityState)connectivityState
+{
+    self = [super init];
+    
+    if (self) {
+        _connectivityState = connectivityState;
+        _observers = [NSHashTable weakObjectsHashTable];
+    }
+    
+    return self;
+}
+
+- (void)changeConnectivityState:(HUBConnectivityState)connectivityState
+{
+    self.connectivityState = connectivityState;
+    
+    for (id<HUBConnectivityStateResolverObserver> const observer in self.observers.allObjects) {
+        [observer connectivityStateResolverStateDidChange:self];
+    }
+}
+
+#pragma mark - HUBConnectivityStateResolver
+
+- (HUBConnectivityState)resolveConnectivityState
+{
+    return self.connectivityState;
+}
+
+- (void)addObserver:(id<HUBConnectivityStateResolverObserver>)observer
+{
+    [self.observers addObject:observer];
+}
+
+- (void)removeObserver:(id<HUBConnectivityStateResolverObserver>)observer
+{
+    [self.observers removeObject:observer];
+}
+
+@end
+
+#pragma mark - HUBContentOperationReplayer
+
+@implementation HUBContentOperationReplayer
+
+- (instancetype)initWithRecording:(HUBContentOperationRecording *)recording
+                componentDefaults:(HUBComponentDefaults *)componentDefaults
+{
+    NSParameterAssert(recording != nil);
+    NSParameterAssert(componentDefaults != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _recording = recording;
+        _componentDefaults = componentDefaults;
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (NSArray<NSDictionary<NSString *, id> *> *)replay
+{
+    NSAssert([NSThread isMainThread], @"Recordings can only be replayed on the main queue");
+    NSAssert(!self.hasReplayed, @"A replayer can only replay its recording once");
+    self.hasReplayed = YES;
+    
+    HUBContentOperationRecording * const recording = self.recording;
+    NSMutableArray<HUBReplayedContentOperation *> * const contentOperations = [NSMutableArray new];
+    
+    for (NSUInteger operationIndex = 0; operationIndex < recording.contentOperationClassNames.count; operationIndex++) {
+        BOOL const paginated = [recording.paginatedContentOperationIndexes containsIndex:operationIndex];
+        BOOL const connectivityIndependent = [recording.connectivityIndependentContentOperationIndexes containsIndex:operationIndex];
+        HUBReplayedContentOperation * const operation = [[HUBReplayedContentOperation alloc] initWithPaginated:paginated
+                                                                                       connectivityIndependent:connectivityIndependent];
+        operation.replayer = self;
+        [contentOperations addObject:operation];
+    }
+    
+    NSMutableArray<HUBContentOperationRecordedEvent *> * const triggerEvents = [NSMutableArray new];
+    
+    for (HUBContentOperationRecordedEvent * const event in recording.events) {
+        if (event.type == HUBContentOperationRecordedEventTypeContentOperation) {
+            [contentOperations[event.operationIndex].pendingEvents addObject:event];
+        } else {
+            [triggerEvents addObject:event];
+        }
+    }
+    
+    HUBReplayConnectivityStateResolver * const connectivityStateResolver = [[HUBReplayConnectivityStateResolver alloc] initWithConnectivityState:recording.initialConnectivityState];
+    HUBViewModelLoaderImplementation * const loader = [self createLoaderWithContentOperations:contentOperations
+                                                                    connectivityStateResolver:connectivityStateResolver];
+    
+    NSMutableArray<NSDictionary<NSString *, id> *> * const profiles = [NSMutableArray new];
+    
+    for (HUBContentOperationRecordedEvent * const event in triggerEvents) {
+        self.virtualTime = MAX(self.virtualTime, event.time);
+        self.performedContentOperationCount = 0;
+        self.error = nil;
+        
+        NSTimeInterval const startTime = self.virtualTime;
+        malloc_statistics_t heapBefore;
+        malloc_zone_statistics(NULL, &heapBefore);
+        CFTimeInterval const processingStartTime = CACurrentMediaTime();
+        
+        switch (event.type) {
+            case HUBContentOperationRecordedEventTypeLoad:
+                [loader loadViewModelRegardlessOfReloadPolicy];
+                break;
+            case HUBContentOperationRecordedEventTypeLoadNextPage:
+                [loader loadNextPageForCurrentViewModel];
+                break;
+            case HUBContentOperationRecordedEventTypeRescheduling: {
+                HUBReplayedContentOperation * const operation = contentOperations[event.operationIndex];
+                [operation.delegate contentOperationRequiresRescheduling:operation];
+                break;
+            }
+            case HUBContentOperationRecordedEventTypeConnectivityStateChange:
+                [connectivityStateResolver changeConnectivityState:event.connectivityState];
+                break;
+            case HUBContentOperationRecordedEventTypeContentOperation:
+                break;
+        }
+        
+        // Stand-in operations finish synchronously on the main queue, so loading has completed at this point
+        CFTimeInterval const processingDuration = CACurrentMediaTime() - processingStartTime;
+        malloc_statistics_t heapAfter;
+        malloc_zone_statistics(NULL, &heapAfter);
+        self.virtualTime += processingDuration;
+        
+        NSMutableDictionary<NSString *, id> * const profile = [NSMutableDictionary new];
+        profile[@"event"] = HUBContentOperationRecordedEventTypeName(event.type);
+        profile[@"startTime"] = @(startTime);
+        profile[@"latency"] = @(self.virtualTime - startTime);
+        profile[@"processingDuration"] = @(processingDuration);
+        profile[@"contentOperationCount"] = @(self.performedContentOperationCount);
+        profile[@"heapBytes"] = @((double)heapAfter.size_in_use - (double)heapBefore.size_in_use);
+        profile[@"heapAllocations"] = @((double)heapAfter.blocks_in_use - (double)heapBefore.blocks_in_use);
+        profile[@"componentCount"] = @(self.viewModel.bodyComponentModels.count);
+        profile[@"error"] = self.error.localizedDescription;
+        [profiles addObject:[profile copy]];
+    }
+    
+    return [profiles copy];
+}
+
+#pragma mark - HUBViewModelLoaderDelegate
+
+- (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didLoadViewModel:(id<HUBViewModel>)viewModel
+{
+    self.viewModel = viewModel;
+    self.error = nil;
+}
+
+- (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didFailLoadingWithError:(NSError *)error
+{
+    self.error = error;
+}
+
+#pragma mark - Private utilities
+
+- (void)replayedContentOperationDidApplyEvent:(nullable HUBContentOperationRecordedEvent *)event
+{
+    self.performedContentOperationCount++;
+    
+    if (event == nil) {
+        self.unmatchedContentOperationCount++;
+        return;
+    }
+    
+    self.virtualTime += event.duration;
+}
+
+- (HUBViewModelLoaderImplementation *)createLoaderWithContentOperations:(NSArray<HUBReplayedContentOperation *> *)contentOperations
+                                              connectivityStateResolver:(id<HUBConnectivityStateResolver>)connectivityStateResolver
+{
+    HUBContentOperationRecording * const recording = self.recording;
+    
+    id<HUBFeatureInfo> const featureInfo = [[HUBFeatureInfoImplementation alloc] initWithIdentifier:recording.featureIdentifier
+                                                                                              title:recording.featureTitle];
+    
+    id<HUBJSONSchema> const JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:self.componentDefaults
+                                                                                      iconImageResolver:nil];
+    
+    HUBPerformanceTracker * const performanceTracker = [[HUBPerformanceTracker new] trackerForViewURI:recording.viewURI
+                                                                                    featureIdentifier:recording.featureIdentifier];
+    
+    HUBViewModelLoaderImplementation * const loader = [[HUBViewModelLoaderImplementation alloc] initWithViewURI:recording.viewURI
+                                                                                                    featureInfo:featureInfo
+                                                                                              contentOperations:contentOperations
+                                                                                            contentReloadPolicy:nil
+                                                                                                     JSONSchema:JSONSchema
+                                                                                              componentDefaults:self.componentDefaults
+                                                                                      connectivityStateResolver:connectivityStateResolver
+                                                                                              iconImageResolver:nil
+                                                                                               initialViewModel:nil
+                                                                                             performanceTracker:performanceTracker
+                                                                                       contentOperationRecorder:nil];
+    
+    // Connectivity changes are replayed at the time they settled, so they shouldn't be debounced again
+    loader.connectivityStateChangeDebounceInterval = 0;
+    loader.delegate = self;
+    return loader;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
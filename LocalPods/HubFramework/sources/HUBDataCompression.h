@@ -0,0 +1,48 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Decompressing a payload into more than this many bytes fails, guarding against decompression bombs
+static NSUInteger const HUBDataCompressionMaximumDecompressedLength = 32 * 1024 * 1024;
+
+/**
+ *  Return whether some data starts with a gzip or zlib header
+ *
+ *  @param data The data to inspect
+ */
+extern BOOL HUBDataIsCompressed(NSData *data);
+
+/**
+ *  Decompress some gzip or zlib compressed data
+ *
+ *  @param data The data to decompress
+ *  @param outError Contains an `NSError` object describing the problem if decompression failed
+ *
+ *  @return The decompressed data, `data` itself if it wasn't compressed (according to `HUBDataIsCompressed()`),
+ *          or nil if decompression failed or would produce more than `HUBDataCompressionMaximumDecompressedLength`
+ *          bytes.
+ */
+extern NSData * _Nullable HUBDecompressDataIfNeeded(NSData *data, NSError * _Nullable __autoreleasing * _Nullable outError);
+
+NS_ASSUME_NONNULL_END
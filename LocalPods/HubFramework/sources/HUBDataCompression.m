@@ -0,0 +1,141 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBDataCompression.h"
+
+#import <GoogleToolboxForMac/GTMNSData+zlib.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSString * const HUBDataCompressionErrorDomain = @"spotify.com.hubFramework.dataCompression";
+
+/// Error codes used in `HUBDataCompressionErrorDomain`
+typedef NS_ENUM(NSInteger, HUBDataCompressionErrorCode) {
+    /// The compressed data ended before the end of its stream was reached
+    HUBDataCompressionErrorCodeTruncatedData,
+    /// The decompressed data would be larger than `HUBDataCompressionMaximumDecompressedLength`
+    HUBDataCompressionErrorCodeMaximumLengthExceeded
+};
+
+/// The initial size of the buffer that data is decompressed into. JSON typically compresses 5-10x.
+static NSUInteger HUBInitialDecompressionCapacity(NSUInteger compressedLength)
+{
+    NSUInteger const capacity = MAX(compressedLength * 4, (NSUInteger)16 * 1024);
+    return MIN(capacity, HUBDataCompressionMaximumDecompressedLength);
+}
+
+BOOL HUBDataIsCompressed(NSData *data)
+{
+    if (data.length < 2) {
+        return NO;
+    }
+    
+    const uint8_t * const bytes = data.bytes;
+    
+    // gzip magic number
+    if (bytes[0] == 0x1f && bytes[1] == 0x8b) {
+        return YES;
+    }
+    
+    // zlib header: deflate method (8), and a header checksum that is a multiple of 31
+    return (bytes[0] & 0x0f) == 8 && (bytes[0] >> 4) <= 7 && ((bytes[0] << 8) | bytes[1]) % 31 == 0;
+}
+
+NSData * _Nullable HUBDecompressDataIfNeeded(NSData *data, NSError * _Nullable __autoreleasing * _Nullable outError)
+{
+    if (!HUBDataIsCompressed(data)) {
+        return data;
+    }
+    
+    GTMZlibInflateStream * const stream = [[GTMZlibInflateStream alloc] initWithRawData:NO];
+    [stream pushData:data];
+    
+    // The buffer is allocated uninitialized and handed over to the returned data, instead of zero-filling it
+    NSUInteger capacity = HUBInitialDecompressionCapacity(data.length);
+    NSUInteger length = 0;
+    uint8_t *buffer = malloc(capacity);
+    NSError *error = nil;
+    
+    while (buffer != NULL && !stream.finished) {
+        if (length == capacity) {
+            if (capacity == HUBDataCompressionMaximumDecompressedLength) {
+                // The stream may only have its trailer left, so it's only too long if it still produces output
+                uint8_t overflowByte;
+                NSInteger const overflowLength = [stream pullBytes:&overflowByte maxLength:1 error:&error];
+                
+                if (overflowLength > 0) {
+                    error = [NSError errorWithDomain:HUBDataCompressionErrorDomain
+                                                code:HUBDataCompressionErrorCodeMaximumLengthExceeded
+                                            userInfo:nil];
+                } else if (overflowLength == 0 && !stream.finished) {
+                    error = [NSError errorWithDomain:HUBDataCompressionErrorDomain
+                                                code:HUBDataCompressionErrorCodeTruncatedData
+                                            userInfo:nil];
+                }
+                
+                break;
+            }
+            
+            capacity = MIN(capacity * 2, HUBDataCompressionMaximumDecompressedLength);
+            uint8_t * const grownBuffer = realloc(buffer, capacity);
+            
+            if (grownBuffer == NULL) {
+                free(buffer);
+                buffer = NULL;
+                break;
+            }
+            
+            buffer = grownBuffer;
+        }
+        
+        NSInteger const pulledLength = [stream pullBytes:buffer + length maxLength:capacity - length error:&error];
+        
+        if (pulledLength < 0) {
+            break;
+        }
+        
+        length += (NSUInteger)pulledLength;
+        
+        // All input has been pushed up front, so running out of it before the end of the stream means it was cut off
+        if (length < capacity && !stream.finished) {
+            error = [NSError errorWithDomain:HUBDataCompressionErrorDomain
+                                        code:HUBDataCompressionErrorCodeTruncatedData
+                                    userInfo:nil];
+            break;
+        }
+    }
+    
+    if (buffer == NULL || error != nil || !stream.finished) {
+        free(buffer);
+        
+        if (outError) {
+            *outError = error ?: [NSError errorWithDomain:NSPOSIXErrorDomain code:ENOMEM userInfo:nil];
+        }
+        
+        return nil;
+    }
+    
+    // Give back the unused tail of the buffer; keeping the original one is fine if that fails
+    uint8_t * const trimmedBuffer = realloc(buffer, MAX(length, (NSUInteger)1));
+    return [NSData dataWithBytesNoCopy:(trimmedBuffer ?: buffer) length:length freeWhenDone:YES];
+}
+
+NS_ASSUME_NONNULL_END
@@ -20,7 +20,7 @@
  */
 
 
-#import "HUBImageLoader.h"
+#import "HUBImageLoaderWithBatchedRequests.h"
 #import "HUBHeaderMacros.h"
 
 NS_ASSUME_NONNULL_BEGIN
@@ -33,20 +33,37 @@ NS_ASSUME_NONNULL_BEGIN
  *  download images over HTTP. It also provides a resize feature, that automatically resizes
  *  images if the requested `targetSize` doesn't match the size of a downloaded image.
  *
+ *  The largest loaded version of each image is kept in memory, and smaller requests for the same
+ *  URL are served by downscaling it instead of downloading and decoding the image again. Loaders
+ *  created by the same factory share that memory cache.
+ *
+ *  Requests are batched: all images rendered at the same time are requested together, each URL
+ *  is only downloaded once even if it's requested again at another size while being downloaded,
+ *  and downloaded images are decoded in parallel, off the URL session's delegate queue.
+ *
  *  To adjust this image loader's caching behavior, refer to `NSURLCache`.
  *
  *  In case you need more powerful image loader features you might want to either implement
  *  your own using `HUBImageLoader`, or adding a wrapper for that protocol around an image
  *  loading library.
  */
-@interface HUBDefaultImageLoader : NSObject <HUBImageLoader>
+@interface HUBDefaultImageLoader : NSObject <HUBImageLoaderWithBatchedRequests>
 
 /**
- *  Initialize an instance of this class with an URL session to use
+ *  Initialize an instance of this class with an URL session and an image cache to use
  *
  *  @param session The URL session to use. Typically the application's shared session.
+ *  @param imageCache The cache to keep loaded images in. Typically shared between all image loaders of a factory.
+ */
+- (instancetype)initWithSession:(NSURLSession *)session
+                     imageCache:(NSCache<NSURL *, UIImage *> *)imageCache HUB_DESIGNATED_INITIALIZER;
+
+/**
+ *  Create a cache suitable for passing to `initWithSession:imageCache:`
+ *
+ *  The cache's total cost limit is set to a reasonable number of bytes of decoded images.
  */
-- (instancetype)initWithSession:(NSURLSession *)session HUB_DESIGNATED_INITIALIZER;
++ (NSCache<NSURL *, UIImage *> *)createImageCache;
 
 @end
 
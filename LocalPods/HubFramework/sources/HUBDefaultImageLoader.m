@@ -0,0 +1,230 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+
+#import "HUBDefaultImageLoader.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The maximum number of bytes of decoded images that an image loader keeps in memory
+static NSUInteger const HUBDefaultImageLoaderCacheCostLimit = 32 * 1024 * 1024;
+
+static NSUInteger HUBDefaultImageLoaderCacheCost(UIImage *image)
+{
+    return (NSUInteger)(image.size.width * image.scale * image.size.height * image.scale * 4);
+}
+
+static BOOL HUBDefaultImageLoaderImageIsOpaque(UIImage *image)
+{
+    CGImageAlphaInfo const alphaInfo = CGImageGetAlphaInfo(image.CGImage);
+    return alphaInfo == kCGImageAlphaNone || alphaInfo == kCGImageAlphaNoneSkipFirst || alphaInfo == kCGImageAlphaNoneSkipLast;
+}
+
+@interface HUBDefaultImageLoader ()
+
+@property (nonatomic, strong, readonly) NSURLSession *session;
+@property (nonatomic, strong, readonly) NSCache<NSURL *, UIImage *> *imageCache;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSURL *, NSMutableArray<NSValue *> *> *targetSizesByDownloadingURL;
+
+@end
+
+@implementation HUBDefaultImageLoader
+
+@synthesize delegate = _delegate;
+
+#pragma mark - Class methods
+
++ (NSCache<NSURL *, UIImage *> *)createImageCache
+{
+    NSCache<NSURL *, UIImage *> * const imageCache = [NSCache new];
+    imageCache.totalCostLimit = HUBDefaultImageLoaderCacheCostLimit;
+    return imageCache;
+}
+
+#pragma mark - Initializer
+
+- (instancetype)initWithSession:(NSURLSession *)session imageCache:(NSCache<NSURL *, UIImage *> *)imageCache
+{
+    NSParameterAssert(session != nil);
+    NSParameterAssert(imageCache != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _session = session;
+        _imageCache = imageCache;
+        _targetSizesByDownloadingURL = [NSMutableDictionary new];
+    }
+    
+    return self;
+}
+
+#pragma mark - HUBImageLoader
+
+- (void)loadImageForURL:(NSURL *)imageURL targetSize:(CGSize)targetSize
+{
+    [self loadImagesForURLs:@[imageURL] targetSizes:@[[NSValue valueWithCGSize:targetSize]]];
+}
+
+#pragma mark - HUBImageLoaderWithBatchedRequests
+
+- (void)loadImagesForURLs:(NSArray<NSURL *> *)imageURLs targetSizes:(NSArray<NSValue *> *)targetSizes
+{
+    NSParameterAssert(imageURLs.count == targetSizes.count);
+    
+    NSMutableArray<NSURL *> * const imageURLsToDownload = [NSMutableArray new];
+    
+    [imageURLs enumerateObjectsUsingBlock:^(NSURL *imageURL, NSUInteger index, BOOL *stop) {
+        NSValue * const targetSize = targetSizes[index];
+        UIImage * const cachedImage = [self.imageCache objectForKey:imageURL];
+        
+        // An image that was previously loaded at the same or a larger size can be downscaled, rather than downloaded again
+        if (cachedImage != nil && cachedImage.size.width >= targetSize.CGSizeValue.width && cachedImage.size.height >= targetSize.CGSizeValue.height) {
+            [self decodeImagesForURL:imageURL targetSizes:@[targetSize] usingBlock:^UIImage * _Nullable {
+                return cachedImage;
+            } opaque:HUBDefaultImageLoaderImageIsOpaque(cachedImage)];
+            
+            return;
+        }
+        
+        // Each URL is only downloaded once, requests made while it's downloading are served from the same download
+        @synchronized (self.targetSizesByDownloadingURL) {
+            NSMutableArray<NSValue *> * const downloadTargetSizes = self.targetSizesByDownloadingURL[imageURL];
+            
+            if (downloadTargetSizes != nil) {
+                [downloadTargetSizes addObject:targetSize];
+                return;
+            }
+            
+            self.targetSizesByDownloadingURL[imageURL] = [NSMutableArray arrayWithObject:targetSize];
+        }
+        
+        [imageURLsToDownload addObject:imageURL];
+    }];
+    
+    for (NSURL * const imageURL in imageURLsToDownload) {
+        [self downloadImageForURL:imageURL];
+    }
+}
+
+#pragma mark - Private utilities
+
+- (void)downloadImageForURL:(NSURL *)imageURL
+{
+    __weak __typeof(self) weakSelf = self;
+    
+    NSURLSessionTask * const task = [self.session dataTaskWithURL:imageURL completionHandler:^(NSData * _Nullable data, NSURLResponse * _Nullable response, NSError * _Nullable error) {
+        __typeof(self) strongSelf = weakSelf;
+        NSArray<NSValue *> * const targetSizes = [strongSelf removeTargetSizesForDownloadingURL:imageURL];
+        
+        if (data == nil || error != nil) {
+            NSError * const nonNilError = error ?: [strongSelf createErrorWithIdentifier:@"unknown"];
+            
+            for (NSUInteger index = 0; index < targetSizes.count; index++) {
+                [strongSelf.delegate imageLoader:strongSelf didFailLoadingImageForURL:imageURL error:nonNilError];
+            }
+            
+            return;
+        }
+        
+        NSData * const nonNilData = data;
+        BOOL const imageIsJPEG = [response.MIMEType isEqualToString:@"image/jpeg"];
+        
+        [strongSelf decodeImagesForURL:imageURL targetSizes:targetSizes usingBlock:^UIImage * _Nullable {
+            return [UIImage imageWithData:nonNilData scale:[UIScreen mainScreen].scale];
+        } opaque:imageIsJPEG];
+    }];
+    
+    [task resume];
+}
+
+- (NSArray<NSValue *> *)removeTargetSizesForDownloadingURL:(NSURL *)imageURL
+{
+    @synchronized (self.targetSizesByDownloadingURL) {
+        NSArray<NSValue *> * const targetSizes = [self.targetSizesByDownloadingURL[imageURL] copy] ?: @[];
+        [self.targetSizesByDownloadingURL removeObjectForKey:imageURL];
+        return targetSizes;
+    }
+}
+
+- (void)decodeImagesForURL:(NSURL *)imageURL
+               targetSizes:(NSArray<NSValue *> *)targetSizes
+                usingBlock:(UIImage * _Nullable (^)(void))imageBlock
+                    opaque:(BOOL)opaque
+{
+    __weak __typeof(self) weakSelf = self;
+    
+    // Decoding happens on a concurrent queue, so that the images of a batch are decoded in parallel
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        __typeof(self) strongSelf = weakSelf;
+        id<HUBImageLoaderDelegate> const delegate = strongSelf.delegate;
+        UIImage * const image = imageBlock();
+        
+        for (NSValue * const targetSize in targetSizes) {
+            UIImage * const resizedImage = (image != nil) ? [strongSelf imageByResizingImage:image toSize:targetSize.CGSizeValue opaque:opaque] : nil;
+            
+            if (resizedImage == nil) {
+                NSError * const dataError = [strongSelf createErrorWithIdentifier:@"invalidData"];
+                [delegate imageLoader:strongSelf didFailLoadingImageForURL:imageURL error:dataError];
+                continue;
+            }
+            
+            [strongSelf cacheImage:resizedImage forURL:imageURL];
+            [delegate imageLoader:strongSelf didLoadImage:resizedImage forURL:imageURL];
+        }
+    });
+}
+
+- (nullable UIImage *)imageByResizingImage:(UIImage *)image toSize:(CGSize)size opaque:(BOOL)opaque
+{
+    if (CGSizeEqualToSize(image.size, size)) {
+        return image;
+    }
+    
+    UIGraphicsBeginImageContextWithOptions(size, opaque, image.scale);
+    [image drawInRect:CGRectMake(0, 0, size.width, size.height)];
+    UIImage * const resizedImage = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    
+    return resizedImage;
+}
+
+- (void)cacheImage:(UIImage *)image forURL:(NSURL *)imageURL
+{
+    UIImage * const cachedImage = [self.imageCache objectForKey:imageURL];
+    
+    // Only keep the largest loaded version of each image, since smaller ones can be created from it
+    if (cachedImage != nil && cachedImage.size.width >= image.size.width && cachedImage.size.height >= image.size.height) {
+        return;
+    }
+    
+    [self.imageCache setObject:image forKey:imageURL cost:HUBDefaultImageLoaderCacheCost(image)];
+}
+
+- (NSError *)createErrorWithIdentifier:(NSString *)identifier
+{
+    NSString * const domain = [NSString stringWithFormat:@"com.spotify.hubFramework.imageLoader.%@", identifier];
+    return [NSError errorWithDomain:domain code:-1 userInfo:nil];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
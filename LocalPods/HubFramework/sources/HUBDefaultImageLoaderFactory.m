@@ -23,11 +23,35 @@
 #import "HUBDefaultImageLoaderFactory.h"
 #import "HUBDefaultImageLoader.h"
 
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBDefaultImageLoaderFactory ()
+
+@property (nonatomic, strong, readonly) NSCache<NSURL *, UIImage *> *imageCache;
+
+@end
+
 @implementation HUBDefaultImageLoaderFactory
 
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _imageCache = [HUBDefaultImageLoader createImageCache];
+    }
+    
+    return self;
+}
+
+#pragma mark - HUBImageLoaderFactory
+
 - (id<HUBImageLoader>)createImageLoader
 {
-    return [[HUBDefaultImageLoader alloc] initWithSession:[NSURLSession sharedSession]];
+    // All loaders share a cache, so that images loaded by one view controller can be reused by the next one
+    return [[HUBDefaultImageLoader alloc] initWithSession:[NSURLSession sharedSession] imageCache:self.imageCache];
 }
 
 @end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <QuartzCore/QuartzCore.h>
+
+#import "HUBFrameProfiler.h"
+#import "HUBHeaderMacros.h"
+
+@class HUBIdentifier;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Enum describing the kinds of component work that the frame profiler measures
+typedef NS_ENUM(NSUInteger, HUBFrameProfilerCategory) {
+    /// A component was configured with a model
+    HUBFrameProfilerCategoryConfiguration,
+    /// A component's view was loaded and added to a cell or parent component
+    HUBFrameProfilerCategoryViewLoading,
+    /// A component's view was updated for a loaded image
+    HUBFrameProfilerCategoryImageApplication,
+    /// A component's view was updated for a changed content offset
+    HUBFrameProfilerCategoryContentOffsetObservation
+};
+
+/**
+ *  Concrete implementation of the `HUBFrameProfiler` API
+ *
+ *  Measurements are made by calling `beginSample` before a piece of work, and passing the returned time to
+ *  `endSampleWithStartTime:category:componentIdentifier:featureIdentifier:` once it's done. Both are no-ops
+ *  while the profiler is disabled, and since `beginSample` returns `0` when sent to `nil`, call sites don't
+ *  need to check whether a profiler exists.
+ */
+@interface HUBFrameProfilerImplementation : NSObject <HUBFrameProfiler>
+
+/**
+ *  Begin measuring a piece of work
+ *
+ *  @return The current time, or `0` if the profiler is disabled
+ */
+- (CFTimeInterval)beginSample;
+
+/**
+ *  End measuring a piece of work, attributing it to the current frame
+ *
+ *  @param startTime The time returned from `beginSample`. If `0`, this method does nothing.
+ *  @param category The kind of work that was performed
+ *  @param componentIdentifier The identifier of the component that the work was performed for
+ *  @param featureIdentifier The identifier of the feature that the component belongs to
+ */
+- (void)endSampleWithStartTime:(CFTimeInterval)startTime
+                      category:(HUBFrameProfilerCategory)category
+           componentIdentifier:(HUBIdentifier *)componentIdentifier
+             featureIdentifier:(NSString *)featureIdentifier;
+
+@end
+
+NS_ASSUME_NONNULL_END
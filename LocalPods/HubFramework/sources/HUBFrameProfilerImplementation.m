@@ -0,0 +1,341 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBFrameProfilerImplementation.h"
+
+#import "HUBIdentifier.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSUInteger const HUBFrameProfilerCategoryCount = HUBFrameProfilerCategoryContentOffsetObservation + 1;
+
+static NSString *HUBFrameProfilerCategoryName(HUBFrameProfilerCategory category)
+{
+    switch (category) {
+        case HUBFrameProfilerCategoryConfiguration:
+            return @"configure";
+        case HUBFrameProfilerCategoryViewLoading:
+            return @"loadView";
+        case HUBFrameProfilerCategoryImageApplication:
+            return @"imageApply";
+        case HUBFrameProfilerCategoryContentOffsetObservation:
+            return @"contentOffsetObservation";
+    }
+}
+
+#pragma mark - HUBFrameProfilerStatistics
+
+/// Statistics collected by the frame profiler for a single component in a single feature
+@interface HUBFrameProfilerStatistics : NSObject
+
+@property (nonatomic, copy, readonly) NSString *componentIdentifier;
+@property (nonatomic, assign) NSUInteger sampleCount;
+@property (nonatomic, assign) NSTimeInterval totalDuration;
+@property (nonatomic, assign) NSTimeInterval currentFrameDuration;
+@property (nonatomic, assign) BOOL sampledInCurrentFrame;
+@property (nonatomic, assign) NSTimeInterval maxFrameDuration;
+@property (nonatomic, assign) NSUInteger overBudgetFrameCount;
+@property (nonatomic, assign) NSTimeInterval overBudgetDuration;
+
+- (instancetype)initWithComponentIdentifier:(NSString *)componentIdentifier HUB_DESIGNATED_INITIALIZER;
+
+- (void)addDuration:(NSTimeInterval)duration forCategory:(HUBFrameProfilerCategory)category;
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation;
+
+@end
+
+@implementation HUBFrameProfilerStatistics
+{
+    NSTimeInterval _categoryDurations[HUBFrameProfilerCategoryCount];
+}
+
+- (instancetype)initWithComponentIdentifier:(NSString *)componentIdentifier
+{
+    self = [super init];
+    
+    if (self) {
+        _componentIdentifier = [componentIdentifier copy];
+    }
+    
+    return self;
+}
+
+- (void)addDuration:(NSTimeInterval)duration forCategory:(HUBFrameProfilerCategory)category
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _categoryDurations[category] += duration;
+#pragma clang diagnostic pop
+    
+    self.sampleCount++;
+    self.totalDuration += duration;
+    self.currentFrameDuration += duration;
+}
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation
+{
+    NSMutableDictionary<NSString *, NSNumber *> * const durationsByCategory = [NSMutableDictionary new];
+    
+    for (NSUInteger category = 0; category < HUBFrameProfilerCategoryCount; category++) {
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+        durationsByCategory[HUBFrameProfilerCategoryName((HUBFrameProfilerCategory)category)] = @(_categoryDurations[category]);
+#pragma clang diagnostic pop
+    }
+    
+    return @{
+        @"component": self.componentIdentifier,
+        @"sampleCount": @(self.sampleCount),
+        @"totalDuration": @(self.totalDuration),
+        @"maxFrameDuration": @(self.maxFrameDuration),
+        @"overBudgetFrameCount": @(self.overBudgetFrameCount),
+        @"overBudgetDuration": @(self.overBudgetDuration),
+        @"durationsByCategory": [durationsByCategory copy]
+    };
+}
+
+@end
+
+#pragma mark - HUBFrameProfilerDisplayLinkTarget
+
+/// Object used as the target of the frame profiler's display link, to avoid it retaining the profiler
+@interface HUBFrameProfilerDisplayLinkTarget : NSObject
+
+@property (nonatomic, weak, nullable) HUBFrameProfilerImplementation *profiler;
+
+- (void)handleDisplayLink:(CADisplayLink *)displayLink;
+
+@end
+
+#pragma mark - HUBFrameProfilerImplementation
+
+@interface HUBFrameProfilerImplementation ()
+
+@property (nonatomic, strong, nullable) CADisplayLink *displayLink;
+@property (nonatomic, assign) CFTimeInterval previousFrameTimestamp;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSMutableDictionary<NSString *, HUBFrameProfilerStatistics *> *> *statisticsByFeature;
+@property (nonatomic, strong, readonly) NSMutableArray<HUBFrameProfilerStatistics *> *currentFrameStatistics;
+@property (nonatomic, assign, readwrite) NSUInteger frameCount;
+@property (nonatomic, assign, readwrite) NSUInteger overBudgetFrameCount;
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink;
+
+@end
+
+@implementation HUBFrameProfilerImplementation
+
+@synthesize enabled = _enabled;
+@synthesize frameBudget = _frameBudget;
+@synthesize frameCount = _frameCount;
+@synthesize overBudgetFrameCount = _overBudgetFrameCount;
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _frameBudget = 1.0 / 60.0;
+        _statisticsByFeature = [NSMutableDictionary new];
+        _currentFrameStatistics = [NSMutableArray new];
+    }
+    
+    return self;
+}
+
+- (void)dealloc
+{
+    [_displayLink invalidate];
+}
+
+#pragma mark - Accessor overrides
+
+- (void)setEnabled:(BOOL)enabled
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    if (_enabled == enabled) {
+        return;
+    }
+    
+    _enabled = enabled;
+#pragma clang diagnostic pop
+    
+    if (enabled) {
+        HUBFrameProfilerDisplayLinkTarget * const target = [HUBFrameProfilerDisplayLinkTarget new];
+        target.profiler = self;
+        
+        CADisplayLink * const displayLink = [CADisplayLink displayLinkWithTarget:target selector:@selector(handleDisplayLink:)];
+        [displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+        self.displayLink = displayLink;
+        self.previousFrameTimestamp = 0;
+    } else {
+        [self.displayLink invalidate];
+        self.displayLink = nil;
+        [self endCurrentFrameOverBudget:NO];
+    }
+}
+
+#pragma mark - API
+
+- (CFTimeInterval)beginSample
+{
+    if (!self.enabled) {
+        return 0;
+    }
+    
+    return CACurrentMediaTime();
+}
+
+- (void)endSampleWithStartTime:(CFTimeInterval)startTime
+                      category:(HUBFrameProfilerCategory)category
+           componentIdentifier:(HUBIdentifier *)componentIdentifier
+             featureIdentifier:(NSString *)featureIdentifier
+{
+    if (startTime == 0 || !self.enabled) {
+        return;
+    }
+    
+    NSTimeInterval const duration = CACurrentMediaTime() - startTime;
+    
+    NSMutableDictionary<NSString *, HUBFrameProfilerStatistics *> *featureStatistics = self.statisticsByFeature[featureIdentifier];
+    
+    if (featureStatistics == nil) {
+        featureStatistics = [NSMutableDictionary new];
+        self.statisticsByFeature[featureIdentifier] = featureStatistics;
+    }
+    
+    NSString * const identifierString = componentIdentifier.identifierString;
+    HUBFrameProfilerStatistics *statistics = featureStatistics[identifierString];
+    
+    if (statistics == nil) {
+        statistics = [[HUBFrameProfilerStatistics alloc] initWithComponentIdentifier:identifierString];
+        featureStatistics[identifierString] = statistics;
+    }
+    
+    if (!statistics.sampledInCurrentFrame) {
+        statistics.sampledInCurrentFrame = YES;
+        [self.currentFrameStatistics addObject:statistics];
+    }
+    
+    [statistics addDuration:duration forCategory:category];
+}
+
+#pragma mark - HUBFrameProfiler
+
+- (NSDictionary<NSString *, NSArray<NSDictionary<NSString *, id> *> *> *)worstOffendersByFeatureWithLimit:(NSUInteger)limit
+{
+    NSMutableDictionary<NSString *, NSArray<NSDictionary<NSString *, id> *> *> * const summary = [NSMutableDictionary new];
+    
+    for (NSString * const featureIdentifier in self.statisticsByFeature) {
+        NSArray<HUBFrameProfilerStatistics *> * const sortedStatistics = [self.statisticsByFeature[featureIdentifier].allValues sortedArrayUsingComparator:^NSComparisonResult(HUBFrameProfilerStatistics *statisticsA, HUBFrameProfilerStatistics *statisticsB) {
+            if (statisticsA.overBudgetDuration != statisticsB.overBudgetDuration) {
+                return (statisticsA.overBudgetDuration > statisticsB.overBudgetDuration) ? NSOrderedAscending : NSOrderedDescending;
+            }
+            
+            if (statisticsA.totalDuration != statisticsB.totalDuration) {
+                return (statisticsA.totalDuration > statisticsB.totalDuration) ? NSOrderedAscending : NSOrderedDescending;
+            }
+            
+            return NSOrderedSame;
+        }];
+        
+        NSMutableArray<NSDictionary<NSString *, id> *> * const offenders = [NSMutableArray new];
+        
+        for (HUBFrameProfilerStatistics * const statistics in sortedStatistics) {
+            if (offenders.count >= limit) {
+                break;
+            }
+            
+            [offenders addObject:[statistics dictionaryRepresentation]];
+        }
+        
+        summary[featureIdentifier] = [offenders copy];
+    }
+    
+    return [summary copy];
+}
+
+- (void)reset
+{
+    [self.currentFrameStatistics removeAllObjects];
+    [self.statisticsByFeature removeAllObjects];
+    self.frameCount = 0;
+    self.overBudgetFrameCount = 0;
+}
+
+#pragma mark - Private utilities
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink
+{
+    CFTimeInterval const previousFrameTimestamp = self.previousFrameTimestamp;
+    self.previousFrameTimestamp = displayLink.timestamp;
+    
+    // The first frame after enabling has no previous frame to measure against
+    if (previousFrameTimestamp == 0) {
+        [self endCurrentFrameOverBudget:NO];
+        return;
+    }
+    
+    // Display link timestamps jitter around the refresh interval, so only a frame that took at least half a refresh
+    // longer than its budget (meaning that a vsync was missed) is counted as over budget
+    CFTimeInterval const refreshInterval = (displayLink.duration > 0) ? displayLink.duration : self.frameBudget;
+    BOOL const overBudget = (displayLink.timestamp - previousFrameTimestamp) > (self.frameBudget + refreshInterval / 2);
+    
+    self.frameCount++;
+    
+    if (overBudget) {
+        self.overBudgetFrameCount++;
+    }
+    
+    [self endCurrentFrameOverBudget:overBudget];
+}
+
+- (void)endCurrentFrameOverBudget:(BOOL)overBudget
+{
+    for (HUBFrameProfilerStatistics * const statistics in self.currentFrameStatistics) {
+        NSTimeInterval const frameDuration = statistics.currentFrameDuration;
+        statistics.maxFrameDuration = MAX(statistics.maxFrameDuration, frameDuration);
+        
+        if (overBudget) {
+            statistics.overBudgetFrameCount++;
+            statistics.overBudgetDuration += frameDuration;
+        }
+        
+        statistics.currentFrameDuration = 0;
+        statistics.sampledInCurrentFrame = NO;
+    }
+    
+    [self.currentFrameStatistics removeAllObjects];
+}
+
+@end
+
+@implementation HUBFrameProfilerDisplayLinkTarget
+
+- (void)handleDisplayLink:(CADisplayLink *)displayLink
+{
+    [self.profiler displayLinkDidFire:displayLink];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
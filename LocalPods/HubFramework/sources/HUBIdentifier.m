@@ -21,8 +21,20 @@
 
 #import "HUBIdentifier.h"
 
+#import <pthread.h>
+
 NS_ASSUME_NONNULL_BEGIN
 
+/// Process-wide intern table, mapping namespace -> name -> canonical identifier instance
+static NSMutableDictionary<NSString *, NSMapTable<NSString *, HUBIdentifier *> *> *HUBIdentifierInternTable;
+static pthread_mutex_t HUBIdentifierInternTableMutex = PTHREAD_MUTEX_INITIALIZER;
+
+@interface HUBIdentifier ()
+
+@property (nonatomic, assign, readonly) NSUInteger precomputedHash;
+
+@end
+
 @implementation HUBIdentifier
 
 #pragma mark - Initializers
@@ -32,25 +44,57 @@ NS_ASSUME_NONNULL_BEGIN
     NSParameterAssert(namespacePart != nil);
     NSParameterAssert(namePart != nil);
     
+    pthread_mutex_lock(&HUBIdentifierInternTableMutex);
+    
+    if (HUBIdentifierInternTable == nil) {
+        HUBIdentifierInternTable = [NSMutableDictionary new];
+    }
+    
+    NSMapTable<NSString *, HUBIdentifier *> *identifiersByName = HUBIdentifierInternTable[namespacePart];
+    HUBIdentifier * const internedIdentifier = [identifiersByName objectForKey:namePart];
+    
+    if (internedIdentifier != nil) {
+        pthread_mutex_unlock(&HUBIdentifierInternTableMutex);
+        return internedIdentifier;
+    }
+    
     self = [super init];
     
     if (self) {
         _namespacePart = [namespacePart copy];
         _namePart = [namePart copy];
+        _precomputedHash = _namespacePart.hash ^ _namePart.hash;
+        
+        if (identifiersByName == nil) {
+            identifiersByName = [NSMapTable strongToWeakObjectsMapTable];
+            HUBIdentifierInternTable[_namespacePart] = identifiersByName;
+        }
+        
+        [identifiersByName setObject:self forKey:_namePart];
     }
     
+    pthread_mutex_unlock(&HUBIdentifierInternTableMutex);
+    
     return self;
 }
 
 - (nullable instancetype)initWithString:(NSString *)string
 {
-    NSArray * const identifierParts = [string componentsSeparatedByString:@":"];
+    NSRange const separatorRange = [string rangeOfString:@":" options:NSLiteralSearch];
+    
+    if (separatorRange.location == NSNotFound) {
+        return nil;
+    }
+    
+    NSUInteger const nameLocation = NSMaxRange(separatorRange);
+    NSRange const nameRange = NSMakeRange(nameLocation, string.length - nameLocation);
     
-    if (identifierParts.count != 2) {
+    if ([string rangeOfString:@":" options:NSLiteralSearch range:nameRange].location != NSNotFound) {
         return nil;
     }
     
-    return [self initWithNamespace:identifierParts[0] name:identifierParts[1]];
+    return [self initWithNamespace:[string substringToIndex:separatorRange.location]
+                              name:[string substringWithRange:nameRange]];
 }
 
 #pragma mark - Property overrides
@@ -64,14 +108,22 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (id)copyWithZone:(nullable NSZone *)zone
 {
-    return [[HUBIdentifier allocWithZone:zone] initWithNamespace:self.namespacePart
-                                                            name:self.namePart];
+    // Identifiers are immutable and interned, so a copy is always the canonical instance itself
+    return self;
 }
 
 #pragma mark - Equality and Hashing
 
 - (BOOL)isEqualToIdentifier:(HUBIdentifier *)identifier
 {
+    if (identifier == self) {
+        return YES;
+    }
+    
+    if (identifier.hash != self.precomputedHash) {
+        return NO;
+    }
+    
     if (![self.namespacePart isEqualToString:identifier.namespacePart]) {
         return NO;
     }
@@ -94,7 +146,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSUInteger)hash
 {
-    return self.namespacePart.hash ^ self.namePart.hash;
+    return self.precomputedHash;
 }
 
 - (NSString *)description
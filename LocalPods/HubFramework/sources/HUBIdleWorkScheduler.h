@@ -0,0 +1,59 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Scheduler that performs work on the main thread while its run loop is idle
+ *
+ *  Enqueued work is performed in FIFO order whenever the main run loop is about to wait for events,
+ *  for at most the scheduler's time budget per pass. Any work remaining once the budget has been spent
+ *  is deferred to the next pass, so that idle work never delays the rendering of a frame by more than
+ *  the budget.
+ */
+@interface HUBIdleWorkScheduler : NSObject
+
+/// The number of units of work that are waiting to be performed
+@property (nonatomic, assign, readonly) NSUInteger pendingWorkCount;
+
+/**
+ *  Initialize an instance of this class with a time budget
+ *
+ *  @param timeBudget The maximum amount of time (in seconds) to spend performing work in a single
+ *         run loop pass. At least one unit of work is always performed per pass.
+ */
+- (instancetype)initWithTimeBudget:(NSTimeInterval)timeBudget HUB_DESIGNATED_INITIALIZER;
+
+/**
+ *  Enqueue a unit of work to be performed once the main run loop is idle
+ *
+ *  @param work The block to perform. Should be small, since a unit of work is never interrupted.
+ */
+- (void)enqueueWork:(dispatch_block_t)work;
+
+/// Discard all work that has been enqueued but not yet performed
+- (void)cancelAllWork;
+
+@end
+
+NS_ASSUME_NONNULL_END
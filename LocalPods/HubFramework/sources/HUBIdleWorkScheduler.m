@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBIdleWorkScheduler.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBIdleWorkScheduler ()
+
+@property (nonatomic, assign, readonly) NSTimeInterval timeBudget;
+@property (nonatomic, strong, readonly) NSMutableArray<dispatch_block_t> *pendingWork;
+@property (nonatomic, assign, nullable) CFRunLoopObserverRef runLoopObserver;
+
+@end
+
+@implementation HUBIdleWorkScheduler
+
+- (instancetype)initWithTimeBudget:(NSTimeInterval)timeBudget
+{
+    NSParameterAssert(timeBudget > 0);
+    
+    self = [super init];
+    
+    if (self) {
+        _timeBudget = timeBudget;
+        _pendingWork = [NSMutableArray new];
+    }
+    
+    return self;
+}
+
+- (void)dealloc
+{
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    if (_runLoopObserver != NULL) {
+        CFRunLoopObserverInvalidate(_runLoopObserver);
+        CFRelease(_runLoopObserver);
+    }
+#pragma clang diagnostic pop
+}
+
+#pragma mark - API
+
+- (NSUInteger)pendingWorkCount
+{
+    return self.pendingWork.count;
+}
+
+- (void)enqueueWork:(dispatch_block_t)work
+{
+    NSAssert([NSThread isMainThread], @"Idle work can only be enqueued on the main thread");
+    
+    [self.pendingWork addObject:[work copy]];
+    [self startObservingRunLoopIfNeeded];
+}
+
+- (void)cancelAllWork
+{
+    [self.pendingWork removeAllObjects];
+    [self stopObservingRunLoop];
+}
+
+#pragma mark - Private utilities
+
+- (void)startObservingRunLoopIfNeeded
+{
+    if (self.runLoopObserver != NULL) {
+        return;
+    }
+    
+    __weak __typeof(self) weakSelf = self;
+    
+    CFRunLoopObserverRef const observer = CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault,
+                                                                             kCFRunLoopBeforeWaiting,
+                                                                             true,
+                                                                             0,
+                                                                             ^(CFRunLoopObserverRef observerRef, CFRunLoopActivity activity) {
+        __typeof(self) strongSelf = weakSelf;
+        [strongSelf performPendingWork];
+    });
+    
+    CFRunLoopAddObserver(CFRunLoopGetMain(), observer, kCFRunLoopCommonModes);
+    self.runLoopObserver = observer;
+}
+
+- (void)stopObservingRunLoop
+{
+    CFRunLoopObserverRef const observer = self.runLoopObserver;
+    
+    if (observer == NULL) {
+        return;
+    }
+    
+    CFRunLoopObserverInvalidate(observer);
+    CFRelease(observer);
+    self.runLoopObserver = NULL;
+}
+
+- (void)performPendingWork
+{
+    CFTimeInterval const deadline = CACurrentMediaTime() + self.timeBudget;
+    
+    do {
+        dispatch_block_t const work = self.pendingWork.firstObject;
+        
+        if (work == nil) {
+            break;
+        }
+        
+        [self.pendingWork removeObjectAtIndex:0];
+        work();
+    } while (CACurrentMediaTime() < deadline);
+    
+    if (self.pendingWork.count == 0) {
+        [self stopObservingRunLoop];
+        return;
+    }
+    
+    // Make sure the run loop spins again to continue with the remaining work, rather than going to sleep
+    CFRunLoopWakeUp(CFRunLoopGetMain());
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
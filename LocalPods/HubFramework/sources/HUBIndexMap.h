@@ -0,0 +1,68 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Mutable map from indexes to objects, for densely populated ranges of small indexes
+ *
+ *  Objects are stored in an array at their index, which makes lookups and mutations constant time, without having
+ *  to box each index into an `NSNumber` - like an `NSDictionary` keyed by indexes would require. Use this class for
+ *  lookups that are performed often, for example as part of scrolling, and that use indexes of child components.
+ *
+ *  The map supports subscripting, and setting `nil` for an index removes the object at that index.
+ */
+@interface HUBIndexMap<ObjectType> : NSObject
+
+/// The number of objects in the map
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ *  Return the object at a certain index, or nil if the map doesn't contain one
+ *
+ *  @param index The index to return an object for
+ */
+- (nullable ObjectType)objectAtIndexedSubscript:(NSUInteger)index;
+
+/**
+ *  Set the object at a certain index
+ *
+ *  @param object The object to set. Pass nil to remove any object at the index.
+ *  @param index The index to set the object at
+ */
+- (void)setObject:(nullable ObjectType)object atIndexedSubscript:(NSUInteger)index;
+
+/// Remove all objects from the map
+- (void)removeAllObjects;
+
+/**
+ *  Enumerate all indexes and objects of the map, in ascending index order
+ *
+ *  @param block The block to call for each index and object. The map may be mutated from within the block, in
+ *         which case objects that are added at higher indexes than the current one will also be enumerated.
+ */
+- (void)enumerateIndexesAndObjectsUsingBlock:(void (^)(NSUInteger index, ObjectType object, BOOL *stop))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,108 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBIndexMap.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBIndexMap ()
+
+@property (nonatomic, strong, readonly) NSMutableArray<id> *objects;
+@property (nonatomic, strong, readonly) NSMutableIndexSet *indexes;
+
+@end
+
+@implementation HUBIndexMap
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _objects = [NSMutableArray new];
+        _indexes = [NSMutableIndexSet new];
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (NSUInteger)count
+{
+    return self.indexes.count;
+}
+
+- (nullable id)objectAtIndexedSubscript:(NSUInteger)index
+{
+    if (index >= self.objects.count) {
+        return nil;
+    }
+    
+    id const object = self.objects[index];
+    return (object == [NSNull null]) ? nil : object;
+}
+
+- (void)setObject:(nullable id)object atIndexedSubscript:(NSUInteger)index
+{
+    NSMutableArray<id> * const objects = self.objects;
+    
+    if (object == nil) {
+        if (index < objects.count) {
+            objects[index] = [NSNull null];
+            [self.indexes removeIndex:index];
+        }
+        
+        return;
+    }
+    
+    while (objects.count <= index) {
+        [objects addObject:[NSNull null]];
+    }
+    
+    objects[index] = object;
+    [self.indexes addIndex:index];
+}
+
+- (void)removeAllObjects
+{
+    [self.objects removeAllObjects];
+    [self.indexes removeAllIndexes];
+}
+
+- (void)enumerateIndexesAndObjectsUsingBlock:(void (^)(NSUInteger index, id object, BOOL *stop))block
+{
+    // The next index is looked up in the live index set after each call, so that the block can mutate the map
+    NSMutableIndexSet * const indexes = self.indexes;
+    BOOL stop = NO;
+    
+    for (NSUInteger index = indexes.firstIndex; index != NSNotFound; index = [indexes indexGreaterThanIndex:index]) {
+        block(index, self.objects[index], &stop);
+        
+        if (stop) {
+            return;
+        }
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,61 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+@protocol HUBJSONPath;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Plan for extracting the values of a set of JSON paths from a dictionary in a single pass
+ *
+ *  The parsing operations of the paths are merged into a tree, so that operations that several paths have in common
+ *  (because they were created from the same base path) are only performed once per dictionary, no matter how many of
+ *  the paths that contain them. Paths that were not created by the Hub Framework are evaluated one by one.
+ *
+ *  A plan is immutable, and can be used from any thread.
+ */
+@interface HUBJSONExtractionPlan : NSObject
+
+/// The paths that this plan was compiled from
+@property (nonatomic, copy, readonly) NSArray<id<HUBJSONPath>> *paths;
+
+/**
+ *  Initialize an instance of this class by compiling a set of paths
+ *
+ *  @param paths The paths to compile into a plan
+ */
+- (instancetype)initWithPaths:(NSArray<id<HUBJSONPath>> *)paths HUB_DESIGNATED_INITIALIZER;
+
+/**
+ *  Extract the values of all of this plan's paths from a JSON dictionary
+ *
+ *  @param dictionary The JSON dictionary to extract values from
+ *
+ *  @return An array with the same count as `paths`, that for each path contains the values that the path's own
+ *          `valuesFromJSONDictionary:` method would have returned.
+ */
+- (NSArray<NSArray<NSObject *> *> *)valuesFromJSONDictionary:(NSDictionary<NSString *, NSObject *> *)dictionary;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,181 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBJSONExtractionPlan.h"
+
+#import "HUBJSONPathImplementation.h"
+#import "HUBJSONParsingOperation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A node in the tree of parsing operations of an extraction plan
+@interface HUBJSONExtractionPlanNode : NSObject
+
+/// The operation to perform on the values produced by the parent node. Nil for the root node.
+@property (nonatomic, strong, nullable) HUBJSONParsingOperation *operation;
+
+/// The nodes that should be evaluated using the values produced by this node
+@property (nonatomic, strong, readonly) NSMutableArray<HUBJSONExtractionPlanNode *> *children;
+
+/// The indexes of the paths that end at this node, and that therefore produce the values of this node
+@property (nonatomic, strong, readonly) NSMutableIndexSet *pathIndexes;
+
+@end
+
+@implementation HUBJSONExtractionPlanNode
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _children = [NSMutableArray new];
+        _pathIndexes = [NSMutableIndexSet new];
+    }
+    
+    return self;
+}
+
+- (HUBJSONExtractionPlanNode *)childForOperation:(HUBJSONParsingOperation *)operation
+{
+    for (HUBJSONExtractionPlanNode * const child in self.children) {
+        if (child.operation == operation) {
+            return child;
+        }
+    }
+    
+    HUBJSONExtractionPlanNode * const child = [HUBJSONExtractionPlanNode new];
+    child.operation = operation;
+    [self.children addObject:child];
+    return child;
+}
+
+@end
+
+@interface HUBJSONExtractionPlan ()
+
+@property (nonatomic, strong, readonly) HUBJSONExtractionPlanNode *rootNode;
+@property (nonatomic, strong, readonly) NSIndexSet *separatelyEvaluatedPathIndexes;
+
+@end
+
+@implementation HUBJSONExtractionPlan
+
+- (instancetype)initWithPaths:(NSArray<id<HUBJSONPath>> *)paths
+{
+    NSParameterAssert(paths != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _paths = [paths copy];
+        _rootNode = [HUBJSONExtractionPlanNode new];
+        
+        NSMutableIndexSet * const separatelyEvaluatedPathIndexes = [NSMutableIndexSet new];
+        
+        [_paths enumerateObjectsUsingBlock:^(id<HUBJSONPath> path, NSUInteger pathIndex, BOOL *stop) {
+            if (![path isKindOfClass:[HUBJSONPathImplementation class]]) {
+                [separatelyEvaluatedPathIndexes addIndex:pathIndex];
+                return;
+            }
+            
+            HUBJSONExtractionPlanNode *node = self.rootNode;
+            
+            for (HUBJSONParsingOperation * const operation in ((HUBJSONPathImplementation *)path).parsingOperations) {
+                node = [node childForOperation:operation];
+            }
+            
+            [node.pathIndexes addIndex:pathIndex];
+        }];
+        
+        _separatelyEvaluatedPathIndexes = [separatelyEvaluatedPathIndexes copy];
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (NSArray<NSArray<NSObject *> *> *)valuesFromJSONDictionary:(NSDictionary<NSString *, NSObject *> *)dictionary
+{
+    NSUInteger const pathCount = self.paths.count;
+    NSMutableArray<NSArray<NSObject *> *> * const values = [NSMutableArray arrayWithCapacity:pathCount];
+    
+    for (NSUInteger index = 0; index < pathCount; index++) {
+        [values addObject:@[]];
+    }
+    
+    [self evaluateNode:self.rootNode withInputValues:@[dictionary] values:values];
+    
+    [self.separatelyEvaluatedPathIndexes enumerateIndexesUsingBlock:^(NSUInteger pathIndex, BOOL *stop) {
+        values[pathIndex] = [self.paths[pathIndex] valuesFromJSONDictionary:dictionary];
+    }];
+    
+    return values;
+}
+
+#pragma mark - Private utilities
+
+- (void)evaluateNode:(HUBJSONExtractionPlanNode *)node
+     withInputValues:(NSArray<NSObject *> *)inputValues
+              values:(NSMutableArray<NSArray<NSObject *> *> *)values
+{
+    [node.pathIndexes enumerateIndexesUsingBlock:^(NSUInteger pathIndex, BOOL *stop) {
+        values[pathIndex] = inputValues;
+    }];
+    
+    for (HUBJSONExtractionPlanNode * const child in node.children) {
+        HUBJSONParsingOperation * const operation = child.operation;
+        NSArray<NSObject *> * const outputValues = [self valuesByPerformingParsingOperation:operation withInputValues:inputValues];
+        
+        // Operations never produce any values from an empty input, so the whole branch can be skipped
+        if (outputValues.count == 0) {
+            continue;
+        }
+        
+        [self evaluateNode:child withInputValues:outputValues values:values];
+    }
+}
+
+- (NSArray<NSObject *> *)valuesByPerformingParsingOperation:(HUBJSONParsingOperation *)operation
+                                            withInputValues:(NSArray<NSObject *> *)inputValues
+{
+    // Most operations are performed on a single value, in which case their output can be used as-is
+    if (inputValues.count == 1) {
+        return [operation parsedValuesForInput:inputValues[0]] ?: @[];
+    }
+    
+    NSMutableArray<NSObject *> * const outputValues = [NSMutableArray new];
+    
+    for (NSObject * const value in inputValues) {
+        NSArray<NSObject *> * const operationOutput = [operation parsedValuesForInput:value];
+        
+        if (operationOutput != nil) {
+            [outputValues addObjectsFromArray:operationOutput];
+        }
+    }
+    
+    return outputValues;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -35,6 +35,9 @@ NS_ASSUME_NONNULL_BEGIN
     HUBJSONDictionaryPath
 >
 
+/// The parsing operations that this path consists of, performed in order
+@property (nonatomic, strong, readonly) NSArray<HUBJSONParsingOperation *> *parsingOperations;
+
 /**
  *  Initialize an instance of this class with an array of parsing operations
  *
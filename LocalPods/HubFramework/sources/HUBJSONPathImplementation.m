@@ -26,12 +26,6 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
-@interface HUBJSONPathImplementation ()
-
-@property (nonatomic, strong, readonly) NSArray<HUBJSONParsingOperation *> *parsingOperations;
-
-@end
-
 @implementation HUBJSONPathImplementation
 
 - (instancetype)initWithParsingOperations:(NSArray<HUBJSONParsingOperation *> *)parsingOperations
@@ -29,7 +29,7 @@ NS_ASSUME_NONNULL_BEGIN
 /// Content operation used by the Hub Framework Live service.
 @interface HUBLiveContentOperation : NSObject <HUBContentOperation>
 
-/// The JSON data that should be render. When set, the content operation will reschedule itself.
+/// The JSON data that should be render, which may be gzip or zlib compressed. When set, the content operation will reschedule itself.
 @property (nonatomic, strong) NSData *JSONData;
 
 /**
@@ -39,6 +39,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)initWithJSONData:(NSData *)JSONData HUB_DESIGNATED_INITIALIZER;
 
+/**
+ *  Apply a JSON patch to the current JSON data
+ *
+ *  @param patch An array of JSON patch (RFC 6902) operations, to apply to the current JSON document
+ *  @param error Set to an error describing the problem if the patch couldn't be applied
+ *
+ *  Supported operations are `add`, `remove`, `replace`, `move`, `copy` and `test`, and all pointers must
+ *  either be empty or start with `/`. The patch is applied to the parsed document in place, without the
+ *  document being re-encoded, and the content operation then reschedules itself. View model builders are
+ *  passed an immutable copy of the document, made once after each patch. If an operation fails, any
+ *  preceding operations in the same patch remain applied, but the content operation isn't rescheduled.
+ *
+ *  @return `YES` if the whole patch was applied, otherwise `NO`
+ */
+- (BOOL)applyJSONPatch:(NSArray *)patch error:(NSError **)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,409 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBLiveContentOperation.h"
+
+#import "HUBViewModelBuilder.h"
+#import "HUBDataCompression.h"
+
+#if HUB_DEBUG
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Split a JSON pointer (RFC 6901) into its unescaped reference tokens, returning nil if it's not a valid pointer
+static NSArray<NSString *> * _Nullable HUBLiveJSONPointerTokens(NSString *pointer)
+{
+    if (pointer.length == 0) {
+        return @[];
+    }
+    
+    // Apart from the empty pointer to the whole document, every pointer starts with a reference token
+    if (![pointer hasPrefix:@"/"]) {
+        return nil;
+    }
+    
+    NSArray<NSString *> * const components = [[pointer substringFromIndex:1] componentsSeparatedByString:@"/"];
+    NSMutableArray<NSString *> * const tokens = [NSMutableArray arrayWithCapacity:components.count];
+    
+    for (NSString * const component in components) {
+        NSString * const token = [[component stringByReplacingOccurrencesOfString:@"~1" withString:@"/"]
+                                  stringByReplacingOccurrencesOfString:@"~0" withString:@"~"];
+        [tokens addObject:token];
+    }
+    
+    return tokens;
+}
+
+/// Parse an array index reference token, returning `NSNotFound` if it's not a valid index
+static NSUInteger HUBLiveJSONArrayIndex(NSString *token)
+{
+    if (token.length == 0 || [token rangeOfCharacterFromSet:[[NSCharacterSet decimalDigitCharacterSet] invertedSet]].location != NSNotFound) {
+        return NSNotFound;
+    }
+    
+    return (NSUInteger)token.integerValue;
+}
+
+/// Return the child of a JSON container for a reference token, or nil if there is none
+static id _Nullable HUBLiveJSONChild(id _Nullable container, NSString *token)
+{
+    if ([container isKindOfClass:[NSDictionary class]]) {
+        return ((NSDictionary *)container)[token];
+    }
+    
+    if ([container isKindOfClass:[NSArray class]]) {
+        NSArray * const array = container;
+        NSUInteger const index = HUBLiveJSONArrayIndex(token);
+        return (index < array.count) ? array[index] : nil;
+    }
+    
+    return nil;
+}
+
+/// Make a deep, mutable copy of a JSON value, so that it can be patched further
+static id HUBLiveMutableJSONCopy(id value)
+{
+    if ([value isKindOfClass:[NSDictionary class]]) {
+        NSDictionary * const dictionary = value;
+        NSMutableDictionary * const copy = [NSMutableDictionary dictionaryWithCapacity:dictionary.count];
+        
+        for (id const key in dictionary) {
+            copy[key] = HUBLiveMutableJSONCopy(dictionary[key]);
+        }
+        
+        return copy;
+    }
+    
+    if ([value isKindOfClass:[NSArray class]]) {
+        NSMutableArray * const copy = [NSMutableArray arrayWithCapacity:[(NSArray *)value count]];
+        
+        for (id const element in (NSArray *)value) {
+            [copy addObject:HUBLiveMutableJSONCopy(element)];
+        }
+        
+        return copy;
+    }
+    
+    return value;
+}
+
+/// Make a deep, immutable copy of a JSON value, so that later patches can't mutate what was passed to a builder
+static id HUBLiveImmutableJSONCopy(id value)
+{
+    if ([value isKindOfClass:[NSDictionary class]]) {
+        NSDictionary * const dictionary = value;
+        NSMutableDictionary * const copy = [NSMutableDictionary dictionaryWithCapacity:dictionary.count];
+        
+        for (id const key in dictionary) {
+            copy[key] = HUBLiveImmutableJSONCopy(dictionary[key]);
+        }
+        
+        return [copy copy];
+    }
+    
+    if ([value isKindOfClass:[NSArray class]]) {
+        NSMutableArray * const copy = [NSMutableArray arrayWithCapacity:[(NSArray *)value count]];
+        
+        for (id const element in (NSArray *)value) {
+            [copy addObject:HUBLiveImmutableJSONCopy(element)];
+        }
+        
+        return [copy copy];
+    }
+    
+    return value;
+}
+
+static NSString * const HUBLiveJSONPatchErrorDomain = @"spotify.com.hubFramework.invalidJSONPatch";
+
+@interface HUBLiveContentOperation ()
+
+/// The parsed, mutable JSON document that patches are applied to. Lazily created from `JSONData`.
+@property (nonatomic, strong, nullable) NSMutableDictionary *JSONDocument;
+
+/// An immutable copy of `JSONDocument` that is passed to view model builders. Reset whenever a patch is applied.
+@property (nonatomic, copy, nullable) NSDictionary *JSONDocumentSnapshot;
+
+@end
+
+@implementation HUBLiveContentOperation
+
+@synthesize delegate = _delegate;
+
+#pragma mark - Initializer
+
+- (instancetype)initWithJSONData:(NSData *)JSONData
+{
+    NSParameterAssert(JSONData != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _JSONData = JSONData;
+    }
+    
+    return self;
+}
+
+#pragma mark - Property overrides
+
+- (void)setJSONData:(NSData *)JSONData
+{
+    _JSONData = JSONData;
+    self.JSONDocument = nil;
+    self.JSONDocumentSnapshot = nil;
+    [self.delegate contentOperationRequiresRescheduling:self];
+}
+
+#pragma mark - API
+
+- (BOOL)applyJSONPatch:(NSArray *)patch error:(NSError **)error
+{
+    if (self.JSONDocument == nil) {
+        NSData * const JSONData = HUBDecompressDataIfNeeded(self.JSONData, error);
+        
+        if (JSONData == nil) {
+            return NO;
+        }
+        
+        id const document = [NSJSONSerialization JSONObjectWithData:JSONData options:NSJSONReadingMutableContainers error:error];
+        
+        if (![document isKindOfClass:[NSMutableDictionary class]]) {
+            return [self failWithReason:@"The current JSON data is not a dictionary" error:error];
+        }
+        
+        self.JSONDocument = document;
+    }
+    
+    // The document may be partially patched even if an operation fails, so the snapshot is stale either way
+    self.JSONDocumentSnapshot = nil;
+    
+    for (NSDictionary * const operation in patch) {
+        if (![operation isKindOfClass:[NSDictionary class]]) {
+            return [self failWithReason:@"Patch operations must be dictionaries" error:error];
+        }
+        
+        if (![self applyJSONPatchOperation:operation error:error]) {
+            return NO;
+        }
+    }
+    
+    [self.delegate contentOperationRequiresRescheduling:self];
+    return YES;
+}
+
+#pragma mark - HUBContentOperation
+
+- (void)performForViewURI:(NSURL *)viewURI
+              featureInfo:(id<HUBFeatureInfo>)featureInfo
+        connectivityState:(HUBConnectivityState)connectivityState
+         viewModelBuilder:(id<HUBViewModelBuilder>)viewModelBuilder
+            previousError:(nullable NSError *)previousError
+{
+    if (self.JSONDocument != nil && self.JSONDocumentSnapshot == nil) {
+        self.JSONDocumentSnapshot = HUBLiveImmutableJSONCopy(self.JSONDocument);
+    }
+    
+    NSDictionary * const JSONDocumentSnapshot = self.JSONDocumentSnapshot;
+    
+    if (JSONDocumentSnapshot != nil) {
+        [viewModelBuilder addJSONDictionary:JSONDocumentSnapshot];
+    } else {
+        [viewModelBuilder addJSONData:self.JSONData error:nil];
+    }
+    
+    [self.delegate contentOperationDidFinish:self];
+}
+
+#pragma mark - Private utilities
+
+- (BOOL)applyJSONPatchOperation:(NSDictionary *)operation error:(NSError **)error
+{
+    NSString * const op = operation[@"op"];
+    NSString * const path = operation[@"path"];
+    
+    if (![op isKindOfClass:[NSString class]] || ![path isKindOfClass:[NSString class]]) {
+        return [self failWithReason:@"Patch operations require an op and a path" error:error];
+    }
+    
+    if (HUBLiveJSONPointerTokens(path) == nil) {
+        return [self failWithReason:[NSString stringWithFormat:@"Invalid JSON pointer %@", path] error:error];
+    }
+    
+    if ([op isEqualToString:@"add"] || [op isEqualToString:@"replace"] || [op isEqualToString:@"test"]) {
+        id const value = operation[@"value"];
+        
+        if (value == nil) {
+            return [self failWithReason:[NSString stringWithFormat:@"'%@' requires a value", op] error:error];
+        }
+        
+        if ([op isEqualToString:@"test"]) {
+            if (![[self valueAtPointer:path] isEqual:value]) {
+                return [self failWithReason:[NSString stringWithFormat:@"Test failed at %@", path] error:error];
+            }
+            
+            return YES;
+        }
+        
+        return [self setValue:HUBLiveMutableJSONCopy(value) atPointer:path replace:[op isEqualToString:@"replace"] error:error];
+    }
+    
+    if ([op isEqualToString:@"remove"]) {
+        return [self removeValueAtPointer:path error:error] != nil;
+    }
+    
+    if ([op isEqualToString:@"move"] || [op isEqualToString:@"copy"]) {
+        NSString * const from = operation[@"from"];
+        
+        if (![from isKindOfClass:[NSString class]] || HUBLiveJSONPointerTokens(from) == nil) {
+            return [self failWithReason:[NSString stringWithFormat:@"'%@' requires a valid from pointer", op] error:error];
+        }
+        
+        id value = nil;
+        
+        if ([op isEqualToString:@"move"]) {
+            value = [self removeValueAtPointer:from error:error];
+        } else {
+            id const sourceValue = [self valueAtPointer:from];
+            value = (sourceValue != nil) ? HUBLiveMutableJSONCopy(sourceValue) : nil;
+        }
+        
+        if (value == nil) {
+            return [self failWithReason:[NSString stringWithFormat:@"No value at %@", from] error:error];
+        }
+        
+        return [self setValue:value atPointer:path replace:NO error:error];
+    }
+    
+    return [self failWithReason:[NSString stringWithFormat:@"Unsupported op '%@'", op] error:error];
+}
+
+- (nullable id)valueAtPointer:(NSString *)pointer
+{
+    id value = self.JSONDocument;
+    
+    for (NSString * const token in HUBLiveJSONPointerTokens(pointer)) {
+        value = HUBLiveJSONChild(value, token);
+    }
+    
+    return value;
+}
+
+- (BOOL)setValue:(id)value atPointer:(NSString *)pointer replace:(BOOL)replace error:(NSError **)error
+{
+    NSArray<NSString *> * const tokens = HUBLiveJSONPointerTokens(pointer);
+    
+    if (tokens.count == 0) {
+        if (![value isKindOfClass:[NSMutableDictionary class]]) {
+            return [self failWithReason:@"The document root must be a dictionary" error:error];
+        }
+        
+        self.JSONDocument = value;
+        return YES;
+    }
+    
+    id const parent = [self containerForTokens:tokens];
+    NSString * const token = tokens.lastObject;
+    
+    if ([parent isKindOfClass:[NSMutableDictionary class]]) {
+        NSMutableDictionary * const dictionary = parent;
+        
+        if (replace && dictionary[token] == nil) {
+            return [self failWithReason:[NSString stringWithFormat:@"No value to replace at %@", pointer] error:error];
+        }
+        
+        dictionary[token] = value;
+        return YES;
+    }
+    
+    if ([parent isKindOfClass:[NSMutableArray class]]) {
+        NSMutableArray * const array = parent;
+        NSUInteger const index = [token isEqualToString:@"-"] ? array.count : HUBLiveJSONArrayIndex(token);
+        
+        if (replace && index < array.count) {
+            array[index] = value;
+            return YES;
+        }
+        
+        if (!replace && index <= array.count) {
+            [array insertObject:value atIndex:index];
+            return YES;
+        }
+    }
+    
+    return [self failWithReason:[NSString stringWithFormat:@"Invalid path %@", pointer] error:error];
+}
+
+- (nullable id)removeValueAtPointer:(NSString *)pointer error:(NSError **)error
+{
+    NSArray<NSString *> * const tokens = HUBLiveJSONPointerTokens(pointer);
+    id const parent = (tokens.count > 0) ? [self containerForTokens:tokens] : nil;
+    NSString * const token = tokens.lastObject;
+    id value = nil;
+    
+    if ([parent isKindOfClass:[NSMutableDictionary class]]) {
+        NSMutableDictionary * const dictionary = parent;
+        value = dictionary[token];
+        dictionary[token] = nil;
+    } else if ([parent isKindOfClass:[NSMutableArray class]]) {
+        NSMutableArray * const array = parent;
+        NSUInteger const index = HUBLiveJSONArrayIndex(token);
+        
+        if (index < array.count) {
+            value = array[index];
+            [array removeObjectAtIndex:index];
+        }
+    }
+    
+    if (value == nil) {
+        [self failWithReason:[NSString stringWithFormat:@"No value to remove at %@", pointer] error:error];
+    }
+    
+    return value;
+}
+
+- (nullable id)containerForTokens:(NSArray<NSString *> *)tokens
+{
+    id container = self.JSONDocument;
+    
+    for (NSUInteger index = 0; index + 1 < tokens.count; index++) {
+        container = HUBLiveJSONChild(container, tokens[index]);
+    }
+    
+    return container;
+}
+
+- (BOOL)failWithReason:(NSString *)reason error:(NSError **)error
+{
+    if (error != NULL) {
+        *error = [NSError errorWithDomain:HUBLiveJSONPatchErrorDomain
+                                     code:0
+                                 userInfo:@{NSLocalizedDescriptionKey: reason}];
+    }
+    
+    return NO;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // DEBUG
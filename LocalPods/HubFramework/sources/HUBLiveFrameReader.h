@@ -0,0 +1,89 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+#if HUB_DEBUG
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The types of frames that the `hublive` application can send to the live service
+typedef NS_ENUM(uint8_t, HUBLiveFrameType) {
+    /// The frame contains a complete JSON document, replacing any previous one
+    HUBLiveFrameTypeDocument = 1,
+    /// The frame contains a JSON patch (RFC 6902) array, to be applied to the current JSON document
+    HUBLiveFrameTypePatch = 2
+};
+
+/// The maximum payload length of a single frame, in bytes
+static uint32_t const HUBLiveFrameMaximumPayloadLength = 64 * 1024 * 1024;
+
+/**
+ *  Class used to split data received by the live service into frames
+ *
+ *  Each frame starts with a 5 byte header: the length of the payload as a big-endian 32 bit integer,
+ *  followed by one byte containing the `HUBLiveFrameType` of the frame. The payload then follows.
+ *
+ *  For compatibility with older versions of `hublive`, a connection that starts with a `{` character
+ *  is treated as a stream of unframed JSON documents, optionally separated by whitespace. The end of a
+ *  document is found by tracking its nesting as data arrives, scanning each received byte once, and the
+ *  document is then returned without being parsed. Unframed streams don't support patches.
+ *
+ *  This class doesn't depend on any particular stream implementation, so one instance should be used
+ *  for each connection, with all received data appended to it as it arrives.
+ */
+@interface HUBLiveFrameReader : NSObject
+
+/// Whether the received data was malformed. Once this is `YES`, no more frames will be returned.
+@property (nonatomic, assign, readonly) BOOL failed;
+
+/**
+ *  Append data that was received from the connection
+ *
+ *  @param bytes The received bytes
+ *  @param length The number of received bytes
+ */
+- (void)appendBytes:(const void *)bytes length:(NSUInteger)length;
+
+/**
+ *  Read bytes from a stream straight into the reader's buffer, until the stream has no bytes available
+ *
+ *  @param stream The stream to read from
+ *
+ *  @return The number of bytes read, or -1 if the stream returned an error
+ */
+- (NSInteger)appendBytesFromStream:(NSInputStream *)stream;
+
+/**
+ *  Return the payload of the next complete frame, if one has been received
+ *
+ *  @param outType Will be set to the type of the returned frame
+ *
+ *  The returned payload is removed from the reader. Returns nil if no complete frame is available yet,
+ *  or if the received data was malformed (in which case `failed` is set to `YES`).
+ */
+- (nullable NSData *)nextFramePayloadWithType:(HUBLiveFrameType *)outType;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // DEBUG
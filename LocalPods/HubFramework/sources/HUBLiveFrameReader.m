@@ -0,0 +1,262 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBLiveFrameReader.h"
+
+#if HUB_DEBUG
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSUInteger const HUBLiveFrameHeaderLength = 5;
+static NSUInteger const HUBLiveFrameReaderReadChunkSize = 64 * 1024;
+
+/// Return whether a byte is JSON whitespace, which may separate unframed documents
+static BOOL HUBLiveFrameReaderIsWhitespace(uint8_t byte)
+{
+    return byte == ' ' || byte == '\t' || byte == '\n' || byte == '\r';
+}
+
+typedef NS_ENUM(NSUInteger, HUBLiveFrameReaderMode) {
+    HUBLiveFrameReaderModeUndetermined,
+    HUBLiveFrameReaderModeFramed,
+    HUBLiveFrameReaderModeUnframed
+};
+
+@interface HUBLiveFrameReader ()
+
+@property (nonatomic, strong, readonly) NSMutableData *buffer;
+@property (nonatomic, assign) NSUInteger readOffset;
+@property (nonatomic, assign) HUBLiveFrameReaderMode mode;
+@property (nonatomic, assign, readwrite) BOOL failed;
+
+/// The offset in `buffer` up to which the current unframed document has been scanned
+@property (nonatomic, assign) NSUInteger unframedScanOffset;
+/// The number of objects and arrays that are open at `unframedScanOffset`. Zero between documents.
+@property (nonatomic, assign) NSUInteger unframedNestingDepth;
+/// Whether `unframedScanOffset` is inside a string
+@property (nonatomic, assign) BOOL unframedScanIsInString;
+/// Whether the byte before `unframedScanOffset` was an escaping backslash inside a string
+@property (nonatomic, assign) BOOL unframedScanIsEscaped;
+
+@end
+
+@implementation HUBLiveFrameReader
+
+#pragma mark - Initializer
+
+- (instancetype)init
+{
+    self = [super init];
+    
+    if (self) {
+        _buffer = [NSMutableData new];
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (void)appendBytes:(const void *)bytes length:(NSUInteger)length
+{
+    [self.buffer appendBytes:bytes length:length];
+}
+
+- (NSInteger)appendBytesFromStream:(NSInputStream *)stream
+{
+    NSInteger totalBytesRead = 0;
+    
+    while (stream.hasBytesAvailable) {
+        NSUInteger const previousLength = self.buffer.length;
+        [self.buffer increaseLengthBy:HUBLiveFrameReaderReadChunkSize];
+        
+        uint8_t * const destination = (uint8_t *)self.buffer.mutableBytes + previousLength;
+        NSInteger const bytesRead = [stream read:destination maxLength:HUBLiveFrameReaderReadChunkSize];
+        
+        self.buffer.length = previousLength + (NSUInteger)MAX(bytesRead, 0);
+        
+        if (bytesRead < 0) {
+            return -1;
+        }
+        
+        if (bytesRead == 0) {
+            break;
+        }
+        
+        totalBytesRead += bytesRead;
+    }
+    
+    return totalBytesRead;
+}
+
+- (nullable NSData *)nextFramePayloadWithType:(HUBLiveFrameType *)outType
+{
+    if (self.failed) {
+        return nil;
+    }
+    
+    NSUInteger const availableLength = self.buffer.length - self.readOffset;
+    
+    if (availableLength == 0) {
+        return nil;
+    }
+    
+    const uint8_t * const bytes = (const uint8_t *)self.buffer.bytes + self.readOffset;
+    
+    if (self.mode == HUBLiveFrameReaderModeUndetermined) {
+        self.mode = (bytes[0] == '{') ? HUBLiveFrameReaderModeUnframed : HUBLiveFrameReaderModeFramed;
+    }
+    
+    if (self.mode == HUBLiveFrameReaderModeUnframed) {
+        return [self nextUnframedDocumentWithType:outType];
+    }
+    
+    if (availableLength < HUBLiveFrameHeaderLength) {
+        return nil;
+    }
+    
+    uint32_t const payloadLength = ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+    uint8_t const type = bytes[4];
+    
+    if (payloadLength > HUBLiveFrameMaximumPayloadLength || (type != HUBLiveFrameTypeDocument && type != HUBLiveFrameTypePatch)) {
+        self.failed = YES;
+        return nil;
+    }
+    
+    if (availableLength - HUBLiveFrameHeaderLength < payloadLength) {
+        return nil;
+    }
+    
+    NSData * const payload = [NSData dataWithBytes:bytes + HUBLiveFrameHeaderLength length:payloadLength];
+    [self consumeBytes:HUBLiveFrameHeaderLength + payloadLength];
+    
+    *outType = (HUBLiveFrameType)type;
+    return payload;
+}
+
+#pragma mark - Private utilities
+
+- (nullable NSData *)nextUnframedDocumentWithType:(HUBLiveFrameType *)outType
+{
+    if (self.unframedNestingDepth == 0) {
+        if (![self skipToNextUnframedDocument]) {
+            return nil;
+        }
+        
+        self.unframedScanOffset = self.readOffset;
+    }
+    
+    // Older versions of hublive don't delimit documents, so find where the current one ends. Only the bytes received
+    // since the previous call are scanned, and only strings and nesting are tracked, since the document is parsed later.
+    const uint8_t * const bytes = self.buffer.bytes;
+    NSUInteger const length = self.buffer.length;
+    NSUInteger scanOffset = self.unframedScanOffset;
+    NSUInteger nestingDepth = self.unframedNestingDepth;
+    BOOL inString = self.unframedScanIsInString;
+    BOOL escaped = self.unframedScanIsEscaped;
+    
+    while (scanOffset < length && (nestingDepth > 0 || scanOffset == self.readOffset)) {
+        uint8_t const byte = bytes[scanOffset];
+        scanOffset++;
+        
+        if (inString) {
+            if (escaped) {
+                escaped = NO;
+            } else if (byte == '\\') {
+                escaped = YES;
+            } else if (byte == '"') {
+                inString = NO;
+            }
+        } else if (byte == '"') {
+            inString = YES;
+        } else if (byte == '{' || byte == '[') {
+            nestingDepth++;
+        } else if (byte == '}' || byte == ']') {
+            nestingDepth--;
+        }
+    }
+    
+    self.unframedScanOffset = scanOffset;
+    self.unframedNestingDepth = nestingDepth;
+    self.unframedScanIsInString = inString;
+    self.unframedScanIsEscaped = escaped;
+    
+    NSUInteger const documentLength = scanOffset - self.readOffset;
+    
+    if (nestingDepth > 0) {
+        if (documentLength > HUBLiveFrameMaximumPayloadLength) {
+            self.failed = YES;
+        }
+        
+        return nil;
+    }
+    
+    NSData * const document = [NSData dataWithBytes:bytes + self.readOffset length:documentLength];
+    [self consumeBytes:documentLength];
+    
+    *outType = HUBLiveFrameTypeDocument;
+    return document;
+}
+
+/// Skip whitespace up to the start of the next unframed document, returning whether one has started
+- (BOOL)skipToNextUnframedDocument
+{
+    const uint8_t * const bytes = self.buffer.bytes;
+    NSUInteger const length = self.buffer.length;
+    NSUInteger offset = self.readOffset;
+    
+    while (offset < length && HUBLiveFrameReaderIsWhitespace(bytes[offset])) {
+        offset++;
+    }
+    
+    [self consumeBytes:offset - self.readOffset];
+    
+    if (self.readOffset == self.buffer.length) {
+        return NO;
+    }
+    
+    if (((const uint8_t *)self.buffer.bytes)[self.readOffset] != '{') {
+        self.failed = YES;
+        return NO;
+    }
+    
+    return YES;
+}
+
+- (void)consumeBytes:(NSUInteger)length
+{
+    self.readOffset += length;
+    
+    if (self.readOffset == self.buffer.length) {
+        self.buffer.length = 0;
+        self.readOffset = 0;
+    } else if (self.readOffset > HUBLiveFrameReaderReadChunkSize && self.readOffset > self.buffer.length / 2) {
+        // Compact the buffer once the consumed prefix dominates it, so that it doesn't grow indefinitely
+        [self.buffer replaceBytesInRange:NSMakeRange(0, self.readOffset) withBytes:NULL length:0];
+        self.readOffset = 0;
+    }
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif // DEBUG
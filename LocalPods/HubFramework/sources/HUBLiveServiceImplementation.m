@@ -23,16 +23,21 @@
 
 #import "HUBViewControllerFactory.h"
 #import "HUBLiveContentOperation.h"
+#import "HUBLiveFrameReader.h"
+#import "HUBDataCompression.h"
 
 #if HUB_DEBUG
 
 NS_ASSUME_NONNULL_BEGIN
 
+static NSString * const HUBLiveServiceErrorDomain = @"spotify.com.hubFramework.liveService";
+
 @interface HUBLiveServiceImplementation () <NSNetServiceDelegate, NSStreamDelegate>
 
 @property (nonatomic, strong, readwrite, nullable) NSNetService *netService;
 @property (nonatomic, strong, readonly) id<HUBViewControllerFactory> viewControllerFactory;
 @property (nonatomic, strong, nullable) NSInputStream *stream;
+@property (nonatomic, strong, nullable) HUBLiveFrameReader *frameReader;
 @property (nonatomic, weak, nullable) HUBViewController *viewController;
 @property (nonatomic, strong, nullable) HUBLiveContentOperation *contentOperation;
 
@@ -89,7 +94,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)netService:(NSNetService *)sender didAcceptConnectionWithInputStream:(NSInputStream *)inputStream outputStream:(NSOutputStream *)outputStream
 {
+    [self closeStream];
+    
     self.stream = inputStream;
+    self.frameReader = [HUBLiveFrameReader new];
     self.stream.delegate = self;
     [self.stream open];
     [self.stream scheduleInRunLoop:[NSRunLoop currentRunLoop] forMode:NSRunLoopCommonModes];
@@ -118,17 +126,37 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)handleBytesAvailableForStream:(NSInputStream *)stream
 {
-    NSMutableData * const mutableData = [NSMutableData new];
-    NSUInteger const bufferSize = 1024;
+    HUBLiveFrameReader * const frameReader = self.frameReader;
     
-    while (stream.hasBytesAvailable) {
-        uint8_t buffer[bufferSize];
-        NSInteger const bytesRead = [stream read:buffer maxLength:bufferSize];
-        [mutableData appendBytes:buffer length:(NSUInteger)bytesRead];
+    if ([frameReader appendBytesFromStream:stream] < 0) {
+        [self closeStream];
+        return;
     }
     
-    NSData * const data = [mutableData copy];
+    HUBLiveFrameType frameType = HUBLiveFrameTypeDocument;
+    NSData *payload = nil;
+    
+    while ((payload = [frameReader nextFramePayloadWithType:&frameType]) != nil) {
+        switch (frameType) {
+            case HUBLiveFrameTypeDocument:
+                [self handleDocumentData:payload];
+                break;
+            case HUBLiveFrameTypePatch:
+                if (![self handlePatchData:payload]) {
+                    [self closeStream];
+                    return;
+                }
+                break;
+        }
+    }
     
+    if (frameReader.failed) {
+        [self closeStream];
+    }
+}
+
+- (void)handleDocumentData:(NSData *)data
+{
     if (self.viewController != nil && self.contentOperation != nil) {
         self.contentOperation.JSONData = data;
         return;
@@ -148,10 +176,42 @@ NS_ASSUME_NONNULL_BEGIN
     [self.delegate liveService:self didCreateViewController:viewController];
 }
 
+- (BOOL)handlePatchData:(NSData *)data
+{
+    // Patches can only be applied on top of a document that is currently being rendered
+    if (self.viewController == nil || self.contentOperation == nil) {
+        return YES;
+    }
+    
+    NSError *error = nil;
+    NSData * const JSONData = HUBDecompressDataIfNeeded(data, &error);
+    id const patch = (JSONData != nil) ? [NSJSONSerialization JSONObjectWithData:JSONData options:(NSJSONReadingOptions)0 error:&error] : nil;
+    
+    if ([patch isKindOfClass:[NSArray class]] && [self.contentOperation applyJSONPatch:patch error:&error]) {
+        return YES;
+    }
+    
+    if (error == nil) {
+        error = [NSError errorWithDomain:HUBLiveServiceErrorDomain
+                                    code:0
+                                userInfo:@{NSLocalizedDescriptionKey: @"A JSON patch must be an array of operations"}];
+    }
+    
+    // A patch that couldn't be applied leaves the rendered document out of sync with the one in `hublive`
+    id<HUBLiveServiceDelegate> const delegate = self.delegate;
+    
+    if ([delegate respondsToSelector:@selector(liveService:didFailToApplyPatchWithError:)]) {
+        [delegate liveService:self didFailToApplyPatchWithError:error];
+    }
+    
+    return NO;
+}
+
 - (void)closeStream
 {
     [self.stream close];
     self.stream = nil;
+    self.frameReader = nil;
 }
 
 @end
@@ -35,6 +35,10 @@
 #import "HUBDefaultComponentLayoutManager.h"
 #import "HUBDefaultComponentFallbackHandler.h"
 #import "HUBLiveServiceImplementation.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBFrameProfilerImplementation.h"
+#import "HUBContentOperationRecorderImplementation.h"
+#import "HUBComponentUIStateCacheImplementation.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -43,12 +47,15 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) id<HUBConnectivityStateResolver> connectivityStateResolver;
 @property (nonatomic, strong, readonly) HUBInitialViewModelRegistry *initialViewModelRegistry;
 @property (nonatomic, strong, readonly) HUBComponentRegistryImplementation *componentRegistryImplementation;
+@property (nonatomic, strong, readonly) HUBPerformanceTracker *performanceTracker;
 
 @end
 
 @implementation HUBManager
 
 @synthesize liveService = _liveService;
+@synthesize frameProfiler = _frameProfiler;
+@synthesize contentOperationRecorder = _contentOperationRecorder;
 
 - (instancetype)initWithComponentLayoutManager:(id<HUBComponentLayoutManager>)componentLayoutManager
                       componentFallbackHandler:(id<HUBComponentFallbackHandler>)componentFallbackHandler
@@ -74,6 +81,18 @@ NS_ASSUME_NONNULL_BEGIN
         _connectivityStateResolver = connectivityStateResolverToUse;
         
         _initialViewModelRegistry = [HUBInitialViewModelRegistry new];
+        _performanceTracker = [HUBPerformanceTracker new];
+        
+        HUBFrameProfilerImplementation *frameProfiler = nil;
+        HUBContentOperationRecorderImplementation *contentOperationRecorder = nil;
+#if HUB_DEBUG
+        frameProfiler = [HUBFrameProfilerImplementation new];
+        contentOperationRecorder = [HUBContentOperationRecorderImplementation new];
+#endif
+        _frameProfiler = frameProfiler;
+        _contentOperationRecorder = contentOperationRecorder;
+        
+        HUBComponentUIStateCacheImplementation * const componentUIStateCache = [HUBComponentUIStateCacheImplementation new];
         
         HUBFeatureRegistryImplementation * const featureRegistry = [HUBFeatureRegistryImplementation new];
         
@@ -93,7 +112,9 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                                                                         iconImageResolver:iconImageResolver
                                                                                                                          prependedContentOperationFactory:prependedContentOperationFactory
                                                                                                                           appendedContentOperationFactory:appendedContentOperationFactory
-                                                                                                                               defaultContentReloadPolicy:defaultContentReloadPolicy];
+                                                                                                                               defaultContentReloadPolicy:defaultContentReloadPolicy
+                                                                                                                                       performanceTracker:_performanceTracker
+                                                                                                                                 contentOperationRecorder:contentOperationRecorder];
         
         HUBActionRegistryImplementation * const actionRegistry = [HUBActionRegistryImplementation registryWithDefaultSelectionAction];
         
@@ -106,7 +127,10 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                                                                                actionRegistry:actionRegistry
                                                                                                                                          defaultActionHandler:defaultActionHandler
                                                                                                                                        componentLayoutManager:componentLayoutManager
-                                                                                                                                           imageLoaderFactory:imageLoaderFactoryToUse];
+                                                                                                                                           imageLoaderFactory:imageLoaderFactoryToUse
+                                                                                                                                           performanceTracker:_performanceTracker
+                                                                                                                                                frameProfiler:frameProfiler
+                                                                                                                                        componentUIStateCache:componentUIStateCache];
         
         _featureRegistry = featureRegistry;
         _componentRegistry = componentRegistry;
@@ -115,6 +139,7 @@ NS_ASSUME_NONNULL_BEGIN
         _JSONSchemaRegistry = JSONSchemaRegistry;
         _viewModelLoaderFactory = viewModelLoaderFactory;
         _viewControllerFactory = viewControllerFactory;
+        _componentUIStateCache = componentUIStateCache;
     }
     
     return self;
@@ -127,6 +152,16 @@ NS_ASSUME_NONNULL_BEGIN
     return self.componentRegistryImplementation;
 }
 
+- (nullable id<HUBPerformanceObserver>)performanceObserver
+{
+    return self.performanceTracker.observer;
+}
+
+- (void)setPerformanceObserver:(nullable id<HUBPerformanceObserver>)performanceObserver
+{
+    self.performanceTracker.observer = performanceObserver;
+}
+
 - (nullable id<HUBLiveService>)liveService
 {
 #if HUB_DEBUG
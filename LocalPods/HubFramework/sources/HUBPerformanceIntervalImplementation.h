@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBPerformanceObserver.h"
+#import "HUBHeaderMacros.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Concrete implementation of the `HUBPerformanceInterval` API
+@interface HUBPerformanceIntervalImplementation : NSObject <HUBPerformanceInterval>
+
+/// The duration of the interval. Set by the tracker that started the interval when it ends.
+@property (nonatomic, readwrite) NSTimeInterval duration;
+
+/// The number of items processed during the interval. Set by the tracker that started the interval when it ends.
+@property (nonatomic, readwrite) NSUInteger itemCount;
+
+/// Any error that the measured event ended with. Set by the object that ended the interval.
+@property (nonatomic, strong, readwrite, nullable) NSError *error;
+
+/**
+ *  Initialize an instance of this class with its required values
+ *
+ *  @param event The event that the interval measures
+ *  @param identifier The unique identifier of the interval
+ *  @param featureIdentifier The identifier of the feature that the interval is for
+ *  @param viewURI The URI of the view that the interval is for
+ *  @param label Any event-specific label for the interval
+ *  @param startTime The time the interval started
+ */
+- (instancetype)initWithEvent:(HUBPerformanceEvent)event
+                   identifier:(uint64_t)identifier
+            featureIdentifier:(NSString *)featureIdentifier
+                      viewURI:(NSURL *)viewURI
+                        label:(nullable NSString *)label
+                    startTime:(NSTimeInterval)startTime HUB_DESIGNATED_INITIALIZER;
+
+@end
+
+NS_ASSUME_NONNULL_END
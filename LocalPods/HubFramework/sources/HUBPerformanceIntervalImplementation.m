@@ -0,0 +1,77 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBPerformanceIntervalImplementation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@implementation HUBPerformanceIntervalImplementation
+
+@synthesize event = _event;
+@synthesize identifier = _identifier;
+@synthesize featureIdentifier = _featureIdentifier;
+@synthesize viewURI = _viewURI;
+@synthesize label = _label;
+@synthesize startTime = _startTime;
+@synthesize duration = _duration;
+@synthesize itemCount = _itemCount;
+@synthesize error = _error;
+
+- (instancetype)initWithEvent:(HUBPerformanceEvent)event
+                   identifier:(uint64_t)identifier
+            featureIdentifier:(NSString *)featureIdentifier
+                      viewURI:(NSURL *)viewURI
+                        label:(nullable NSString *)label
+                    startTime:(NSTimeInterval)startTime
+{
+    NSParameterAssert(featureIdentifier != nil);
+    NSParameterAssert(viewURI != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _event = event;
+        _identifier = identifier;
+        _featureIdentifier = [featureIdentifier copy];
+        _viewURI = [viewURI copy];
+        _label = [label copy];
+        _startTime = startTime;
+    }
+    
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<HUBPerformanceInterval %llu: event = %lu, feature = %@, label = %@, duration = %.3fms, items = %lu>",
+            self.identifier,
+            (unsigned long)self.event,
+            self.featureIdentifier,
+            self.label,
+            self.duration * 1000,
+            (unsigned long)self.itemCount];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBPerformanceObserver.h"
+
+@class HUBPerformanceIntervalImplementation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Class used to measure performance intervals within the Hub Framework
+ *
+ *  A single root tracker is owned by `HUBManager`, which assigns its public `performanceObserver` to it. Intervals
+ *  are measured using trackers scoped to a view, that are created from the root tracker and share its observer.
+ *
+ *  When no observer is assigned, beginning an interval returns `nil` without allocating anything, and ending a `nil`
+ *  interval does nothing. Callers that need to do any work to compute an interval's label should check `enabled` first.
+ */
+@interface HUBPerformanceTracker : NSObject
+
+/// Any observer that intervals are reported to. Scoped trackers always report to the observer of their root tracker.
+@property (nonatomic, weak, nullable) id<HUBPerformanceObserver> observer;
+
+/// Whether an observer is assigned, meaning that intervals are currently being measured
+@property (nonatomic, readonly, getter=isEnabled) BOOL enabled;
+
+/**
+ *  Create a tracker that measures intervals for a certain view
+ *
+ *  @param viewURI The URI of the view to measure intervals for
+ *  @param featureIdentifier The identifier of the feature that the view belongs to
+ */
+- (HUBPerformanceTracker *)trackerForViewURI:(NSURL *)viewURI featureIdentifier:(NSString *)featureIdentifier;
+
+/**
+ *  Begin measuring an interval for an event
+ *
+ *  @param event The event to measure
+ *  @param label Any event-specific label for the interval
+ *
+ *  @return A new interval, or `nil` if no observer is assigned. Pass it to `endInterval:itemCount:` when the event ends.
+ *  Can only be called on trackers created using `trackerForViewURI:featureIdentifier:`.
+ */
+- (nullable HUBPerformanceIntervalImplementation *)beginIntervalForEvent:(HUBPerformanceEvent)event label:(nullable NSString *)label;
+
+/**
+ *  End measuring an interval and report it to the observer
+ *
+ *  @param interval The interval to end. If `nil`, this method does nothing.
+ *  @param itemCount The number of items processed during the interval
+ */
+- (void)endInterval:(nullable HUBPerformanceIntervalImplementation *)interval itemCount:(NSUInteger)itemCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBPerformanceTracker.h"
+
+#import "HUBPerformanceIntervalImplementation.h"
+
+#import <mach/mach_time.h>
+#import <stdatomic.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+static NSTimeInterval HUBPerformanceTrackerCurrentTime(void)
+{
+    static double secondsPerTick;
+    static dispatch_once_t onceToken;
+    
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info_data_t timebaseInfo;
+        mach_timebase_info(&timebaseInfo);
+        secondsPerTick = (double)timebaseInfo.numer / (double)timebaseInfo.denom / NSEC_PER_SEC;
+    });
+    
+    return (NSTimeInterval)(mach_absolute_time() * secondsPerTick);
+}
+
+static uint64_t HUBPerformanceTrackerNextIntervalIdentifier(void)
+{
+    static atomic_uint_fast64_t lastIdentifier = 0;
+    return (uint64_t)atomic_fetch_add_explicit(&lastIdentifier, 1, memory_order_relaxed) + 1;
+}
+
+@interface HUBPerformanceTracker ()
+
+@property (nonatomic, strong, nullable, readonly) HUBPerformanceTracker *rootTracker;
+@property (nonatomic, copy, nullable, readonly) NSURL *viewURI;
+@property (nonatomic, copy, nullable, readonly) NSString *featureIdentifier;
+@property (nonatomic, assign) BOOL hasObserver;
+@property (nonatomic, assign) BOOL observerHandlesIntervalBegin;
+
+@end
+
+@implementation HUBPerformanceTracker
+
+@synthesize observer = _observer;
+
+- (instancetype)initWithRootTracker:(HUBPerformanceTracker *)rootTracker
+                            viewURI:(NSURL *)viewURI
+                  featureIdentifier:(NSString *)featureIdentifier
+{
+    NSParameterAssert(rootTracker != nil);
+    NSParameterAssert(viewURI != nil);
+    NSParameterAssert(featureIdentifier != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _rootTracker = rootTracker;
+        _viewURI = [viewURI copy];
+        _featureIdentifier = [featureIdentifier copy];
+    }
+    
+    return self;
+}
+
+#pragma mark - Accessor overrides
+
+- (nullable id<HUBPerformanceObserver>)observer
+{
+    HUBPerformanceTracker * const rootTracker = self.rootTracker;
+    
+    if (rootTracker != nil) {
+        return rootTracker.observer;
+    }
+    
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    return _observer;
+#pragma clang diagnostic pop
+}
+
+- (void)setObserver:(nullable id<HUBPerformanceObserver>)observer
+{
+    NSAssert(self.rootTracker == nil, @"The observer can only be assigned to a root performance tracker");
+    
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdirect-ivar-access"
+    _observer = observer;
+#pragma clang diagnostic pop
+    
+    self.hasObserver = (observer != nil);
+    self.observerHandlesIntervalBegin = [observer respondsToSelector:@selector(performanceIntervalDidBegin:)];
+}
+
+- (BOOL)isEnabled
+{
+    HUBPerformanceTracker * const rootTracker = self.rootTracker ?: self;
+    return rootTracker.hasObserver;
+}
+
+#pragma mark - API
+
+- (HUBPerformanceTracker *)trackerForViewURI:(NSURL *)viewURI featureIdentifier:(NSString *)featureIdentifier
+{
+    HUBPerformanceTracker * const rootTracker = self.rootTracker ?: self;
+    return [[HUBPerformanceTracker alloc] initWithRootTracker:rootTracker viewURI:viewURI featureIdentifier:featureIdentifier];
+}
+
+- (nullable HUBPerformanceIntervalImplementation *)beginIntervalForEvent:(HUBPerformanceEvent)event label:(nullable NSString *)label
+{
+    if (!self.enabled) {
+        return nil;
+    }
+    
+    HUBPerformanceTracker * const rootTracker = self.rootTracker;
+    NSURL * const viewURI = self.viewURI;
+    NSString * const featureIdentifier = self.featureIdentifier;
+    
+    if (rootTracker == nil || viewURI == nil || featureIdentifier == nil) {
+        NSAssert(NO, @"Intervals can only be measured using a performance tracker scoped to a view");
+        return nil;
+    }
+    
+    id<HUBPerformanceObserver> const observer = rootTracker.observer;
+    
+    if (observer == nil) {
+        return nil;
+    }
+    
+    HUBPerformanceIntervalImplementation * const interval = [[HUBPerformanceIntervalImplementation alloc] initWithEvent:event
+                                                                                                           identifier:HUBPerformanceTrackerNextIntervalIdentifier()
+                                                                                                    featureIdentifier:featureIdentifier
+                                                                                                              viewURI:viewURI
+                                                                                                                label:label
+                                                                                                            startTime:HUBPerformanceTrackerCurrentTime()];
+    
+    if (rootTracker.observerHandlesIntervalBegin) {
+        [observer performanceIntervalDidBegin:interval];
+    }
+    
+    return interval;
+}
+
+- (void)endInterval:(nullable HUBPerformanceIntervalImplementation *)interval itemCount:(NSUInteger)itemCount
+{
+    if (interval == nil) {
+        return;
+    }
+    
+    interval.duration = HUBPerformanceTrackerCurrentTime() - interval.startTime;
+    interval.itemCount = itemCount;
+    
+    HUBPerformanceIntervalImplementation * const endedInterval = interval;
+    [self.observer performanceIntervalDidEnd:endedInterval];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -25,6 +25,7 @@
 #import "HUBJSONCompatibleBuilder.h"
 #import "HUBSerializable.h"
 #import "HUBKeyPath.h"
+#import "HUBDataCompression.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -89,7 +90,8 @@ static inline BOOL HUBSetOutError(NSError * _Nullable __autoreleasing *outError,
 /**
  *  Add binary JSON data to a JSON compatible builder
  *
- *  @param data The binary data to add to the builder. Must contain dictionary-based JSON.
+ *  @param data The binary data to add to the builder. Must contain dictionary-based JSON, which may be gzip
+ *         or zlib compressed, in which case it's transparently decompressed.
  *  @param builder The builder to add the data to.
  *  @param outError Contains an `NSError` object that describes the problem, iff an error occurred when parsing the
  *                  supplied JSON data.
@@ -100,8 +102,15 @@ static inline BOOL HUBAddJSONDataToBuilder(NSData *data,
                                            id<HUBJSONCompatibleBuilder> builder,
                                            NSError * _Nullable __autoreleasing *outError)
 {
+    NSError *decompressionError;
+    NSData * const JSONData = HUBDecompressDataIfNeeded(data, &decompressionError);
+    
+    if (JSONData == nil) {
+        return HUBSetOutError(outError, decompressionError);
+    }
+    
     NSError *JSONError;
-    id JSONObject = [NSJSONSerialization JSONObjectWithData:data options:(NSJSONReadingOptions)0 error:&JSONError];
+    id JSONObject = [NSJSONSerialization JSONObjectWithData:JSONData options:(NSJSONReadingOptions)0 error:&JSONError];
 
     if (JSONObject == nil && JSONError != nil) {
         return HUBSetOutError(outError, JSONError);
@@ -31,6 +31,8 @@
 @class HUBCollectionViewFactory;
 @class HUBComponentReusePool;
 @class HUBViewModelRenderer;
+@class HUBPerformanceTracker;
+@class HUBFrameProfilerImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -51,6 +53,8 @@ NS_ASSUME_NONNULL_BEGIN
  *  @param actionHandler The object that will handle actions for this view controller
  *  @param scrollHandler The object that will handle scrolling for the view controller
  *  @param imageLoader The loader to use to load images for components
+ *  @param performanceTracker The tracker to use to measure component configuration, image loading and time to first render
+ *  @param frameProfiler Any frame profiler to report per-frame component work to
  */
 - (instancetype)initWithViewURI:(NSURL *)viewURI
                     featureInfo:(id<HUBFeatureInfo>)featureInfo
@@ -62,7 +66,9 @@ NS_ASSUME_NONNULL_BEGIN
          componentLayoutManager:(id<HUBComponentLayoutManager>)componentLayoutManager
                   actionHandler:(id<HUBActionHandler>)actionHandler
                   scrollHandler:(id<HUBViewControllerScrollHandler>)scrollHandler
-                    imageLoader:(id<HUBImageLoader>)imageLoader HUB_DESIGNATED_INITIALIZER;
+                    imageLoader:(id<HUBImageLoader>)imageLoader
+             performanceTracker:(HUBPerformanceTracker *)performanceTracker
+                  frameProfiler:(nullable HUBFrameProfilerImplementation *)frameProfiler HUB_DESIGNATED_INITIALIZER;
 
 @end
 
@@ -35,7 +35,8 @@
 #import "HUBComponentRegistry.h"
 #import "HUBComponentCollectionViewCell.h"
 #import "HUBUtilities.h"
-#import "HUBImageLoader.h"
+#import "HUBImageLoaderWithBatchedRequests.h"
+#import "HUBImageLoaderWithSizeVariants.h"
 #import "HUBComponentImageLoadingContext.h"
 #import "HUBCollectionViewFactory.h"
 #import "HUBCollectionView.h"
@@ -48,15 +49,29 @@
 #import "HUBActionHandlerWrapper.h"
 #import "HUBViewModelRenderer.h"
 #import "HUBFeatureInfo.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBPerformanceIntervalImplementation.h"
+#import "HUBFrameProfilerImplementation.h"
+#import "HUBIdleWorkScheduler.h"
+#import "HUBViewModelRenderScheduler.h"
 
 static NSTimeInterval const HUBImageDownloadTimeThreshold = 0.07;
+static NSTimeInterval const HUBComponentPreparationTimeBudget = 0.004;
+static NSUInteger const HUBComponentPreparationChildLimit = 4;
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// Prepared component wrappers are keyed by model identifier and index, since model instances may be recreated
+static NSString *HUBPreparedComponentWrapperKey(id<HUBComponentModel> componentModel)
+{
+    return [NSString stringWithFormat:@"%@:%@", componentModel.identifier, @(componentModel.index)];
+}
+
 @interface HUBViewController () <
     HUBViewModelLoaderDelegate,
     HUBImageLoaderDelegate,
     HUBComponentWrapperDelegate,
+    HUBViewModelRenderSchedulerDelegate,
     UICollectionViewDataSource,
     HUBCollectionViewDelegate
 >
@@ -78,13 +93,14 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSURL *, NSMutableArray<HUBComponentImageLoadingContext *> *> *componentImageLoadingContexts;
 @property (nonatomic, strong, readonly) NSHashTable<id<HUBComponentContentOffsetObserver>> *contentOffsetObservingComponentWrappers;
 @property (nonatomic, strong, readonly) NSHashTable<id<HUBComponentActionObserver>> *actionObservingComponentWrappers;
+@property (nonatomic, strong, readonly) NSHashTable<id<HUBComponentActionObserver>> *unfilteredActionObservingComponentWrappers;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, NSHashTable<id<HUBComponentActionObserver>> *> *actionObservingComponentWrappersByNamespace;
 @property (nonatomic, strong, nullable) HUBComponentWrapper *headerComponentWrapper;
 @property (nonatomic, strong, readonly) NSMutableArray<HUBComponentWrapper *> *overlayComponentWrappers;
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSUUID *, HUBComponentWrapper *> *componentWrappersByIdentifier;
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSUUID *, HUBComponentWrapper *> *componentWrappersByCellIdentifier;
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, HUBComponentWrapper *> *componentWrappersByModelIdentifier;
 @property (nonatomic, strong, nullable) HUBComponentWrapper *highlightedComponentWrapper;
-@property (nonatomic, strong, nullable) id<HUBViewModel> pendingViewModel;
 @property (nonatomic, strong, nullable) id<HUBViewModel> viewModel;
 @property (nonatomic, assign) BOOL viewHasAppeared;
 @property (nonatomic, assign) BOOL viewHasBeenLaidOut;
@@ -92,7 +108,21 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic) CGFloat visibleKeyboardHeight;
 @property (nonatomic, assign) CGPoint lastContentOffset;
 @property (nonatomic, copy, nullable) void(^pendingScrollAnimationCallback)(void);
-@property (nonatomic, getter=isRendering) BOOL rendering;
+@property (nonatomic, strong, readonly) HUBViewModelRenderScheduler *renderScheduler;
+@property (nonatomic, strong, readonly) HUBPerformanceTracker *performanceTracker;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSURL *, HUBPerformanceIntervalImplementation *> *imageLoadPerformanceIntervals;
+@property (nonatomic, assign, readonly) BOOL imageLoaderBatchesRequests;
+@property (nonatomic, strong, readonly) NSMutableArray<NSURL *> *pendingImageURLs;
+@property (nonatomic, strong, readonly) NSMutableArray<NSValue *> *pendingImageTargetSizes;
+@property (nonatomic, strong, readonly) NSMutableSet<NSURL *> *viewportImageURLsBeingLoaded;
+@property (nonatomic, strong, nullable) HUBPerformanceIntervalImplementation *viewportImageLoadPerformanceInterval;
+@property (nonatomic, assign) NSUInteger viewportImageCount;
+@property (nonatomic, strong, nullable) HUBPerformanceIntervalImplementation *firstRenderPerformanceInterval;
+@property (nonatomic, assign) BOOL hasMeasuredFirstRender;
+@property (nonatomic, strong, nullable, readonly) HUBFrameProfilerImplementation *frameProfiler;
+@property (nonatomic, strong, readonly) HUBIdleWorkScheduler *componentPreparationScheduler;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, HUBComponentWrapper *> *preparedComponentWrappers;
+@property (nonatomic, assign) CGRect lastComponentPreparationVisibleRect;
 
 @end
 
@@ -111,6 +141,8 @@ NS_ASSUME_NONNULL_BEGIN
                   actionHandler:(id<HUBActionHandler>)actionHandler
                   scrollHandler:(id<HUBViewControllerScrollHandler>)scrollHandler
                     imageLoader:(id<HUBImageLoader>)imageLoader
+             performanceTracker:(HUBPerformanceTracker *)performanceTracker
+                  frameProfiler:(nullable HUBFrameProfilerImplementation *)frameProfiler
 {
     NSParameterAssert(viewURI != nil);
     NSParameterAssert(featureInfo != nil);
@@ -123,6 +155,7 @@ NS_ASSUME_NONNULL_BEGIN
     NSParameterAssert(actionHandler != nil);
     NSParameterAssert(scrollHandler != nil);
     NSParameterAssert(imageLoader != nil);
+    NSParameterAssert(performanceTracker != nil);
     
     if (!(self = [super initWithNibName:nil bundle:nil])) {
         return nil;
@@ -143,14 +176,27 @@ NS_ASSUME_NONNULL_BEGIN
     _componentImageLoadingContexts = [NSMutableDictionary new];
     _contentOffsetObservingComponentWrappers = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory];
     _actionObservingComponentWrappers = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory];
+    _unfilteredActionObservingComponentWrappers = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory];
+    _actionObservingComponentWrappersByNamespace = [NSMutableDictionary new];
     _overlayComponentWrappers = [NSMutableArray new];
     _componentWrappersByIdentifier = [NSMutableDictionary new];
     _componentWrappersByCellIdentifier = [NSMutableDictionary new];
     _componentWrappersByModelIdentifier = [NSMutableDictionary new];
+    _performanceTracker = performanceTracker;
+    _imageLoadPerformanceIntervals = [NSMutableDictionary new];
+    _imageLoaderBatchesRequests = [imageLoader conformsToProtocol:@protocol(HUBImageLoaderWithBatchedRequests)];
+    _pendingImageURLs = [NSMutableArray new];
+    _pendingImageTargetSizes = [NSMutableArray new];
+    _viewportImageURLsBeingLoaded = [NSMutableSet new];
+    _frameProfiler = frameProfiler;
+    _renderScheduler = [HUBViewModelRenderScheduler new];
+    _componentPreparationScheduler = [[HUBIdleWorkScheduler alloc] initWithTimeBudget:HUBComponentPreparationTimeBudget];
+    _preparedComponentWrappers = [NSMutableDictionary new];
     
     viewModelLoader.delegate = self;
     viewModelLoader.actionPerformer = self;
     imageLoader.delegate = self;
+    _renderScheduler.delegate = self;
     
     self.automaticallyAdjustsScrollViewInsets = [_scrollHandler shouldAutomaticallyAdjustContentInsetsInViewController:self];
     
@@ -193,6 +239,12 @@ NS_ASSUME_NONNULL_BEGIN
     }
 
     [self createCollectionViewIfNeeded];
+    
+    if (!self.hasMeasuredFirstRender && self.firstRenderPerformanceInterval == nil) {
+        self.firstRenderPerformanceInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventTimeToFirstRender
+                                                                                       label:nil];
+    }
+    
     [self.viewModelLoader loadViewModel];
     
     for (NSIndexPath * const indexPath in self.collectionView.indexPathsForVisibleItems) {
@@ -245,6 +297,9 @@ NS_ASSUME_NONNULL_BEGIN
 {
     [super didReceiveMemoryWarning];
 
+    [self.componentReusePool purgeSavedUIStates];
+    [self discardPreparedComponentWrappers];
+
     if (!self.isViewLoaded) {
         return;
     }
@@ -271,6 +326,11 @@ NS_ASSUME_NONNULL_BEGIN
     return self.featureInfo.identifier;
 }
 
+- (NSUInteger)droppedViewModelCount
+{
+    return self.renderScheduler.droppedViewModelCount;
+}
+
 - (BOOL)isViewScrolling
 {
     return self.collectionView.isDragging || self.collectionView.isDecelerating;
@@ -453,28 +513,12 @@ NS_ASSUME_NONNULL_BEGIN
     if ([self.viewModel.buildDate isEqual:viewModel.buildDate]) {
         return;
     }
-
-    if (self.isRendering) {
-        self.pendingViewModel = viewModel;
-        return;
-    }
-
-    self.rendering = YES;
-
-    id<HUBViewControllerDelegate> const delegate = self.delegate;
-    [delegate viewController:self willUpdateWithViewModel:viewModel];
     
-    HUBCopyNavigationItemProperties(self.navigationItem, viewModel.navigationItem);
-    
-    self.viewModel = viewModel;
-    self.viewModelHasChangedSinceLastLayoutUpdate = YES;
-    [self.view setNeedsLayout];
-    
-    if (self.viewHasBeenLaidOut) {
-        [self reloadCollectionViewWithViewModel:viewModel animated:NO];
+    if ([self.renderScheduler.pendingViewModel.buildDate isEqual:viewModel.buildDate]) {
+        return;
     }
     
-    [delegate viewControllerDidUpdate:self];
+    [self.renderScheduler scheduleRenderingOfViewModel:viewModel];
 }
 
 - (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didFailLoadingWithError:(NSError *)error
@@ -531,6 +575,26 @@ NS_ASSUME_NONNULL_BEGIN
     [self.highlightedComponentWrapper updateViewForSelectionState:HUBComponentSelectionStateNone];
 }
 
+#pragma mark - HUBViewModelRenderSchedulerDelegate
+
+- (void)viewModelRenderScheduler:(HUBViewModelRenderScheduler *)renderScheduler renderViewModel:(id<HUBViewModel>)viewModel
+{
+    id<HUBViewControllerDelegate> const delegate = self.delegate;
+    [delegate viewController:self willUpdateWithViewModel:viewModel];
+    
+    HUBCopyNavigationItemProperties(self.navigationItem, viewModel.navigationItem);
+    
+    self.viewModel = viewModel;
+    self.viewModelHasChangedSinceLastLayoutUpdate = YES;
+    [self.view setNeedsLayout];
+    
+    if (self.viewHasBeenLaidOut) {
+        [self reloadCollectionViewWithViewModel:viewModel animated:NO];
+    }
+    
+    [delegate viewControllerDidUpdate:self];
+}
+
 #pragma mark - HUBImageLoaderDelegate
 
 - (void)imageLoader:(id<HUBImageLoader>)imageLoader didLoadImage:(UIImage *)image forURL:(NSURL *)imageURL
@@ -538,6 +602,8 @@ NS_ASSUME_NONNULL_BEGIN
     HUBPerformOnMainQueue(^{
         NSArray * const contexts = self.componentImageLoadingContexts[imageURL];
         self.componentImageLoadingContexts[imageURL] = nil;
+        [self endImageLoadPerformanceIntervalForURL:imageURL componentCount:contexts.count];
+        [self endViewportImageLoadPerformanceIntervalIfNeededForURL:imageURL];
         
         for (HUBComponentImageLoadingContext * const context in contexts) {
             [self handleLoadedComponentImage:image forURL:imageURL context:context];
@@ -548,7 +614,10 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)imageLoader:(id<HUBImageLoader>)imageLoader didFailLoadingImageForURL:(NSURL *)imageURL error:(NSError *)error
 {
     HUBPerformOnMainQueue(^{
+        NSArray * const contexts = self.componentImageLoadingContexts[imageURL];
         self.componentImageLoadingContexts[imageURL] = nil;
+        [self endImageLoadPerformanceIntervalForURL:imageURL componentCount:contexts.count];
+        [self endViewportImageLoadPerformanceIntervalIfNeededForURL:imageURL];
     });
 }
 
@@ -583,13 +652,26 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
 - (HUBComponentWrapper *)componentWrapper:(HUBComponentWrapper *)componentWrapper
                    childComponentForModel:(id<HUBComponentModel>)model
 {
+    HUBComponentWrapper * const preparedChildComponentWrapper = [self dequeuePreparedComponentWrapperForModel:model
+                                                                                                       parent:componentWrapper];
+    
+    if (preparedChildComponentWrapper != nil) {
+        [preparedChildComponentWrapper viewDidMoveToSuperview:HUBComponentLoadViewIfNeeded(componentWrapper)];
+        return preparedChildComponentWrapper;
+    }
+    
     CGSize const containerViewSize = [self childComponentContainerViewSizeForParentWrapper:componentWrapper];
     
     HUBComponentWrapper * const childComponentWrapper = [self.componentReusePool componentWrapperForModel:model
                                                                                                  delegate:self
                                                                                                    parent:componentWrapper];
     
+    CFTimeInterval const viewLoadingStartTime = [self.frameProfiler beginSample];
     UIView * const childComponentView = HUBComponentLoadViewIfNeeded(childComponentWrapper);
+    [self endFrameProfilerSampleWithStartTime:viewLoadingStartTime
+                                     category:HUBFrameProfilerCategoryViewLoading
+                               componentModel:model];
+    
     [self configureComponentWrapper:childComponentWrapper withModel:model containerViewSize:containerViewSize];
     [self didAddComponentWrapper:childComponentWrapper];
     
@@ -716,13 +798,28 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
     HUBComponentCollectionViewCell * const cell = [collectionView dequeueReusableCellWithReuseIdentifier:cellReuseIdentifier
                                                                                             forIndexPath:indexPath];
 
-    HUBComponentWrapper * const componentWrapper = [self.componentReusePool componentWrapperForModel:componentModel
-                                                                                            delegate:self
-                                                                                              parent:nil];
+    HUBComponentWrapper *componentWrapper = [self dequeuePreparedComponentWrapperForModel:componentModel parent:nil];
+    BOOL const componentWrapperWasPrepared = (componentWrapper != nil);
+    
+    if (componentWrapper == nil) {
+        componentWrapper = [self.componentReusePool componentWrapperForModel:componentModel
+                                                                    delegate:self
+                                                                      parent:nil];
+    }
 
     self.componentWrappersByCellIdentifier[cell.identifier] = componentWrapper;
+    
+    CFTimeInterval const viewLoadingStartTime = [self.frameProfiler beginSample];
     cell.component = componentWrapper;
     [componentWrapper viewDidMoveToSuperview:cell];
+    [self endFrameProfilerSampleWithStartTime:viewLoadingStartTime
+                                     category:HUBFrameProfilerCategoryViewLoading
+                               componentModel:componentModel];
+    
+    if (componentWrapperWasPrepared) {
+        return cell;
+    }
+    
     [self didAddComponentWrapper:componentWrapper];
 
     [self configureComponentWrapper:componentWrapper withModel:componentModel containerViewSize:collectionView.frame.size];
@@ -777,10 +874,15 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
 - (void)scrollViewDidScroll:(UIScrollView *)scrollView
 {
     for (HUBComponentWrapper * const componentWrapper in self.contentOffsetObservingComponentWrappers) {
+        CFTimeInterval const observationStartTime = [self.frameProfiler beginSample];
         [componentWrapper updateViewForChangedContentOffset:scrollView.contentOffset];
+        [self endFrameProfilerSampleWithStartTime:observationStartTime
+                                         category:HUBFrameProfilerCategoryContentOffsetObservation
+                                   componentModel:componentWrapper.model];
     }
     
     [self.highlightedComponentWrapper updateViewForSelectionState:HUBComponentSelectionStateNone];
+    [self scheduleComponentPreparationIfNeeded];
 }
 
 - (void)scrollViewWillBeginDragging:(UIScrollView *)scrollView
@@ -901,6 +1003,7 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
     }
 
     [self saveStatesForVisibleComponents];
+    [self discardPreparedComponentWrappers];
 
     [self configureHeaderComponent];
     [self configureOverlayComponents];
@@ -915,20 +1018,20 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
                                    animated:animated
                             addHeaderMargin:shouldAddHeaderMargin
                                  completion:^{
-        self.rendering = NO;
+        id<HUBViewModel> const pendingViewModel = self.renderScheduler.pendingViewModel;
+        [self.renderScheduler renderingDidFinish];
 
-        if (self.pendingViewModel != nil) {
-            id<HUBViewModel> pendingViewModel = self.pendingViewModel;
-            self.pendingViewModel = nil;
-            [self viewModelLoader:self.viewModelLoader didLoadViewModel:pendingViewModel];
+        if (pendingViewModel != nil) {
             return;
         }
 
         id<HUBViewControllerDelegate> delegate = self.delegate;
 
+        [self endFirstRenderPerformanceIntervalIfNeededForViewModel:viewModel];
         [self headerAndOverlayComponentViewsWillAppear];
         [self adjustCollectionViewContentInsetWithProposedTopValue:[self calculateTopContentInset]];
         [delegate viewControllerDidFinishRendering:self];
+        [self scheduleComponentPreparationIfNeeded];
     }];
     
     self.viewModelHasChangedSinceLastLayoutUpdate = NO;
@@ -956,8 +1059,289 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
         self.componentWrappersByModelIdentifier[currentModelIdentifier] = nil;
     }
     
+    HUBPerformanceIntervalImplementation *configurationInterval = nil;
+    
+    if (self.performanceTracker.enabled) {
+        configurationInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventComponentConfiguration
+                                                                         label:model.componentIdentifier.identifierString];
+    }
+    
+    CFTimeInterval const configurationStartTime = [self.frameProfiler beginSample];
+    
     [wrapper configureViewWithModel:model containerViewSize:containerViewSize];
     self.componentWrappersByModelIdentifier[model.identifier] = wrapper;
+    
+    [self endFrameProfilerSampleWithStartTime:configurationStartTime
+                                     category:HUBFrameProfilerCategoryConfiguration
+                               componentModel:model];
+    [self.performanceTracker endInterval:configurationInterval itemCount:1];
+}
+
+- (void)endFrameProfilerSampleWithStartTime:(CFTimeInterval)startTime
+                                   category:(HUBFrameProfilerCategory)category
+                             componentModel:(id<HUBComponentModel>)componentModel
+{
+    if (startTime == 0) {
+        return;
+    }
+    
+    [self.frameProfiler endSampleWithStartTime:startTime
+                                      category:category
+                           componentIdentifier:componentModel.componentIdentifier
+                             featureIdentifier:self.featureIdentifier];
+}
+
+- (void)endFirstRenderPerformanceIntervalIfNeededForViewModel:(id<HUBViewModel>)viewModel
+{
+    if (self.firstRenderPerformanceInterval == nil) {
+        return;
+    }
+    
+    if (viewModel == self.viewModelLoader.initialViewModel) {
+        return;
+    }
+    
+    [self.performanceTracker endInterval:self.firstRenderPerformanceInterval itemCount:viewModel.bodyComponentModels.count];
+    self.firstRenderPerformanceInterval = nil;
+    self.hasMeasuredFirstRender = YES;
+}
+
+- (void)scheduleComponentPreparationIfNeeded
+{
+    UICollectionView * const collectionView = self.collectionView;
+    id<HUBViewModel> const viewModel = self.viewModel;
+    
+    if (collectionView == nil || viewModel == nil || self.renderScheduler.isRendering) {
+        return;
+    }
+    
+    CGRect const visibleRect = collectionView.bounds;
+    CGRect const lastVisibleRect = self.lastComponentPreparationVisibleRect;
+    CGFloat const scrollDistance = CGRectGetMinY(visibleRect) - CGRectGetMinY(lastVisibleRect);
+    
+    if (!CGRectIsEmpty(lastVisibleRect) && fabs(scrollDistance) < CGRectGetHeight(visibleRect) / 2) {
+        return;
+    }
+    
+    self.lastComponentPreparationVisibleRect = visibleRect;
+    [self.componentPreparationScheduler cancelAllWork];
+    
+    // Prepare the components that are one screen ahead in the current scrolling direction
+    BOOL const isScrollingUpwards = !CGRectIsEmpty(lastVisibleRect) && scrollDistance < 0;
+    CGFloat const preparationOffset = isScrollingUpwards ? -CGRectGetHeight(visibleRect) : CGRectGetHeight(visibleRect);
+    CGRect const preparationRect = CGRectOffset(visibleRect, 0, preparationOffset);
+    
+    // Components that are visible or about to become visible keep their prepared wrappers, any others are discarded
+    CGRect const retainedRect = CGRectUnion(visibleRect, preparationRect);
+    NSMutableIndexSet * const retainedComponentIndexes = [NSMutableIndexSet new];
+    NSMutableIndexSet * const componentIndexes = [NSMutableIndexSet new];
+    
+    for (UICollectionViewLayoutAttributes * const layoutAttributes in [collectionView.collectionViewLayout layoutAttributesForElementsInRect:retainedRect]) {
+        if (layoutAttributes.representedElementCategory != UICollectionElementCategoryCell) {
+            continue;
+        }
+        
+        NSUInteger const componentIndex = (NSUInteger)layoutAttributes.indexPath.item;
+        [retainedComponentIndexes addIndex:componentIndex];
+        
+        if (CGRectIntersectsRect(layoutAttributes.frame, visibleRect) || !CGRectIntersectsRect(layoutAttributes.frame, preparationRect)) {
+            continue;
+        }
+        
+        [componentIndexes addIndex:componentIndex];
+    }
+    
+    [self discardPreparedComponentWrappersOutsideBodyComponentIndexes:retainedComponentIndexes];
+    
+    __weak __typeof(self) weakSelf = self;
+    NSEnumerationOptions const enumerationOptions = isScrollingUpwards ? NSEnumerationReverse : 0;
+    
+    [componentIndexes enumerateIndexesWithOptions:enumerationOptions usingBlock:^(NSUInteger componentIndex, BOOL *stop) {
+        [self.componentPreparationScheduler enqueueWork:^{
+            [weakSelf prepareBodyComponentWrapperAtIndex:componentIndex viewModel:viewModel];
+        }];
+    }];
+}
+
+- (void)prepareBodyComponentWrapperAtIndex:(NSUInteger)componentIndex viewModel:(id<HUBViewModel>)viewModel
+{
+    if (viewModel != self.viewModel || self.renderScheduler.isRendering) {
+        return;
+    }
+    
+    NSArray<id<HUBComponentModel>> * const componentModels = viewModel.bodyComponentModels;
+    
+    if (componentIndex >= componentModels.count) {
+        return;
+    }
+    
+    id<HUBComponentModel> const componentModel = componentModels[componentIndex];
+    
+    if (self.preparedComponentWrappers[HUBPreparedComponentWrapperKey(componentModel)] != nil) {
+        return;
+    }
+    
+    NSIndexPath * const indexPath = [NSIndexPath indexPathForItem:(NSInteger)componentIndex inSection:0];
+    
+    if ([self.collectionView cellForItemAtIndexPath:indexPath] != nil) {
+        return;
+    }
+    
+    HUBComponentWrapper * const componentWrapper = [self.componentReusePool componentWrapperForModel:componentModel
+                                                                                            delegate:self
+                                                                                              parent:nil];
+    
+    [self prepareComponentWrapper:componentWrapper
+                        withModel:componentModel
+                containerViewSize:self.collectionView.frame.size];
+    
+    if (!componentWrapper.handlesChildren) {
+        return;
+    }
+    
+    __weak __typeof(self) weakSelf = self;
+    __weak HUBComponentWrapper * const weakComponentWrapper = componentWrapper;
+    NSUInteger const childCount = MIN(componentModel.children.count, HUBComponentPreparationChildLimit);
+    
+    for (NSUInteger childIndex = 0; childIndex < childCount; childIndex++) {
+        [self.componentPreparationScheduler enqueueWork:^{
+            HUBComponentWrapper * const parentComponentWrapper = weakComponentWrapper;
+            
+            if (parentComponentWrapper != nil) {
+                [weakSelf prepareChildComponentWrapperAtIndex:childIndex
+                                       parentComponentWrapper:parentComponentWrapper
+                                         parentComponentModel:componentModel];
+            }
+        }];
+    }
+}
+
+- (void)prepareChildComponentWrapperAtIndex:(NSUInteger)childIndex
+                     parentComponentWrapper:(HUBComponentWrapper *)parentComponentWrapper
+                       parentComponentModel:(id<HUBComponentModel>)parentComponentModel
+{
+    if (parentComponentWrapper.model != parentComponentModel || [parentComponentWrapper hasChildComponentAtIndex:childIndex]) {
+        return;
+    }
+    
+    id<HUBComponentModel> const childComponentModel = [self childModelAtIndex:childIndex fromComponentWrapper:parentComponentWrapper];
+    
+    if (childComponentModel == nil || self.preparedComponentWrappers[HUBPreparedComponentWrapperKey(childComponentModel)] != nil) {
+        return;
+    }
+    
+    CGSize const containerViewSize = [self childComponentContainerViewSizeForParentWrapper:parentComponentWrapper];
+    
+    HUBComponentWrapper * const childComponentWrapper = [self.componentReusePool componentWrapperForModel:childComponentModel
+                                                                                                 delegate:self
+                                                                                                   parent:parentComponentWrapper];
+    
+    [self prepareComponentWrapper:childComponentWrapper
+                        withModel:childComponentModel
+                containerViewSize:containerViewSize];
+    
+    CGSize const preferredViewSize = [childComponentWrapper preferredViewSizeForDisplayingModel:childComponentModel
+                                                                              containerViewSize:containerViewSize];
+    
+    HUBComponentLoadViewIfNeeded(childComponentWrapper).frame = CGRectMake(0, 0, preferredViewSize.width, preferredViewSize.height);
+}
+
+- (void)prepareComponentWrapper:(HUBComponentWrapper *)componentWrapper
+                      withModel:(id<HUBComponentModel>)componentModel
+              containerViewSize:(CGSize)containerViewSize
+{
+    HUBComponentLoadViewIfNeeded(componentWrapper);
+    [self didAddComponentWrapper:componentWrapper];
+    [self configureComponentWrapper:componentWrapper withModel:componentModel containerViewSize:containerViewSize];
+    [self loadImagesForComponentWrapper:componentWrapper childIndex:nil];
+    
+    self.preparedComponentWrappers[HUBPreparedComponentWrapperKey(componentModel)] = componentWrapper;
+}
+
+- (nullable HUBComponentWrapper *)dequeuePreparedComponentWrapperForModel:(id<HUBComponentModel>)componentModel
+                                                                   parent:(nullable HUBComponentWrapper *)parent
+{
+    // Avoid creating a key for every cell and child component when nothing has been prepared
+    if (self.preparedComponentWrappers.count == 0) {
+        return nil;
+    }
+    
+    NSString * const key = HUBPreparedComponentWrapperKey(componentModel);
+    HUBComponentWrapper * const componentWrapper = self.preparedComponentWrappers[key];
+    
+    if (componentWrapper == nil) {
+        return nil;
+    }
+    
+    self.preparedComponentWrappers[key] = nil;
+    
+    if (componentWrapper.parent != parent) {
+        [self discardPreparedComponentWrapper:componentWrapper];
+        return nil;
+    }
+    
+    // The wrapper was prepared for a previous instance of the model, so it needs to pick up any changes
+    if (componentWrapper.model != componentModel) {
+        CGSize const containerViewSize = (parent != nil) ? [self childComponentContainerViewSizeForParentWrapper:parent] : self.collectionView.frame.size;
+        [self configureComponentWrapper:componentWrapper withModel:componentModel containerViewSize:containerViewSize];
+        [self loadImagesForComponentWrapper:componentWrapper childIndex:nil];
+    }
+    
+    return componentWrapper;
+}
+
+- (void)discardPreparedComponentWrappers
+{
+    [self.componentPreparationScheduler cancelAllWork];
+    self.lastComponentPreparationVisibleRect = CGRectZero;
+    
+    NSArray<HUBComponentWrapper *> * const componentWrappers = self.preparedComponentWrappers.allValues;
+    [self.preparedComponentWrappers removeAllObjects];
+    
+    for (HUBComponentWrapper * const componentWrapper in componentWrappers) {
+        [self discardPreparedComponentWrapper:componentWrapper];
+    }
+}
+
+- (void)discardPreparedComponentWrappersOutsideBodyComponentIndexes:(NSIndexSet *)bodyComponentIndexes
+{
+    if (self.preparedComponentWrappers.count == 0) {
+        return;
+    }
+    
+    NSMutableArray<NSString *> * const keys = [NSMutableArray new];
+    
+    [self.preparedComponentWrappers enumerateKeysAndObjectsUsingBlock:^(NSString *key, HUBComponentWrapper *componentWrapper, BOOL *stop) {
+        HUBComponentWrapper *rootComponentWrapper = componentWrapper;
+        HUBComponentWrapper *parentComponentWrapper = nil;
+        
+        while ((parentComponentWrapper = rootComponentWrapper.parent) != nil) {
+            rootComponentWrapper = parentComponentWrapper;
+        }
+        
+        if (![bodyComponentIndexes containsIndex:rootComponentWrapper.model.index]) {
+            [keys addObject:key];
+        }
+    }];
+    
+    for (NSString * const key in keys) {
+        HUBComponentWrapper * const componentWrapper = self.preparedComponentWrappers[key];
+        self.preparedComponentWrappers[key] = nil;
+        [self discardPreparedComponentWrapper:componentWrapper];
+    }
+}
+
+- (void)discardPreparedComponentWrapper:(HUBComponentWrapper *)componentWrapper
+{
+    NSString * const modelIdentifier = componentWrapper.model.identifier;
+    
+    if (self.componentWrappersByModelIdentifier[modelIdentifier] == componentWrapper) {
+        self.componentWrappersByModelIdentifier[modelIdentifier] = nil;
+    }
+    
+    self.componentWrappersByIdentifier[componentWrapper.identifier] = nil;
+    componentWrapper.parent = nil;
+    [self.componentReusePool addComponentWrappper:componentWrapper];
 }
 
 - (CGSize)childComponentContainerViewSizeForParentWrapper:(HUBComponentWrapper *)parentWrapper
@@ -1291,24 +1675,93 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
     if (CGSizeEqualToSize(preferredSize, CGSizeZero)) {
         return;
     }
+    
+    NSURL *URLToLoad = imageURL;
+    id<HUBImageLoader> const imageLoader = self.imageLoader;
+    
+    if ([imageLoader conformsToProtocol:@protocol(HUBImageLoaderWithSizeVariants)]) {
+        URLToLoad = [(id<HUBImageLoaderWithSizeVariants>)imageLoader URLForImageWithData:imageData targetSize:preferredSize];
+    }
 
     HUBComponentImageLoadingContext * const context = [[HUBComponentImageLoadingContext alloc] initWithImageType:imageData.type
                                                                                                  imageIdentifier:imageData.identifier
+                                                                                                        imageURL:imageURL
                                                                                                wrapperIdentifier:componentWrapper.identifier
                                                                                                       childIndex:childIndex
                                                                                                        timestamp:[NSDate date].timeIntervalSinceReferenceDate];
     
-    NSMutableArray *contextsForURL = self.componentImageLoadingContexts[imageURL];
+    NSMutableArray *contextsForURL = self.componentImageLoadingContexts[URLToLoad];
 
     if (contextsForURL == nil) {
         contextsForURL = [NSMutableArray arrayWithObject:context];
-        self.componentImageLoadingContexts[imageURL] = contextsForURL;
-        [self.imageLoader loadImageForURL:imageURL targetSize:preferredSize];
+        self.componentImageLoadingContexts[URLToLoad] = contextsForURL;
+        
+        if (self.performanceTracker.enabled) {
+            self.imageLoadPerformanceIntervals[URLToLoad] = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventImageLoad
+                                                                                                     label:URLToLoad.absoluteString];
+        }
+        
+        [self enqueueImageLoadForURL:URLToLoad targetSize:preferredSize];
     } else {
         [contextsForURL addObject:context];
     }
 }
 
+- (void)enqueueImageLoadForURL:(NSURL *)imageURL targetSize:(CGSize)targetSize
+{
+    // Loaders that don't batch requests gain nothing from waiting, so their images are loaded right away
+    if (!self.imageLoaderBatchesRequests) {
+        [self trackViewportImageLoadForURLs:@[imageURL]];
+        [self.imageLoader loadImageForURL:imageURL targetSize:targetSize];
+        return;
+    }
+    
+    BOOL const shouldScheduleLoading = (self.pendingImageURLs.count == 0);
+    
+    [self.pendingImageURLs addObject:imageURL];
+    [self.pendingImageTargetSizes addObject:[NSValue valueWithCGSize:targetSize]];
+    
+    if (!shouldScheduleLoading) {
+        return;
+    }
+    
+    // Images requested while rendering the same set of components are loaded together, once rendering has finished
+    __weak __typeof(self) weakSelf = self;
+    
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf loadPendingImages];
+    });
+}
+
+- (void)loadPendingImages
+{
+    if (self.pendingImageURLs.count == 0) {
+        return;
+    }
+    
+    NSArray<NSURL *> * const imageURLs = [self.pendingImageURLs copy];
+    NSArray<NSValue *> * const targetSizes = [self.pendingImageTargetSizes copy];
+    [self.pendingImageURLs removeAllObjects];
+    [self.pendingImageTargetSizes removeAllObjects];
+    
+    [self trackViewportImageLoadForURLs:imageURLs];
+    [(id<HUBImageLoaderWithBatchedRequests>)self.imageLoader loadImagesForURLs:imageURLs targetSizes:targetSizes];
+}
+
+- (void)trackViewportImageLoadForURLs:(NSArray<NSURL *> *)imageURLs
+{
+    if (self.performanceTracker.enabled) {
+        if (self.viewportImageLoadPerformanceInterval == nil) {
+            self.viewportImageLoadPerformanceInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventViewportImageLoad
+                                                                                                 label:nil];
+            self.viewportImageCount = 0;
+        }
+        
+        [self.viewportImageURLsBeingLoaded addObjectsFromArray:imageURLs];
+        self.viewportImageCount += imageURLs.count;
+    }
+}
+
 - (void)handleLoadedComponentImage:(UIImage *)image forURL:(NSURL *)imageURL context:(HUBComponentImageLoadingContext *)context
 {
     id<HUBViewModel> const viewModel = self.viewModel;
@@ -1350,17 +1803,53 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
         }
     }
     
-    if (![imageData.URL isEqual:imageURL]) {
+    if (![imageData.URL isEqual:context.imageURL]) {
         return;
     }
 
     NSTimeInterval downloadTime = [NSDate date].timeIntervalSinceReferenceDate - context.timestamp;
     BOOL animated = downloadTime > HUBImageDownloadTimeThreshold;
 
+    CFTimeInterval const imageApplicationStartTime = [self.frameProfiler beginSample];
+    
     [componentWrapper updateViewForLoadedImage:image
                                       fromData:imageData
                                          model:componentModel
                                       animated:animated];
+    
+    [self endFrameProfilerSampleWithStartTime:imageApplicationStartTime
+                                     category:HUBFrameProfilerCategoryImageApplication
+                               componentModel:componentModel];
+}
+
+- (void)endImageLoadPerformanceIntervalForURL:(NSURL *)imageURL componentCount:(NSUInteger)componentCount
+{
+    HUBPerformanceIntervalImplementation * const interval = self.imageLoadPerformanceIntervals[imageURL];
+    
+    if (interval == nil) {
+        return;
+    }
+    
+    self.imageLoadPerformanceIntervals[imageURL] = nil;
+    [self.performanceTracker endInterval:interval itemCount:componentCount];
+}
+
+- (void)endViewportImageLoadPerformanceIntervalIfNeededForURL:(NSURL *)imageURL
+{
+    HUBPerformanceIntervalImplementation * const interval = self.viewportImageLoadPerformanceInterval;
+    
+    if (interval == nil) {
+        return;
+    }
+    
+    [self.viewportImageURLsBeingLoaded removeObject:imageURL];
+    
+    if (self.viewportImageURLsBeingLoaded.count > 0) {
+        return;
+    }
+    
+    self.viewportImageLoadPerformanceInterval = nil;
+    [self.performanceTracker endInterval:interval itemCount:self.viewportImageCount];
 }
 
 - (nullable id<HUBComponentModel>)childModelAtIndex:(NSUInteger)childIndex fromComponentWrapper:(HUBComponentWrapper *)componentWrapper
@@ -1396,9 +1885,24 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
 
     BOOL actionWasHandled = [self.actionHandler handleActionWithContext:context];
 
-    for (HUBComponentWrapper *componentWrapper in self.actionObservingComponentWrappers) {
-        id<HUBComponentActionObserver> observer = componentWrapper;
-        [observer actionPerformedWithContext:context];
+    if (customIdentifier == nil) {
+        for (HUBComponentWrapper *componentWrapper in self.actionObservingComponentWrappers) {
+            id<HUBComponentActionObserver> observer = componentWrapper;
+            [observer actionPerformedWithContext:context];
+        }
+    } else {
+        // Custom actions are only sent to the observers that are interested in their namespace
+        NSString * const actionNamespace = customIdentifier.namespacePart;
+        
+        for (HUBComponentWrapper *componentWrapper in self.unfilteredActionObservingComponentWrappers) {
+            id<HUBComponentActionObserver> observer = componentWrapper;
+            [observer actionPerformedWithContext:context];
+        }
+        
+        for (HUBComponentWrapper *componentWrapper in self.actionObservingComponentWrappersByNamespace[actionNamespace]) {
+            id<HUBComponentActionObserver> observer = componentWrapper;
+            [observer actionPerformedWithContext:context];
+        }
     }
 
     return actionWasHandled;
@@ -1412,6 +1916,23 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
 
     if (componentWrapper.isActionObserver) {
         [self.actionObservingComponentWrappers addObject:componentWrapper];
+        
+        NSSet<NSString *> * const observedNamespaces = componentWrapper.observedCustomActionNamespaces;
+        
+        if (observedNamespaces == nil) {
+            [self.unfilteredActionObservingComponentWrappers addObject:componentWrapper];
+        }
+        
+        for (NSString * const actionNamespace in observedNamespaces) {
+            NSHashTable<id<HUBComponentActionObserver>> *namespaceObservers = self.actionObservingComponentWrappersByNamespace[actionNamespace];
+            
+            if (namespaceObservers == nil) {
+                namespaceObservers = [NSHashTable hashTableWithOptions:NSPointerFunctionsWeakMemory];
+                self.actionObservingComponentWrappersByNamespace[actionNamespace] = namespaceObservers;
+            }
+            
+            [namespaceObservers addObject:componentWrapper];
+        }
     }
 }
 
@@ -1423,6 +1944,11 @@ willUpdateSelectionState:(HUBComponentSelectionState)selectionState
 
     if (componentWrapper.isActionObserver) {
         [self.actionObservingComponentWrappers removeObject:componentWrapper];
+        [self.unfilteredActionObservingComponentWrappers removeObject:componentWrapper];
+        
+        for (NSString * const actionNamespace in componentWrapper.observedCustomActionNamespaces) {
+            [self.actionObservingComponentWrappersByNamespace[actionNamespace] removeObject:componentWrapper];
+        }
     }
 }
 
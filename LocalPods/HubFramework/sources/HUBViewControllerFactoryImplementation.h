@@ -31,6 +31,9 @@
 @class HUBComponentRegistryImplementation;
 @class HUBInitialViewModelRegistry;
 @class HUBActionRegistryImplementation;
+@class HUBPerformanceTracker;
+@class HUBFrameProfilerImplementation;
+@class HUBComponentUIStateCacheImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -48,6 +51,9 @@ NS_ASSUME_NONNULL_BEGIN
  *  @param defaultActionHandler Any user-defined action handler to use for features that don't define their own
  *  @param componentLayoutManager The object that manages layout for components for created view controllers
  *  @param imageLoaderFactory The factory to use to create image loaders
+ *  @param performanceTracker The root performance tracker of the current `HUBManager`
+ *  @param frameProfiler Any frame profiler that created view controllers should report component work to
+ *  @param componentUIStateCache The cache that determines how created view controllers keep component UI states
  */
 - (instancetype)initWithViewModelLoaderFactory:(HUBViewModelLoaderFactoryImplementation *)viewModelLoaderFactory
                                featureRegistry:(HUBFeatureRegistryImplementation *)featureRegistry
@@ -56,7 +62,10 @@ NS_ASSUME_NONNULL_BEGIN
                                 actionRegistry:(HUBActionRegistryImplementation *)actionRegistry
                           defaultActionHandler:(nullable id<HUBActionHandler>)defaultActionHandler
                         componentLayoutManager:(id<HUBComponentLayoutManager>)componentLayoutManager
-                            imageLoaderFactory:(nullable id<HUBImageLoaderFactory>)imageLoaderFactory HUB_DESIGNATED_INITIALIZER;
+                            imageLoaderFactory:(nullable id<HUBImageLoaderFactory>)imageLoaderFactory
+                            performanceTracker:(HUBPerformanceTracker *)performanceTracker
+                                 frameProfiler:(nullable HUBFrameProfilerImplementation *)frameProfiler
+                         componentUIStateCache:(HUBComponentUIStateCacheImplementation *)componentUIStateCache HUB_DESIGNATED_INITIALIZER;
 
 @end
 
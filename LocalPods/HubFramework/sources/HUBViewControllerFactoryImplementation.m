@@ -37,6 +37,9 @@
 #import "HUBViewModelRenderer.h"
 #import "HUBViewURIPredicate.h"
 #import "HUBBlockContentOperationFactory.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBFrameProfilerImplementation.h"
+#import "HUBComponentUIStateCacheImplementation.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -50,6 +53,9 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly, nullable) id<HUBActionHandler> defaultActionHandler;
 @property (nonatomic, strong, readonly) id<HUBComponentLayoutManager> componentLayoutManager;
 @property (nonatomic, strong, readonly, nullable) id<HUBImageLoaderFactory> imageLoaderFactory;
+@property (nonatomic, strong, readonly) HUBPerformanceTracker *performanceTracker;
+@property (nonatomic, strong, readonly, nullable) HUBFrameProfilerImplementation *frameProfiler;
+@property (nonatomic, strong, readonly) HUBComponentUIStateCacheImplementation *componentUIStateCache;
 
 @end
 
@@ -63,6 +69,9 @@ NS_ASSUME_NONNULL_BEGIN
                           defaultActionHandler:(nullable id<HUBActionHandler>)defaultActionHandler
                         componentLayoutManager:(id<HUBComponentLayoutManager>)componentLayoutManager
                             imageLoaderFactory:(nullable id<HUBImageLoaderFactory>)imageLoaderFactory
+                            performanceTracker:(HUBPerformanceTracker *)performanceTracker
+                                 frameProfiler:(nullable HUBFrameProfilerImplementation *)frameProfiler
+                         componentUIStateCache:(HUBComponentUIStateCacheImplementation *)componentUIStateCache
 {
     NSParameterAssert(viewModelLoaderFactory != nil);
     NSParameterAssert(featureRegistry != nil);
@@ -70,6 +79,8 @@ NS_ASSUME_NONNULL_BEGIN
     NSParameterAssert(initialViewModelRegistry != nil);
     NSParameterAssert(actionRegistry != nil);
     NSParameterAssert(componentLayoutManager != nil);
+    NSParameterAssert(performanceTracker != nil);
+    NSParameterAssert(componentUIStateCache != nil);
     
     self = [super init];
     
@@ -82,6 +93,9 @@ NS_ASSUME_NONNULL_BEGIN
         _defaultActionHandler = defaultActionHandler;
         _componentLayoutManager = componentLayoutManager;
         _imageLoaderFactory = imageLoaderFactory;
+        _performanceTracker = performanceTracker;
+        _frameProfiler = frameProfiler;
+        _componentUIStateCache = componentUIStateCache;
     }
     
     return self;
@@ -147,10 +161,14 @@ NS_ASSUME_NONNULL_BEGIN
     HUBViewModelLoaderImplementation * const viewModelLoader = [self.viewModelLoaderFactory createViewModelLoaderForViewURI:viewURI
                                                                                                         featureRegistration:featureRegistration];
     
-    HUBViewModelRenderer * const viewModelRenderer = [HUBViewModelRenderer new];
+    HUBPerformanceTracker * const performanceTracker = [self.performanceTracker trackerForViewURI:viewURI
+                                                                                featureIdentifier:featureRegistration.featureIdentifier];
+    
+    HUBViewModelRenderer * const viewModelRenderer = [[HUBViewModelRenderer alloc] initWithPerformanceTracker:performanceTracker];
     id<HUBImageLoader> const imageLoader = [self.imageLoaderFactory createImageLoader];
     HUBCollectionViewFactory * const collectionViewFactory = [HUBCollectionViewFactory new];
-    HUBComponentReusePool * const componentReusePool = [[HUBComponentReusePool alloc] initWithComponentRegistry:self.componentRegistry];
+    HUBComponentReusePool * const componentReusePool = [[HUBComponentReusePool alloc] initWithComponentRegistry:self.componentRegistry
+                                                                                                   UIStateCache:self.componentUIStateCache];
     
     id<HUBActionHandler> const actionHandler = featureRegistration.actionHandler ?: self.defaultActionHandler;
     id<HUBActionHandler> const actionHandlerWrapper = [[HUBActionHandlerWrapper alloc] initWithActionHandler:actionHandler
@@ -170,7 +188,9 @@ NS_ASSUME_NONNULL_BEGIN
                                componentLayoutManager:self.componentLayoutManager
                                         actionHandler:actionHandlerWrapper
                                         scrollHandler:scrollHandlerToUse
-                                          imageLoader:imageLoader];
+                                          imageLoader:imageLoader
+                                   performanceTracker:performanceTracker
+                                        frameProfiler:self.frameProfiler];
 }
 
 @end
@@ -48,6 +48,17 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (id<HUBViewModel>)build;
 
+/**
+ *  Prepare the builder to build its body content by appending to an existing view model
+ *
+ *  @param viewModel The view model that was built from the current content of this builder
+ *
+ *  As long as none of the existing body component model builders are accessed or removed, `build` will reuse the body
+ *  component models of the given view model, and only build the ones that were added after this method was called. Any
+ *  access to an existing body component model builder makes the builder fall back to building all of its content.
+ */
+- (void)prepareForAppendingToViewModel:(id<HUBViewModel>)viewModel;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -24,6 +24,7 @@
 #import "HUBViewModelImplementation.h"
 #import "HUBComponentModelBuilderImplementation.h"
 #import "HUBComponentModelImplementation.h"
+#import "HUBWindowedComponentModelArray.h"
 #import "HUBJSONSchema.h"
 #import "HUBViewModelJSONSchema.h"
 #import "HUBComponentModelJSONSchema.h"
@@ -32,6 +33,15 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// The number of body components above which their models are built on demand, rather than up front
+static NSUInteger const HUBWindowedBodyComponentModelThreshold = 1000;
+
+/// The number of body component models to keep in memory at any time when they are built on demand
+static NSUInteger const HUBWindowedBodyComponentModelWindowSize = 256;
+
+/// The number of component model dictionaries in a JSON array above which they are added to their builders in parallel
+static NSUInteger const HUBParallelComponentModelIngestionThreshold = 256;
+
 @interface HUBViewModelBuilderImplementation ()
 
 @property (nonatomic, strong, readonly) id<HUBJSONSchema> JSONSchema;
@@ -43,6 +53,9 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSString *, HUBComponentModelBuilderImplementation *> *overlayComponentModelBuilders;
 @property (nonatomic, strong, readonly) NSMutableArray<NSString *> *bodyComponentIdentifierOrder;
 @property (nonatomic, strong, readonly) NSMutableArray<NSString *> *overlayComponentIdentifierOrder;
+@property (nonatomic, strong, nullable) id<HUBViewModel> appendableViewModel;
+@property (nonatomic, strong, readonly) NSMutableSet<NSString *> *appendedBodyComponentIdentifiers;
+@property (nonatomic, assign) BOOL bodyComponentModelBuildersAreShared;
 
 @end
 
@@ -72,6 +85,7 @@ NS_ASSUME_NONNULL_BEGIN
         _overlayComponentModelBuilders = [NSMutableDictionary new];
         _bodyComponentIdentifierOrder = [NSMutableArray new];
         _overlayComponentIdentifierOrder = [NSMutableArray new];
+        _appendedBodyComponentIdentifiers = [NSMutableSet new];
     }
     
     return self;
@@ -219,6 +233,8 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
     
+    [self bodyComponentModelBuilderWillBeModifiedWithIdentifier:identifier];
+    [self.appendedBodyComponentIdentifiers removeObject:identifier];
     [self.bodyComponentModelBuilders removeObjectForKey:identifier];
     [self.bodyComponentIdentifierOrder removeObject:identifier];
 }
@@ -237,6 +253,9 @@ NS_ASSUME_NONNULL_BEGIN
 {
     [self removeHeaderComponentModelBuilder];
     
+    self.appendableViewModel = nil;
+    [self.appendedBodyComponentIdentifiers removeAllObjects];
+    self.bodyComponentModelBuildersAreShared = NO;
     [self.bodyComponentModelBuilders removeAllObjects];
     [self.bodyComponentIdentifierOrder removeAllObjects];
     
@@ -250,9 +269,17 @@ NS_ASSUME_NONNULL_BEGIN
 {
     id<HUBComponentModel> const headerComponentModel = [self.headerComponentModelBuilderImplementation buildForIndex:0 parent:nil];
     
-    NSArray * const bodyComponentModels = [HUBComponentModelBuilderImplementation buildComponentModelsUsingBuilders:self.bodyComponentModelBuilders
-                                                                                                    identifierOrder:self.bodyComponentIdentifierOrder
-                                                                                                             parent:nil];
+    NSArray *bodyComponentModels = [self buildBodyComponentModelsByAppendingToViewModel];
+    
+    if (bodyComponentModels == nil) {
+        if (self.bodyComponentIdentifierOrder.count > HUBWindowedBodyComponentModelThreshold) {
+            bodyComponentModels = [self buildWindowedBodyComponentModels];
+        } else {
+            bodyComponentModels = [HUBComponentModelBuilderImplementation buildComponentModelsUsingBuilders:self.bodyComponentModelBuilders
+                                                                                           identifierOrder:self.bodyComponentIdentifierOrder
+                                                                                                    parent:nil];
+        }
+    }
     
     NSArray * const overlayComponentModels = [HUBComponentModelBuilderImplementation buildComponentModelsUsingBuilders:self.overlayComponentModelBuilders
                                                                                                        identifierOrder:self.overlayComponentIdentifierOrder
@@ -266,6 +293,12 @@ NS_ASSUME_NONNULL_BEGIN
                                                        customData:[self.customData copy]];
 }
 
+- (void)prepareForAppendingToViewModel:(id<HUBViewModel>)viewModel
+{
+    self.appendableViewModel = viewModel;
+    [self.appendedBodyComponentIdentifiers removeAllObjects];
+}
+
 #pragma mark - Manipulate custom data
 
 - (void)setCustomDataValue:(nullable id)value forKey:(nonnull NSString *)key
@@ -342,18 +375,17 @@ NS_ASSUME_NONNULL_BEGIN
     }
     
     NSArray * const bodyComponentModelDictionaries = [viewModelSchema.bodyComponentModelDictionariesPath valuesFromJSONDictionary:dictionary];
-    
-    for (NSDictionary * const componentModelDictionary in bodyComponentModelDictionaries) {
-        [self addDataFromBodyComponentModelJSONDictionary:componentModelDictionary];
-    }
+    [self addDataFromBodyComponentModelJSONDictionaries:bodyComponentModelDictionaries];
     
     NSArray * const overlayComponentModelDictionaries = [viewModelSchema.overlayComponentModelDictionariesPath valuesFromJSONDictionary:dictionary];
+    NSMutableArray<HUBComponentModelBuilderImplementation *> * const overlayComponentModelBuilders = [NSMutableArray new];
     
     for (NSDictionary * const componentModelDictionary in overlayComponentModelDictionaries) {
         NSString * const componentIdentifier = [self.JSONSchema.componentModelSchema.identifierPath stringFromJSONDictionary:componentModelDictionary];
-        HUBComponentModelBuilderImplementation * const componentModelBuilder = [self getOrCreateBuilderForOverlayComponentModelWithIdentifier:componentIdentifier];
-        [componentModelBuilder addJSONDictionary:componentModelDictionary];
+        [overlayComponentModelBuilders addObject:[self getOrCreateBuilderForOverlayComponentModelWithIdentifier:componentIdentifier]];
     }
+    
+    [self addJSONDictionaries:overlayComponentModelDictionaries toComponentModelBuilders:overlayComponentModelBuilders];
 }
 
 #pragma mark - NSObject
@@ -392,6 +424,9 @@ NS_ASSUME_NONNULL_BEGIN
     [copy.bodyComponentIdentifierOrder addObjectsFromArray:self.bodyComponentIdentifierOrder];
     [copy.overlayComponentIdentifierOrder addObjectsFromArray:self.overlayComponentIdentifierOrder];
     
+    copy.appendableViewModel = self.appendableViewModel;
+    [copy.appendedBodyComponentIdentifiers unionSet:self.appendedBodyComponentIdentifiers];
+    
     return copy;
 }
 
@@ -399,18 +434,84 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)addDataFromJSONArray:(NSArray<NSObject *> *)array
 {
+    NSMutableArray<NSDictionary<NSString *, NSObject *> *> * const dictionaries = [NSMutableArray new];
+    
     for (NSObject * const object in array) {
         if ([object isKindOfClass:[NSDictionary class]]) {
-            [self addDataFromBodyComponentModelJSONDictionary:(NSDictionary *)object];
+            [dictionaries addObject:(NSDictionary *)object];
         }
     }
+    
+    [self addDataFromBodyComponentModelJSONDictionaries:dictionaries];
 }
 
-- (void)addDataFromBodyComponentModelJSONDictionary:(NSDictionary<NSString *, NSObject *> *)dictionary
+- (void)addDataFromBodyComponentModelJSONDictionaries:(NSArray<NSDictionary<NSString *, NSObject *> *> *)dictionaries
 {
-    NSString * const identifier = [self.JSONSchema.componentModelSchema.identifierPath stringFromJSONDictionary:dictionary];
-    HUBComponentModelBuilderImplementation * const builder = [self getOrCreateBuilderForBodyComponentModelWithIdentifier:identifier];
-    [builder addJSONDictionary:dictionary];
+    NSMutableArray<HUBComponentModelBuilderImplementation *> * const builders = [NSMutableArray new];
+    
+    // Builders are resolved up front on the calling thread, to keep their order and identifier-based merging intact
+    for (NSDictionary<NSString *, NSObject *> * const dictionary in dictionaries) {
+        NSString * const identifier = [self.JSONSchema.componentModelSchema.identifierPath stringFromJSONDictionary:dictionary];
+        [builders addObject:[self getOrCreateBuilderForBodyComponentModelWithIdentifier:identifier]];
+    }
+    
+    [self addJSONDictionaries:dictionaries toComponentModelBuilders:builders];
+}
+
+- (void)addJSONDictionaries:(NSArray<NSDictionary<NSString *, NSObject *> *> *)dictionaries
+   toComponentModelBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders
+{
+    NSParameterAssert(dictionaries.count == builders.count);
+    
+    if (dictionaries.count <= HUBParallelComponentModelIngestionThreshold) {
+        [dictionaries enumerateObjectsUsingBlock:^(NSDictionary<NSString *, NSObject *> *dictionary, NSUInteger index, BOOL *stop) {
+            [builders[index] addJSONDictionary:dictionary];
+        }];
+        
+        return;
+    }
+    
+    /*
+     *  Dictionaries with the same identifier are added to the same builder, so they're grouped per builder (in the
+     *  order that they appear in) to make sure each builder is only ever mutated by a single thread.
+     */
+    NSMapTable<HUBComponentModelBuilderImplementation *, NSMutableArray<NSDictionary *> *> * const dictionariesByBuilder = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality
+                                                                                                                                                valueOptions:NSPointerFunctionsStrongMemory];
+    NSMutableArray<HUBComponentModelBuilderImplementation *> * const uniqueBuilders = [NSMutableArray new];
+    NSMutableArray<NSArray<NSDictionary *> *> * const dictionaryGroups = [NSMutableArray new];
+    
+    [dictionaries enumerateObjectsUsingBlock:^(NSDictionary<NSString *, NSObject *> *dictionary, NSUInteger index, BOOL *stop) {
+        HUBComponentModelBuilderImplementation * const builder = builders[index];
+        NSMutableArray<NSDictionary *> *group = [dictionariesByBuilder objectForKey:builder];
+        
+        if (group == nil) {
+            group = [NSMutableArray new];
+            [dictionariesByBuilder setObject:group forKey:builder];
+            [uniqueBuilders addObject:builder];
+            [dictionaryGroups addObject:group];
+        }
+        
+        [group addObject:dictionary];
+    }];
+    
+    NSUInteger const builderCount = uniqueBuilders.count;
+    NSUInteger const partitionCount = MIN(builderCount, [NSProcessInfo processInfo].activeProcessorCount);
+    dispatch_queue_t const queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    
+    dispatch_apply(partitionCount, queue, ^(size_t partitionIndex) {
+        NSUInteger const start = builderCount * partitionIndex / partitionCount;
+        NSUInteger const end = builderCount * (partitionIndex + 1) / partitionCount;
+        
+        for (NSUInteger builderIndex = start; builderIndex < end; builderIndex++) {
+            @autoreleasepool {
+                HUBComponentModelBuilderImplementation * const builder = uniqueBuilders[builderIndex];
+                
+                for (NSDictionary<NSString *, NSObject *> * const dictionary in dictionaryGroups[builderIndex]) {
+                    [builder addJSONDictionary:dictionary];
+                }
+            }
+        }
+    });
 }
 
 - (HUBComponentModelBuilderImplementation *)getOrCreateBuilderForHeaderComponentModelWithIdentifier:(nullable NSString *)identifier
@@ -436,13 +537,21 @@ NS_ASSUME_NONNULL_BEGIN
                                                                                                        modelIdentifier:identifier];
     
     if (existingBuilder != nil) {
-        return existingBuilder;
+        NSString * const existingIdentifier = existingBuilder.modelIdentifier;
+        [self bodyComponentModelBuilderWillBeModifiedWithIdentifier:existingIdentifier];
+        [self copyBodyComponentModelBuildersIfShared];
+        
+        return self.bodyComponentModelBuilders[existingIdentifier] ?: existingBuilder;
     }
     
     HUBComponentModelBuilderImplementation * const newBuilder = [self createComponentModelBuilderWithIdentifier:identifier type:HUBComponentTypeBody];
     self.bodyComponentModelBuilders[newBuilder.modelIdentifier] = newBuilder;
     [self.bodyComponentIdentifierOrder addObject:newBuilder.modelIdentifier];
     
+    if (self.appendableViewModel != nil) {
+        [self.appendedBodyComponentIdentifiers addObject:newBuilder.modelIdentifier];
+    }
+    
     return newBuilder;
 }
 
@@ -489,6 +598,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (BOOL)enumerateBodyComponentModelBuildersWithBlock:(BOOL(^)(id<HUBComponentModelBuilder>))block
 {
+    self.appendableViewModel = nil;
+    [self copyBodyComponentModelBuildersIfShared];
+    
     return [self enumerateComponentModelBuilders:self.bodyComponentModelBuilders
                                  identifierOrder:self.bodyComponentIdentifierOrder
                                        withBlock:block];
@@ -516,6 +628,86 @@ NS_ASSUME_NONNULL_BEGIN
     return YES;
 }
 
+- (void)bodyComponentModelBuilderWillBeModifiedWithIdentifier:(NSString *)identifier
+{
+    if ([self.appendedBodyComponentIdentifiers containsObject:identifier]) {
+        return;
+    }
+    
+    // A builder for a component model that has already been built is being exposed, so it can no longer be reused
+    self.appendableViewModel = nil;
+}
+
+- (void)copyBodyComponentModelBuildersIfShared
+{
+    if (!self.bodyComponentModelBuildersAreShared) {
+        return;
+    }
+    
+    // The builders are used to lazily build the models of a windowed array, so they need to be copied before being mutated
+    for (NSString * const identifier in self.bodyComponentModelBuilders.allKeys) {
+        self.bodyComponentModelBuilders[identifier] = [self.bodyComponentModelBuilders[identifier] copy];
+    }
+    
+    self.bodyComponentModelBuildersAreShared = NO;
+}
+
+- (NSArray<id<HUBComponentModel>> *)buildWindowedBodyComponentModels
+{
+    NSArray<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [HUBComponentModelBuilderImplementation sortedBuildersFromBuilders:self.bodyComponentModelBuilders
+                                                                                                                                 identifierOrder:self.bodyComponentIdentifierOrder];
+    
+    self.bodyComponentModelBuildersAreShared = YES;
+    
+    return [[HUBWindowedComponentModelArray alloc] initWithBuilders:sortedBuilders
+                                                         windowSize:HUBWindowedBodyComponentModelWindowSize];
+}
+
+- (nullable NSArray<id<HUBComponentModel>> *)buildBodyComponentModelsByAppendingToViewModel
+{
+    id<HUBViewModel> const viewModel = self.appendableViewModel;
+    
+    if (viewModel == nil) {
+        return nil;
+    }
+    
+    NSArray<id<HUBComponentModel>> * const existingComponentModels = viewModel.bodyComponentModels;
+    NSArray<NSString *> * const identifierOrder = self.bodyComponentIdentifierOrder;
+    NSUInteger const existingCount = existingComponentModels.count;
+    
+    if (identifierOrder.count != existingCount + self.appendedBodyComponentIdentifiers.count) {
+        return nil;
+    }
+    
+    // Preferred indexes can move existing component models, which requires all of them to be rebuilt
+    for (HUBComponentModelBuilderImplementation * const builder in self.bodyComponentModelBuilders.objectEnumerator) {
+        if (builder.preferredIndex != nil) {
+            return nil;
+        }
+    }
+    
+    if ([existingComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]]) {
+        NSMutableArray<HUBComponentModelBuilderImplementation *> * const appendedBuilders = [NSMutableArray new];
+        
+        for (NSUInteger index = existingCount; index < identifierOrder.count; index++) {
+            [appendedBuilders addObject:self.bodyComponentModelBuilders[identifierOrder[index]]];
+        }
+        
+        self.bodyComponentModelBuildersAreShared = YES;
+        
+        return [(HUBWindowedComponentModelArray *)existingComponentModels arrayByAppendingBuilders:appendedBuilders];
+    }
+    
+    NSMutableArray<id<HUBComponentModel>> * const componentModels = [existingComponentModels mutableCopy];
+    
+    for (NSUInteger index = existingCount; index < identifierOrder.count; index++) {
+        HUBComponentModelBuilderImplementation * const builder = self.bodyComponentModelBuilders[identifierOrder[index]];
+        [componentModels addObject:[builder buildForIndex:index parent:nil]];
+    }
+    
+    return [componentModels copy];
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
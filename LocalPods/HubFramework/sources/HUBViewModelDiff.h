@@ -96,6 +96,22 @@ extern HUBViewModelDiff *HUBDiffMyersAlgorithm(id<HUBViewModel>, id<HUBViewModel
 + (instancetype)diffFromViewModel:(id<HUBViewModel>)fromViewModel
                       toViewModel:(id<HUBViewModel>)toViewModel;
 
+/**
+ * Initializes a @c HUBViewModelDiff containing only insertions, if the new view model was created by appending
+ * body components to the old one.
+ *
+ * The new view model is considered to be appended to the old one if its body component models start with the
+ * very same instances as the ones of the old view model. This is checked in O(N) time, without comparing any
+ * component models for equality.
+ *
+ * @param fromViewModel The view model that is being transitioned from.
+ * @param toViewModel The view model that is being transitioned to.
+ *
+ * @returns An instance of @c HUBViewModelDiff, or nil if the new view model wasn't appended to the old one.
+ */
++ (nullable instancetype)appendingDiffFromViewModel:(id<HUBViewModel>)fromViewModel
+                                        toViewModel:(id<HUBViewModel>)toViewModel;
+
 + (instancetype)new NS_UNAVAILABLE;
 - (instancetype)init NS_UNAVAILABLE;
 
@@ -22,6 +22,7 @@
 
 #import "HUBViewModelDiff.h"
 #import "HUBComponentModel.h"
+#import "HUBWindowedComponentModelArray.h"
 
 #import <UIKit/UIKit.h>
 
@@ -66,6 +67,39 @@ static inline NSArray<NSIndexPath *> *HUBIndexSetToIndexPathArray(NSIndexSet *in
     return [self diffFromViewModel:fromViewModel toViewModel:toViewModel algorithm:HUBDiffMyersAlgorithm];
 }
 
++ (nullable instancetype)appendingDiffFromViewModel:(id<HUBViewModel>)fromViewModel
+                                        toViewModel:(id<HUBViewModel>)toViewModel
+{
+    NSArray<id<HUBComponentModel>> * const fromComponentModels = fromViewModel.bodyComponentModels;
+    NSArray<id<HUBComponentModel>> * const toComponentModels = toViewModel.bodyComponentModels;
+    NSUInteger const fromCount = fromComponentModels.count;
+    NSUInteger const toCount = toComponentModels.count;
+
+    if (toCount <= fromCount) {
+        return nil;
+    }
+
+    if ([fromComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]] &&
+        [toComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]]) {
+        // Avoid building every single component model of a windowed array just to compare them
+        if (![(HUBWindowedComponentModelArray *)toComponentModels hasPrefixArray:(HUBWindowedComponentModelArray *)fromComponentModels]) {
+            return nil;
+        }
+
+        NSIndexSet * const inserts = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(fromCount, toCount - fromCount)];
+        return [[self alloc] initWithInserts:inserts deletes:[NSIndexSet indexSet] reloads:[NSIndexSet indexSet]];
+    }
+
+    for (NSUInteger index = 0; index < fromCount; index++) {
+        if (fromComponentModels[index] != toComponentModels[index]) {
+            return nil;
+        }
+    }
+
+    NSIndexSet * const inserts = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(fromCount, toCount - fromCount)];
+    return [[self alloc] initWithInserts:inserts deletes:[NSIndexSet indexSet] reloads:[NSIndexSet indexSet]];
+}
+
 - (NSString *)debugDescription
 {
     return [NSString stringWithFormat:@"\t{\n\
@@ -77,9 +111,30 @@ static inline NSArray<NSIndexPath *> *HUBIndexSetToIndexPathArray(NSIndexSet *in
 
 @end
 
+#pragma mark - Equality
+
+static BOOL HUBDiffBodyComponentModelsAreEqual(id<HUBViewModel> fromViewModel, NSUInteger fromIndex, id<HUBViewModel> toViewModel, NSUInteger toIndex) {
+    NSArray<id<HUBComponentModel>> *fromComponentModels = fromViewModel.bodyComponentModels;
+    NSArray<id<HUBComponentModel>> *toComponentModels = toViewModel.bodyComponentModels;
+
+    // Avoid building every single component model of a windowed array just to compare them
+    if ([fromComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]] &&
+        [toComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]]) {
+        return [(HUBWindowedComponentModelArray *)toComponentModels componentModelAtIndex:toIndex
+                                                          isEqualToComponentModelAtIndex:fromIndex
+                                                                                 inArray:(HUBWindowedComponentModelArray *)fromComponentModels];
+    }
+
+    return [toComponentModels[toIndex] isEqual:fromComponentModels[fromIndex]];
+}
+
 #pragma mark - Longest common subsequence
 
 static NSArray<NSString *> *HUBDiffComponentIdentifiersFromViewModel(id<HUBViewModel> viewModel) {
+    if ([viewModel.bodyComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]]) {
+        return ((HUBWindowedComponentModelArray *)viewModel.bodyComponentModels).componentModelIdentifiers;
+    }
+
     NSMutableArray *identifiers = [NSMutableArray arrayWithCapacity:viewModel.bodyComponentModels.count];
     for (id<HUBComponentModel> model in viewModel.bodyComponentModels) {
         [identifiers addObject:model.identifier];
@@ -120,7 +175,7 @@ HUBViewModelDiff *HUBDiffLCSAlgorithm(id<HUBViewModel> fromViewModel, id<HUBView
     NSMutableIndexSet *commonIndexSet = [NSMutableIndexSet indexSet];
     for (NSUInteger i = 0, j = 0 ; i < fromViewModelCount && j < toViewModelCount; ) {
         if ([firstIdentifiers[i] isEqualToString:secondIdentifiers[j]]) {
-            if (![fromViewModel.bodyComponentModels[i] isEqual:toViewModel.bodyComponentModels[j]]) {
+            if (!HUBDiffBodyComponentModelsAreEqual(fromViewModel, i, toViewModel, j)) {
                 [reloads addIndex:i];
             }
 
@@ -146,13 +201,13 @@ HUBViewModelDiff *HUBDiffLCSAlgorithm(id<HUBViewModel> fromViewModel, id<HUBView
         }
     }
 
-    NSArray<id<HUBComponentModel>> *commonObjects = [fromViewModel.bodyComponentModels objectsAtIndexes:commonIndexSet];
+    NSArray<NSString *> *commonIdentifiers = [firstIdentifiers objectsAtIndexes:commonIndexSet];
 
     /* Comparing second model indices to find reloads (if identifiers match but deep comparison fails) or
        insertions (if identifiers differ). */
-    for (NSUInteger i = 0, j = 0; i < commonObjects.count || j < toViewModelCount; ) {
-        if (i < commonObjects.count && j < toViewModelCount &&
-            [commonObjects[i].identifier isEqualToString:secondIdentifiers[j]]) {
+    for (NSUInteger i = 0, j = 0; i < commonIdentifiers.count || j < toViewModelCount; ) {
+        if (i < commonIdentifiers.count && j < toViewModelCount &&
+            [commonIdentifiers[i] isEqualToString:secondIdentifiers[j]]) {
             i++;
             j++;
         } else {
@@ -270,6 +325,8 @@ static NSArray<HUBDiffStep *> *HUBDiffMyersTracesBetweenViewModels(id<HUBViewMod
     NSInteger fromCount = (NSInteger)fromViewModel.bodyComponentModels.count;
     NSInteger toCount = (NSInteger)toViewModel.bodyComponentModels.count;
     NSInteger max = fromCount + toCount;
+    NSArray<NSString *> *fromIdentifiers = HUBDiffComponentIdentifiersFromViewModel(fromViewModel);
+    NSArray<NSString *> *toIdentifiers = HUBDiffComponentIdentifiersFromViewModel(toViewModel);
 
     /**
      * The algorithm can be visualized with an acyclic graph where the elements of the first sequence are
@@ -328,14 +385,14 @@ static NSArray<HUBDiffStep *> *HUBDiffMyersTracesBetweenViewModels(id<HUBViewMod
                 NSInteger y = step.to.y;
                 
                 while (x >= 0 && y >= 0 && x < fromCount && y < toCount) {
-                    id<HUBComponentModel> target = toViewModel.bodyComponentModels[(NSUInteger)y];
-                    id<HUBComponentModel> base = fromViewModel.bodyComponentModels[(NSUInteger)x];
+                    NSString *target = toIdentifiers[(NSUInteger)y];
+                    NSString *base = fromIdentifiers[(NSUInteger)x];
 
                     /**
                      * Only the element's identity is compared here, as equality is checked later in order to determine
                      * the location of updates.
                      */ 
-                    if ([base.identifier isEqual:target.identifier]) {
+                    if ([base isEqualToString:target]) {
                         // A match is found and another step can be taken diagonally.
                         x += 1;
                         y += 1;
@@ -424,9 +481,7 @@ HUBViewModelDiff *HUBDiffMyersAlgorithm(id<HUBViewModel> fromViewModel, id<HUBVi
             [deletions addIndex:(NSUInteger)step.from.x];
         } else if (type == HUBDiffStepTypeMatchPoint) {
             // Here we perform the deep equality check to determine if the element has actually changed.
-            id<HUBComponentModel> base = fromViewModel.bodyComponentModels[(NSUInteger)step.from.x];
-            id<HUBComponentModel> target = toViewModel.bodyComponentModels[(NSUInteger)step.from.y];
-            if (![target isEqual:base]) {
+            if (!HUBDiffBodyComponentModelsAreEqual(fromViewModel, (NSUInteger)step.from.x, toViewModel, (NSUInteger)step.from.y)) {
                 [reloads addIndex:(NSUInteger)step.from.x];
             }
         }
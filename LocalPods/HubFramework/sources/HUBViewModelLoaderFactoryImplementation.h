@@ -28,6 +28,8 @@
 @class HUBComponentDefaults;
 @class HUBFeatureRegistration;
 @class HUBViewModelLoaderImplementation;
+@class HUBPerformanceTracker;
+@class HUBContentOperationRecorderImplementation;
 @protocol HUBConnectivityStateResolver;
 @protocol HUBIconImageResolver;
 @protocol HUBContentOperationFactory;
@@ -52,6 +54,8 @@ NS_ASSUME_NONNULL_BEGIN
  *  @param appendedContentOperationFactory Any content operation factory which operations should be appended to all
  *         views' content loading chains.
  *  @param defaultContentReloadPolicy The default content reload policy used by features not defining their own
+ *  @param performanceTracker The root performance tracker of the current `HUBManager`
+ *  @param contentOperationRecorder Any recorder that created view model loaders should record content loading into
  */
 - (instancetype)initWithFeatureRegistry:(HUBFeatureRegistryImplementation *)featureRegistry
                      JSONSchemaRegistry:(HUBJSONSchemaRegistryImplementation *)JSONSchemaRegistry
@@ -61,7 +65,9 @@ NS_ASSUME_NONNULL_BEGIN
                       iconImageResolver:(nullable id<HUBIconImageResolver>)iconImageResolver
        prependedContentOperationFactory:(nullable id<HUBContentOperationFactory>)prependedContentOperationFactory
         appendedContentOperationFactory:(nullable id<HUBContentOperationFactory>)appendedContentOperationFactory
-             defaultContentReloadPolicy:(nullable id<HUBContentReloadPolicy>)defaultContentReloadPolicy HUB_DESIGNATED_INITIALIZER;
+             defaultContentReloadPolicy:(nullable id<HUBContentReloadPolicy>)defaultContentReloadPolicy
+                     performanceTracker:(HUBPerformanceTracker *)performanceTracker
+               contentOperationRecorder:(nullable HUBContentOperationRecorderImplementation *)contentOperationRecorder HUB_DESIGNATED_INITIALIZER;
 
 /**
  *  Create a view model loader for a given view URI, using a feature registration
@@ -29,6 +29,7 @@
 #import "HUBInitialViewModelRegistry.h"
 #import "HUBComponentDefaults.h"
 #import "HUBFeatureInfoImplementation.h"
+#import "HUBPerformanceTracker.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -43,6 +44,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, nullable, readonly) id<HUBContentOperationFactory> prependedContentOperationFactory;
 @property (nonatomic, strong, nullable, readonly) id<HUBContentOperationFactory> appendedContentOperationFactory;
 @property (nonatomic, strong, nullable, readonly) id<HUBContentReloadPolicy> defaultContentReloadPolicy;
+@property (nonatomic, strong, readonly) HUBPerformanceTracker *performanceTracker;
+@property (nonatomic, strong, nullable, readonly) HUBContentOperationRecorderImplementation *contentOperationRecorder;
 
 @end
 
@@ -57,12 +60,15 @@ NS_ASSUME_NONNULL_BEGIN
        prependedContentOperationFactory:(nullable id<HUBContentOperationFactory>)prependedContentOperationFactory
         appendedContentOperationFactory:(nullable id<HUBContentOperationFactory>)appendedContentOperationFactory
              defaultContentReloadPolicy:(nullable id<HUBContentReloadPolicy>)defaultContentReloadPolicy
+                     performanceTracker:(HUBPerformanceTracker *)performanceTracker
+               contentOperationRecorder:(nullable HUBContentOperationRecorderImplementation *)contentOperationRecorder
 {
     NSParameterAssert(featureRegistry != nil);
     NSParameterAssert(JSONSchemaRegistry != nil);
     NSParameterAssert(initialViewModelRegistry != nil);
     NSParameterAssert(componentDefaults != nil);
     NSParameterAssert(connectivityStateResolver != nil);
+    NSParameterAssert(performanceTracker != nil);
     
     self = [super init];
     
@@ -76,6 +82,8 @@ NS_ASSUME_NONNULL_BEGIN
         _prependedContentOperationFactory = prependedContentOperationFactory;
         _appendedContentOperationFactory = appendedContentOperationFactory;
         _defaultContentReloadPolicy = defaultContentReloadPolicy;
+        _performanceTracker = performanceTracker;
+        _contentOperationRecorder = contentOperationRecorder;
     }
     
     return self;
@@ -116,6 +124,8 @@ NS_ASSUME_NONNULL_BEGIN
     id<HUBContentReloadPolicy> const contentReloadPolicy = featureRegistration.contentReloadPolicy ?: self.defaultContentReloadPolicy;
     id<HUBJSONSchema> const JSONSchema = [self JSONSchemaForFeatureWithRegistration:featureRegistration];
     id<HUBViewModel> const initialViewModel = [self.initialViewModelRegistry initialViewModelForViewURI:viewURI];
+    HUBPerformanceTracker * const performanceTracker = [self.performanceTracker trackerForViewURI:viewURI
+                                                                                featureIdentifier:featureRegistration.featureIdentifier];
     
     return [[HUBViewModelLoaderImplementation alloc] initWithViewURI:viewURI
                                                          featureInfo:featureInfo
@@ -125,7 +135,9 @@ NS_ASSUME_NONNULL_BEGIN
                                                    componentDefaults:self.componentDefaults
                                            connectivityStateResolver:self.connectivityStateResolver
                                                    iconImageResolver:self.iconImageResolver
-                                                    initialViewModel:initialViewModel];
+                                                    initialViewModel:initialViewModel
+                                                  performanceTracker:performanceTracker
+                                            contentOperationRecorder:self.contentOperationRecorder];
 }
 
 #pragma mark - HUBViewModelLoaderFactory
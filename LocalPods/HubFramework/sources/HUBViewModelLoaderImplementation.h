@@ -31,6 +31,8 @@
 @protocol HUBActionContext;
 @protocol HUBActionPerformer;
 @class HUBComponentDefaults;
+@class HUBPerformanceTracker;
+@class HUBContentOperationRecorderImplementation;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -40,6 +42,10 @@ NS_ASSUME_NONNULL_BEGIN
 /// Any object that performs actions on behalf of this view model loader
 @property (nonatomic, weak, nullable) id<HUBActionPerformer> actionPerformer;
 
+/// The time to wait for the connectivity state to stop changing before reloading content. If `0`, content is reloaded
+/// as soon as the connectivity state resolver reports a change. Defaults to 0.5 seconds.
+@property (nonatomic, assign) NSTimeInterval connectivityStateChangeDebounceInterval;
+
 /**
  *  Initialize an instance of this class with its required dependencies & values
  *
@@ -52,6 +58,8 @@ NS_ASSUME_NONNULL_BEGIN
  *  @param connectivityStateResolver The connectivity state resolver used by the current `HUBManager`
  *  @param iconImageResolver The resolver to use to convert icons into renderable images
  *  @param initialViewModel Any pre-registered view model that the loader should include
+ *  @param performanceTracker The tracker to use to measure content operations and view model builds
+ *  @param contentOperationRecorder Any recorder to record content loading into, while it's recording
  */
 - (instancetype)initWithViewURI:(NSURL *)viewURI
                     featureInfo:(id<HUBFeatureInfo>)featureInfo
@@ -61,7 +69,9 @@ NS_ASSUME_NONNULL_BEGIN
               componentDefaults:(HUBComponentDefaults *)componentDefaults
       connectivityStateResolver:(id<HUBConnectivityStateResolver>)connectivityStateResolver
               iconImageResolver:(nullable id<HUBIconImageResolver>)iconImageResolver
-               initialViewModel:(nullable id<HUBViewModel>)initialViewModel HUB_DESIGNATED_INITIALIZER;
+               initialViewModel:(nullable id<HUBViewModel>)initialViewModel
+             performanceTracker:(HUBPerformanceTracker *)performanceTracker
+       contentOperationRecorder:(nullable HUBContentOperationRecorderImplementation *)contentOperationRecorder HUB_DESIGNATED_INITIALIZER;
 
 /**
  *  Notify the view model loader that an action was performed in the view that it is for
@@ -25,6 +25,7 @@
 #import "HUBConnectivityStateResolver.h"
 #import "HUBContentOperationWithInitialContent.h"
 #import "HUBContentOperationWithPaginatedContent.h"
+#import "HUBContentOperationWithConnectivityIndependentContent.h"
 #import "HUBContentOperationActionObserver.h"
 #import "HUBContentOperationActionPerformer.h"
 #import "HUBActionPerformer.h"
@@ -35,9 +36,16 @@
 #import "HUBContentOperationWrapper.h"
 #import "HUBContentOperationExecutionInfo.h"
 #import "HUBUtilities.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBPerformanceIntervalImplementation.h"
+#import "HUBContentOperationRecorderImplementation.h"
+#import "HUBContentOperationRecording.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// The time that the connectivity state has to stay unchanged for before content is reloaded for it
+static NSTimeInterval const HUBViewModelLoaderConnectivityStateChangeDebounceInterval = 0.5;
+
 @interface HUBViewModelLoaderImplementation () <HUBContentOperationWrapperDelegate, HUBConnectivityStateResolverObserver>
 
 @property (nonatomic, copy, readonly) NSURL *viewURI;
@@ -50,14 +58,21 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, strong, readonly) HUBComponentDefaults *componentDefaults;
 @property (nonatomic, strong, readonly) id<HUBConnectivityStateResolver> connectivityStateResolver;
 @property (nonatomic, assign) HUBConnectivityState connectivityState;
+@property (nonatomic, assign) NSUInteger connectivityStateChangeCount;
 @property (nonatomic, strong, nullable, readonly) id<HUBIconImageResolver> iconImageResolver;
 @property (nonatomic, strong, nullable) id<HUBViewModel> cachedInitialViewModel;
 @property (nonatomic, strong, nullable) id<HUBViewModel> previouslyLoadedViewModel;
+@property (nonatomic, assign) BOOL builderSnapshotsMatchPreviouslyLoadedViewModel;
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, HUBViewModelBuilderImplementation *> *builderSnapshots;
 @property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, NSError *> *errorSnapshots;
 @property (nonatomic, strong, nullable) HUBViewModelBuilderImplementation *currentBuilder;
 @property (nonatomic, assign) BOOL anyContentOperationSupportsPagination;
 @property (nonatomic, assign) NSUInteger pageIndex;
+@property (nonatomic, strong, readonly) HUBPerformanceTracker *performanceTracker;
+@property (nonatomic, strong, nullable) HUBPerformanceIntervalImplementation *contentOperationPerformanceInterval;
+@property (nonatomic, strong, readonly) NSMutableArray<HUBPerformanceIntervalImplementation *> *contentReloadPerformanceIntervals;
+@property (nonatomic, strong, nullable, readonly) HUBContentOperationRecorderImplementation *contentOperationRecorder;
+@property (nonatomic, assign) CFTimeInterval contentOperationStartTime;
 
 @end
 
@@ -76,6 +91,8 @@ NS_ASSUME_NONNULL_BEGIN
       connectivityStateResolver:(id<HUBConnectivityStateResolver>)connectivityStateResolver
               iconImageResolver:(nullable id<HUBIconImageResolver>)iconImageResolver
                initialViewModel:(nullable id<HUBViewModel>)initialViewModel
+             performanceTracker:(HUBPerformanceTracker *)performanceTracker
+       contentOperationRecorder:(nullable HUBContentOperationRecorderImplementation *)contentOperationRecorder
 {
     NSParameterAssert(viewURI != nil);
     NSParameterAssert(featureInfo != nil);
@@ -83,6 +100,7 @@ NS_ASSUME_NONNULL_BEGIN
     NSParameterAssert(JSONSchema != nil);
     NSParameterAssert(componentDefaults != nil);
     NSParameterAssert(connectivityStateResolver != nil);
+    NSParameterAssert(performanceTracker != nil);
     
     self = [super init];
     
@@ -101,6 +119,10 @@ NS_ASSUME_NONNULL_BEGIN
         _cachedInitialViewModel = initialViewModel;
         _builderSnapshots = [NSMutableDictionary new];
         _errorSnapshots = [NSMutableDictionary new];
+        _performanceTracker = performanceTracker;
+        _contentReloadPerformanceIntervals = [NSMutableArray new];
+        _contentOperationRecorder = contentOperationRecorder;
+        _connectivityStateChangeDebounceInterval = HUBViewModelLoaderConnectivityStateChangeDebounceInterval;
         
         [connectivityStateResolver addObserver:self];
     }
@@ -184,11 +206,17 @@ NS_ASSUME_NONNULL_BEGIN
         }
     }
     
-    [self scheduleContentOperationsFromIndex:0 executionMode:HUBContentOperationExecutionModeMain];
+    [self loadViewModelRegardlessOfReloadPolicy];
 }
 
 - (void)loadViewModelRegardlessOfReloadPolicy
 {
+    [self recordEventOfType:HUBContentOperationRecordedEventTypeLoad
+             operationIndex:0
+                  startTime:CACurrentMediaTime()
+           viewModelBuilder:nil
+                      error:nil];
+    
     [self scheduleContentOperationsFromIndex:0 executionMode:HUBContentOperationExecutionModeMain];
 }
 
@@ -202,6 +230,12 @@ NS_ASSUME_NONNULL_BEGIN
         return;
     }
     
+    [self recordEventOfType:HUBContentOperationRecordedEventTypeLoadNextPage
+             operationIndex:0
+                  startTime:CACurrentMediaTime()
+           viewModelBuilder:nil
+                      error:nil];
+    
     [self scheduleContentOperationsFromIndex:0 executionMode:HUBContentOperationExecutionModePagination];
 }
 
@@ -223,8 +257,27 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)contentOperationWrapperDidFinish:(HUBContentOperationWrapper *)operationWrapper withError:(nullable NSError *)error
 {
+    self.contentOperationPerformanceInterval.error = error;
+    [self.performanceTracker endInterval:self.contentOperationPerformanceInterval
+                               itemCount:self.currentBuilder.numberOfBodyComponentModelBuilders];
+    self.contentOperationPerformanceInterval = nil;
+    
+    // Operations that don't support pagination are skipped when loading the next page, so there's nothing to replay
+    HUBContentOperationExecutionInfo * const executionInfo = self.contentOperationQueue[0];
+    id<HUBContentOperation> const operation = self.contentOperations[operationWrapper.index];
+    
+    if (executionInfo.executionMode == HUBContentOperationExecutionModeMain ||
+        [operation conformsToProtocol:@protocol(HUBContentOperationWithPaginatedContent)]) {
+        [self recordEventOfType:HUBContentOperationRecordedEventTypeContentOperation
+                 operationIndex:operationWrapper.index
+                      startTime:self.contentOperationStartTime
+               viewModelBuilder:self.currentBuilder
+                          error:error];
+    }
+    
     [self.contentOperationQueue removeObjectAtIndex:0];
     self.builderSnapshots[@(operationWrapper.index)] = [self.currentBuilder copy];
+    self.builderSnapshotsMatchPreviouslyLoadedViewModel = NO;
     self.errorSnapshots[@(operationWrapper.index)] = error;
     [self performFirstContentOperationInQueue];
 }
@@ -232,6 +285,17 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)contentOperationWrapperRequiresRescheduling:(HUBContentOperationWrapper *)operationWrapper
 {
     HUBPerformOnMainQueue(^{
+        if (self.performanceTracker.enabled) {
+            NSString * const label = NSStringFromClass([self.contentOperations[operationWrapper.index] class]);
+            [self beginContentReloadPerformanceIntervalForEvent:HUBPerformanceEventContentOperationRescheduling label:label];
+        }
+        
+        [self recordEventOfType:HUBContentOperationRecordedEventTypeRescheduling
+                 operationIndex:operationWrapper.index
+                      startTime:CACurrentMediaTime()
+               viewModelBuilder:nil
+                          error:nil];
+        
         [self scheduleContentOperationsFromIndex:operationWrapper.index
                                    executionMode:HUBContentOperationExecutionModeMain];
     });
@@ -241,18 +305,84 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)connectivityStateResolverStateDidChange:(id<HUBConnectivityStateResolver>)resolver
 {
-    HUBConnectivityState previousConnectivityState = self.connectivityState;
+    HUBPerformOnMainQueue(^{
+        if (self.connectivityStateChangeDebounceInterval <= 0) {
+            [self connectivityStateDidSettle];
+            return;
+        }
+        
+        // Connectivity may flap rapidly, so only act on the state that it settles on
+        NSUInteger const changeCount = ++self.connectivityStateChangeCount;
+        __weak __typeof(self) weakSelf = self;
+        
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.connectivityStateChangeDebounceInterval * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            __typeof(self) strongSelf = weakSelf;
+            
+            if (strongSelf.connectivityStateChangeCount == changeCount) {
+                [strongSelf connectivityStateDidSettle];
+            }
+        });
+    });
+}
+
+#pragma mark - Private utilities
+
+- (void)connectivityStateDidSettle
+{
+    HUBConnectivityState const previousConnectivityState = self.connectivityState;
     self.connectivityState = [self.connectivityStateResolver resolveConnectivityState];
     
-    if (self.connectivityState != previousConnectivityState) {
+    if (self.connectivityState == previousConnectivityState) {
+        return;
+    }
+    
+    NSUInteger const startIndex = [self indexOfFirstContentOperationAffectedByConnectivity];
+    
+    if (startIndex == self.contentOperations.count) {
+        return;
+    }
+    
+    // Keep any previously loaded content on screen while it's being updated, rather than falling back to initial content
+    if (self.previouslyLoadedViewModel == nil) {
         [self.delegate viewModelLoader:self didLoadViewModel:self.initialViewModel];
-        
-        [self scheduleContentOperationsFromIndex:0
-                                   executionMode:HUBContentOperationExecutionModeMain];
     }
+    
+    if (self.performanceTracker.enabled) {
+        NSString * const label = (self.connectivityState == HUBConnectivityStateOnline) ? @"online" : @"offline";
+        [self beginContentReloadPerformanceIntervalForEvent:HUBPerformanceEventConnectivityStateChange label:label];
+    }
+    
+    [self recordEventOfType:HUBContentOperationRecordedEventTypeConnectivityStateChange
+             operationIndex:0
+                  startTime:CACurrentMediaTime()
+           viewModelBuilder:nil
+                      error:nil];
+    
+    [self scheduleContentOperationsFromIndex:startIndex
+                               executionMode:HUBContentOperationExecutionModeMain];
 }
 
-#pragma mark - Private utilities
+- (NSUInteger)indexOfFirstContentOperationAffectedByConnectivity
+{
+    NSUInteger operationIndex = 0;
+    
+    while (operationIndex < self.contentOperations.count) {
+        id<HUBContentOperation> const operation = self.contentOperations[operationIndex];
+        
+        if (![operation conformsToProtocol:@protocol(HUBContentOperationWithConnectivityIndependentContent)]) {
+            break;
+        }
+        
+        // Operations can only be resumed from a snapshot of the ones before them, so they need to have been executed
+        if (self.builderSnapshots[@(operationIndex)] == nil) {
+            break;
+        }
+        
+        operationIndex++;
+    }
+    
+    return operationIndex;
+}
 
 - (HUBViewModelBuilderImplementation *)builderForExecutionInfo:(HUBContentOperationExecutionInfo *)executionInfo
 {
@@ -261,7 +391,7 @@ NS_ASSUME_NONNULL_BEGIN
             case HUBContentOperationExecutionModeMain:
                 return [self createBuilder];
             case HUBContentOperationExecutionModePagination:
-                return [self snapshotOfBuilderAtIndex:self.contentOperations.count - 1];
+                return [self createPaginationBuilder];
         }
     }
     
@@ -275,6 +405,19 @@ NS_ASSUME_NONNULL_BEGIN
     return [snapshot copy];
 }
 
+- (HUBViewModelBuilderImplementation *)createPaginationBuilder
+{
+    HUBViewModelBuilderImplementation * const builder = [self snapshotOfBuilderAtIndex:self.contentOperations.count - 1];
+    id<HUBViewModel> const previouslyLoadedViewModel = self.previouslyLoadedViewModel;
+    
+    // Unless the content operations modify existing content, the new page can be appended to the current view model
+    if (previouslyLoadedViewModel != nil && self.builderSnapshotsMatchPreviouslyLoadedViewModel) {
+        [builder prepareForAppendingToViewModel:previouslyLoadedViewModel];
+    }
+    
+    return builder;
+}
+
 - (HUBViewModelBuilderImplementation *)createBuilder
 {
     return [[HUBViewModelBuilderImplementation alloc] initWithJSONSchema:self.JSONSchema
@@ -351,6 +494,16 @@ NS_ASSUME_NONNULL_BEGIN
     
     self.currentBuilder = builder;
     
+    if (self.performanceTracker.enabled) {
+        NSString * const label = NSStringFromClass([self.contentOperations[executionInfo.contentOperationIndex] class]);
+        self.contentOperationPerformanceInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventContentOperation
+                                                                                             label:label];
+    }
+    
+    if (self.contentOperationRecorder.recording) {
+        self.contentOperationStartTime = CACurrentMediaTime();
+    }
+    
     [operation performOperationForViewURI:self.viewURI
                               featureInfo:self.featureInfo
                         connectivityState:self.connectivityState
@@ -365,6 +518,7 @@ NS_ASSUME_NONNULL_BEGIN
     NSError * const error = self.errorSnapshots[@(self.contentOperations.count - 1)];
     
     if (error != nil) {
+        [self endContentReloadPerformanceIntervalsWithItemCount:0 error:error];
         [delegate viewModelLoader:self didFailLoadingWithError:error];
         return;
     }
@@ -373,11 +527,76 @@ NS_ASSUME_NONNULL_BEGIN
         self.currentBuilder.navigationBarTitle = self.featureInfo.title;
     }
     
+    HUBPerformanceIntervalImplementation * const buildInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventViewModelBuild
+                                                                                                          label:nil];
     id<HUBViewModel> const viewModel = [self.currentBuilder build];
+    [self.performanceTracker endInterval:buildInterval itemCount:viewModel.bodyComponentModels.count];
+    
     self.previouslyLoadedViewModel = viewModel;
+    self.builderSnapshotsMatchPreviouslyLoadedViewModel = YES;
+    [self endContentReloadPerformanceIntervalsWithItemCount:viewModel.bodyComponentModels.count error:nil];
     [delegate viewModelLoader:self didLoadViewModel:viewModel];
 }
 
+- (void)beginContentReloadPerformanceIntervalForEvent:(HUBPerformanceEvent)event label:(NSString *)label
+{
+    HUBPerformanceIntervalImplementation * const interval = [self.performanceTracker beginIntervalForEvent:event label:label];
+    
+    if (interval != nil) {
+        [self.contentReloadPerformanceIntervals addObject:interval];
+    }
+}
+
+- (void)endContentReloadPerformanceIntervalsWithItemCount:(NSUInteger)itemCount error:(nullable NSError *)error
+{
+    if (self.contentReloadPerformanceIntervals.count == 0) {
+        return;
+    }
+    
+    NSArray<HUBPerformanceIntervalImplementation *> * const intervals = [self.contentReloadPerformanceIntervals copy];
+    [self.contentReloadPerformanceIntervals removeAllObjects];
+    
+    for (HUBPerformanceIntervalImplementation * const interval in intervals) {
+        interval.error = error;
+        [self.performanceTracker endInterval:interval itemCount:itemCount];
+    }
+}
+
+- (void)recordEventOfType:(HUBContentOperationRecordedEventType)type
+           operationIndex:(NSUInteger)operationIndex
+                startTime:(CFTimeInterval)startTime
+         viewModelBuilder:(nullable HUBViewModelBuilderImplementation *)viewModelBuilder
+                    error:(nullable NSError *)error
+{
+    HUBContentOperationRecording * const recording = [self.contentOperationRecorder recordingForViewModelLoader:self
+                                                                                                        viewURI:self.viewURI
+                                                                                                    featureInfo:self.featureInfo
+                                                                                              contentOperations:self.contentOperations
+                                                                                              connectivityState:self.connectivityState];
+    
+    if (recording == nil) {
+        return;
+    }
+    
+    CFTimeInterval const endTime = CACurrentMediaTime();
+    
+    // Recording may have started while an operation was being performed, in which case its start time is unknown
+    CFTimeInterval const eventStartTime = (startTime >= recording.referenceTime) ? startTime : endTime;
+    
+    // Serializing a built copy captures the builder's content without affecting how it's built later
+    NSDictionary<NSString *, id> * const content = [[[viewModelBuilder copy] build] serialize];
+    
+    HUBContentOperationRecordedEvent * const event = [[HUBContentOperationRecordedEvent alloc] initWithType:type
+                                                                                                       time:eventStartTime - recording.referenceTime
+                                                                                                   duration:endTime - eventStartTime
+                                                                                             operationIndex:operationIndex
+                                                                                          connectivityState:self.connectivityState
+                                                                                                    content:content
+                                                                                                      error:error];
+    
+    [recording addEvent:event];
+}
+
 - (HUBContentOperationWrapper *)getOrCreateWrapperForContentOperationAtIndex:(NSUInteger)operationIndex
 {
     HUBContentOperationWrapper * const existingOperationWrapper = self.contentOperationWrappers[@(operationIndex)];
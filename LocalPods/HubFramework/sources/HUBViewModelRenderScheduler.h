@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+@protocol HUBViewModel;
+@class HUBViewModelRenderScheduler;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Delegate protocol used by `HUBViewModelRenderScheduler` to perform rendering
+@protocol HUBViewModelRenderSchedulerDelegate <NSObject>
+
+/**
+ *  Sent to the delegate when a view model should be rendered
+ *
+ *  @param renderScheduler The scheduler that is requesting the render
+ *  @param viewModel The view model to render. This is always the newest view model that has been scheduled.
+ *
+ *  The delegate must call `-renderingDidFinish` on the scheduler once it has finished rendering the view model.
+ */
+- (void)viewModelRenderScheduler:(HUBViewModelRenderScheduler *)renderScheduler renderViewModel:(id<HUBViewModel>)viewModel;
+
+@end
+
+/**
+ *  Scheduler that coalesces view model updates into at most one render per display frame
+ *
+ *  A view model that is scheduled while the scheduler is idle is rendered right away. Any view model
+ *  that is scheduled while a render is in progress, or during the same frame as the previous render,
+ *  is held until the next display frame. If several view models are scheduled in that time, only the
+ *  newest one is rendered, and the others are counted as dropped.
+ */
+@interface HUBViewModelRenderScheduler : NSObject
+
+/// The scheduler's delegate, which performs the actual rendering
+@property (nonatomic, weak, nullable) id<HUBViewModelRenderSchedulerDelegate> delegate;
+
+/// The newest view model that has been scheduled, but not yet rendered
+@property (nonatomic, strong, readonly, nullable) id<HUBViewModel> pendingViewModel;
+
+/// Whether the delegate is currently rendering a view model
+@property (nonatomic, assign, readonly, getter=isRendering) BOOL rendering;
+
+/// The number of view models that were replaced by a newer one before they could be rendered
+@property (nonatomic, assign, readonly) NSUInteger droppedViewModelCount;
+
+/**
+ *  Schedule a view model to be rendered
+ *
+ *  @param viewModel The view model to render. Replaces any view model that is still pending.
+ */
+- (void)scheduleRenderingOfViewModel:(id<HUBViewModel>)viewModel;
+
+/// Notify the scheduler that the delegate has finished rendering the last view model that it was sent
+- (void)renderingDidFinish;
+
+@end
+
+NS_ASSUME_NONNULL_END
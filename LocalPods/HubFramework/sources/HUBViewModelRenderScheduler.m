@@ -0,0 +1,138 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBViewModelRenderScheduler.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+#import "HUBViewModel.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - HUBViewModelRenderSchedulerDisplayLinkTarget
+
+/// Object used as the target of the render scheduler's display link, to avoid it retaining the scheduler
+@interface HUBViewModelRenderSchedulerDisplayLinkTarget : NSObject
+
+@property (nonatomic, weak, nullable) HUBViewModelRenderScheduler *scheduler;
+
+- (void)handleDisplayLink:(CADisplayLink *)displayLink;
+
+@end
+
+#pragma mark - HUBViewModelRenderScheduler
+
+@interface HUBViewModelRenderScheduler ()
+
+@property (nonatomic, strong, readwrite, nullable) id<HUBViewModel> pendingViewModel;
+@property (nonatomic, assign, readwrite, getter=isRendering) BOOL rendering;
+@property (nonatomic, assign, readwrite) NSUInteger droppedViewModelCount;
+@property (nonatomic, strong, nullable) CADisplayLink *displayLink;
+@property (nonatomic, assign) BOOL hasRenderedInCurrentFrame;
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink;
+
+@end
+
+@implementation HUBViewModelRenderScheduler
+
+- (void)dealloc
+{
+    [_displayLink invalidate];
+}
+
+#pragma mark - API
+
+- (void)scheduleRenderingOfViewModel:(id<HUBViewModel>)viewModel
+{
+    if (self.pendingViewModel != nil) {
+        self.droppedViewModelCount++;
+    }
+    
+    self.pendingViewModel = viewModel;
+    [self renderPendingViewModelIfPossible];
+}
+
+- (void)renderingDidFinish
+{
+    self.rendering = NO;
+    [self renderPendingViewModelIfPossible];
+}
+
+#pragma mark - Private utilities
+
+- (void)renderPendingViewModelIfPossible
+{
+    id<HUBViewModel> const viewModel = self.pendingViewModel;
+    
+    if (viewModel == nil || self.isRendering) {
+        return;
+    }
+    
+    // Wait for the next frame, by which time a newer view model might have been scheduled
+    if (self.hasRenderedInCurrentFrame) {
+        [self startDisplayLink];
+        return;
+    }
+    
+    self.pendingViewModel = nil;
+    self.rendering = YES;
+    self.hasRenderedInCurrentFrame = YES;
+    [self startDisplayLink];
+    
+    [self.delegate viewModelRenderScheduler:self renderViewModel:viewModel];
+}
+
+- (void)startDisplayLink
+{
+    if (self.displayLink == nil) {
+        HUBViewModelRenderSchedulerDisplayLinkTarget * const target = [HUBViewModelRenderSchedulerDisplayLinkTarget new];
+        target.scheduler = self;
+        
+        CADisplayLink * const displayLink = [CADisplayLink displayLinkWithTarget:target selector:@selector(handleDisplayLink:)];
+        [displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+        self.displayLink = displayLink;
+    }
+    
+    self.displayLink.paused = NO;
+}
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink
+{
+    displayLink.paused = YES;
+    self.hasRenderedInCurrentFrame = NO;
+    [self renderPendingViewModelIfPossible];
+}
+
+@end
+
+#pragma mark - HUBViewModelRenderSchedulerDisplayLinkTarget
+
+@implementation HUBViewModelRenderSchedulerDisplayLinkTarget
+
+- (void)handleDisplayLink:(CADisplayLink *)displayLink
+{
+    [self.scheduler displayLinkDidFire:displayLink];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
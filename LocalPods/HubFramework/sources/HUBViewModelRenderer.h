@@ -23,6 +23,8 @@
 #import "HUBViewModel.h"
 #import "HUBHeaderMacros.h"
 
+@class HUBPerformanceTracker;
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -30,6 +32,13 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @interface HUBViewModelRenderer : NSObject
 
+/**
+ *  Initialize an instance of this class
+ *
+ *  @param performanceTracker The tracker to use to measure diffing and layout when rendering
+ */
+- (instancetype)initWithPerformanceTracker:(HUBPerformanceTracker *)performanceTracker HUB_DESIGNATED_INITIALIZER;
+
 /**
  *  Renders the provided view model in the collection view.
  * 
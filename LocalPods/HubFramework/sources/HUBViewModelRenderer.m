@@ -22,17 +22,33 @@
 #import "HUBViewModelRenderer.h"
 #import "HUBViewModelDiff.h"
 #import "HUBCollectionViewLayout.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBPerformanceIntervalImplementation.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
 @interface HUBViewModelRenderer ()
 
+@property (nonatomic, strong, readonly) HUBPerformanceTracker *performanceTracker;
 @property (nonatomic, strong, nullable) id<HUBViewModel> lastRenderedViewModel;
 
 @end
 
 @implementation HUBViewModelRenderer
 
+- (instancetype)initWithPerformanceTracker:(HUBPerformanceTracker *)performanceTracker
+{
+    NSParameterAssert(performanceTracker != nil);
+    
+    self = [super init];
+    
+    if (self) {
+        _performanceTracker = performanceTracker;
+    }
+    
+    return self;
+}
+
 - (void)renderViewModel:(id<HUBViewModel>)viewModel
        inCollectionView:(UICollectionView *)collectionView
       usingBatchUpdates:(BOOL)usingBatchUpdates
@@ -43,7 +59,15 @@ NS_ASSUME_NONNULL_BEGIN
     HUBViewModelDiff *diff;
     if (self.lastRenderedViewModel != nil) {
         id<HUBViewModel> nonnullViewModel = self.lastRenderedViewModel;
-        diff = [HUBViewModelDiff diffFromViewModel:nonnullViewModel toViewModel:viewModel];
+        HUBPerformanceIntervalImplementation * const diffInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventViewModelDiff
+                                                                                                             label:nil];
+        diff = [HUBViewModelDiff appendingDiffFromViewModel:nonnullViewModel toViewModel:viewModel];
+        
+        if (diff == nil) {
+            diff = [HUBViewModelDiff diffFromViewModel:nonnullViewModel toViewModel:viewModel];
+        }
+        
+        [self.performanceTracker endInterval:diffInterval itemCount:[self changeCountForDiff:diff]];
     }
 
     HUBCollectionViewLayout * const layout = (HUBCollectionViewLayout *)collectionView.collectionViewLayout;
@@ -51,10 +75,11 @@ NS_ASSUME_NONNULL_BEGIN
     if (!usingBatchUpdates || diff == nil) {
         [collectionView reloadData];
         
-        [layout computeForCollectionViewSize:collectionView.frame.size
-                                   viewModel:viewModel
-                                        diff:diff
-                             addHeaderMargin:addHeaderMargin];
+        [self computeLayout:layout
+          forCollectionView:collectionView
+                  viewModel:viewModel
+                       diff:diff
+            addHeaderMargin:addHeaderMargin];
 
         /* Below is a workaround for an issue caused by UICollectionView not asking for numberOfItemsInSection
            before viewDidAppear is called or instantly after a call to reloadData. If reloadData is called
@@ -77,10 +102,11 @@ NS_ASSUME_NONNULL_BEGIN
                 [collectionView deleteItemsAtIndexPaths:diff.deletedBodyComponentIndexPaths];
                 [collectionView reloadItemsAtIndexPaths:diff.reloadedBodyComponentIndexPaths];
                 
-                [layout computeForCollectionViewSize:collectionView.frame.size
-                                           viewModel:viewModel
-                                                diff:diff
-                                     addHeaderMargin:addHeaderMargin];
+                [self computeLayout:layout
+                  forCollectionView:collectionView
+                          viewModel:viewModel
+                               diff:diff
+                    addHeaderMargin:addHeaderMargin];
                 
             } completion:^(BOOL finished) {
                 self.lastRenderedViewModel = viewModel;
@@ -96,6 +122,32 @@ NS_ASSUME_NONNULL_BEGIN
     }
 }
 
+#pragma mark - Private utilities
+
+- (void)computeLayout:(HUBCollectionViewLayout *)layout
+    forCollectionView:(UICollectionView *)collectionView
+            viewModel:(id<HUBViewModel>)viewModel
+                 diff:(nullable HUBViewModelDiff *)diff
+      addHeaderMargin:(BOOL)addHeaderMargin
+{
+    HUBPerformanceIntervalImplementation * const layoutInterval = [self.performanceTracker beginIntervalForEvent:HUBPerformanceEventLayout
+                                                                                                           label:nil];
+    
+    [layout computeForCollectionViewSize:collectionView.frame.size
+                               viewModel:viewModel
+                                    diff:diff
+                         addHeaderMargin:addHeaderMargin];
+    
+    [self.performanceTracker endInterval:layoutInterval itemCount:viewModel.bodyComponentModels.count];
+}
+
+- (NSUInteger)changeCountForDiff:(HUBViewModelDiff *)diff
+{
+    return diff.insertedBodyComponentIndexPaths.count
+         + diff.deletedBodyComponentIndexPaths.count
+         + diff.reloadedBodyComponentIndexPaths.count;
+}
+
 @end
 
 NS_ASSUME_NONNULL_END
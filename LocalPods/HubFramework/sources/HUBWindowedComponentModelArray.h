@@ -0,0 +1,93 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBHeaderMacros.h"
+
+@protocol HUBComponentModel;
+@class HUBComponentModelBuilderImplementation;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Array of root component models that are built on demand, keeping only a sliding window of them in memory
+ *
+ *  Used for view models with very long lists of body components, to avoid building and retaining thousands of
+ *  component models up front. Each component model is built when it is first accessed, and is kept for as long as it
+ *  stays within a window of the most recently accessed index. Models that fall out of the window are dropped, and
+ *  rebuilt from their builder if they are accessed again, so repeated accesses to the same index are only guaranteed
+ *  to return equal (rather than identical) instances.
+ *
+ *  This array may be accessed from any thread, since access to its built component models is synchronized.
+ */
+@interface HUBWindowedComponentModelArray : NSArray<id<HUBComponentModel>>
+
+/// The identifiers of the component models in the array, available without building any of the models
+@property (nonatomic, copy, readonly) NSArray<NSString *> *componentModelIdentifiers;
+
+/// The range of indexes that component models are currently kept in memory for. Starts at the beginning of the array.
+@property (nonatomic, assign, readonly) NSRange windowRange;
+
+/**
+ *  Initialize an instance of this class with a sorted array of builders
+ *
+ *  @param builders The builders to use to build the component models. The builder at each position builds the model
+ *         for that index. The builders must not be mutated after being passed to this array.
+ *  @param windowSize The maximum number of built component models to keep in memory at any time
+ */
+- (instancetype)initWithBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders
+                      windowSize:(NSUInteger)windowSize HUB_DESIGNATED_INITIALIZER;
+
+/**
+ *  Return a new array by appending component models built by an additional set of builders
+ *
+ *  @param builders The builders to append, in the order of the component models that they should build
+ *
+ *  The returned array shares the builders of this array, which makes it possible to check whether it was appended to
+ *  this array without building any component models. See `-hasPrefixArray:`.
+ */
+- (HUBWindowedComponentModelArray *)arrayByAppendingBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders;
+
+/**
+ *  Return whether the component models of another array make up the start of this array
+ *
+ *  @param array The array to check for
+ *
+ *  This is determined by comparing the builders of both arrays and their content revisions, without building any
+ *  component models.
+ */
+- (BOOL)hasPrefixArray:(HUBWindowedComponentModelArray *)array;
+
+/**
+ *  Return whether a component model of this array is equal to one of another array
+ *
+ *  @param index The index of the component model in this array
+ *  @param otherIndex The index of the component model in the other array
+ *  @param array The other array
+ *
+ *  This is determined by comparing the content revisions that the builders of both models had when each array was
+ *  created, without building the models. Just like with `-isEqual:`, the index of the component models is not taken
+ *  into account.
+ */
+- (BOOL)componentModelAtIndex:(NSUInteger)index isEqualToComponentModelAtIndex:(NSUInteger)otherIndex inArray:(HUBWindowedComponentModelArray *)array;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,202 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBWindowedComponentModelArray.h"
+
+#import "HUBComponentModel.h"
+#import "HUBComponentModelBuilderImplementation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface HUBWindowedComponentModelArray ()
+
+@property (nonatomic, copy, readonly) NSArray<HUBComponentModelBuilderImplementation *> *builders;
+@property (nonatomic, copy, readonly) NSData *contentRevisionsData;
+@property (nonatomic, assign, readonly) NSUInteger windowSize;
+@property (nonatomic, strong, readonly) NSMutableDictionary<NSNumber *, id<HUBComponentModel>> *componentModelsByIndex;
+@property (nonatomic, strong, readonly) NSLock *componentModelsLock;
+@property (nonatomic, assign, readwrite) NSRange windowRange;
+
+@end
+
+static NSData *HUBWindowedComponentModelArrayContentRevisions(NSArray<HUBComponentModelBuilderImplementation *> *builders)
+{
+    NSMutableData * const data = [NSMutableData dataWithLength:builders.count * sizeof(uint64_t)];
+    uint64_t * const revisions = data.mutableBytes;
+    
+    [builders enumerateObjectsUsingBlock:^(HUBComponentModelBuilderImplementation *builder, NSUInteger index, BOOL *stop) {
+        revisions[index] = builder.contentRevision;
+    }];
+    
+    return [data copy];
+}
+
+@implementation HUBWindowedComponentModelArray
+
+- (instancetype)initWithBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders
+                      windowSize:(NSUInteger)windowSize
+{
+    NSParameterAssert(builders != nil);
+    NSParameterAssert(windowSize > 0);
+    
+    self = [super init];
+    
+    if (self) {
+        _builders = [builders copy];
+        _contentRevisionsData = HUBWindowedComponentModelArrayContentRevisions(_builders);
+        _windowSize = windowSize;
+        _componentModelsByIndex = [NSMutableDictionary new];
+        _componentModelsLock = [NSLock new];
+        _windowRange = NSMakeRange(0, MIN(windowSize, _builders.count));
+    }
+    
+    return self;
+}
+
+#pragma mark - API
+
+- (NSArray<NSString *> *)componentModelIdentifiers
+{
+    NSMutableArray<NSString *> * const identifiers = [NSMutableArray arrayWithCapacity:self.builders.count];
+    
+    for (HUBComponentModelBuilderImplementation * const builder in self.builders) {
+        [identifiers addObject:builder.modelIdentifier];
+    }
+    
+    return [identifiers copy];
+}
+
+- (NSRange)windowRange
+{
+    [self.componentModelsLock lock];
+    NSRange const windowRange = _windowRange;
+    [self.componentModelsLock unlock];
+    return windowRange;
+}
+
+- (HUBWindowedComponentModelArray *)arrayByAppendingBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders
+{
+    NSArray<HUBComponentModelBuilderImplementation *> * const allBuilders = [self.builders arrayByAddingObjectsFromArray:builders];
+    return [[HUBWindowedComponentModelArray alloc] initWithBuilders:allBuilders windowSize:self.windowSize];
+}
+
+- (BOOL)hasPrefixArray:(HUBWindowedComponentModelArray *)array
+{
+    NSArray<HUBComponentModelBuilderImplementation *> * const prefixBuilders = array.builders;
+    NSUInteger const prefixCount = prefixBuilders.count;
+    
+    if (prefixCount > self.builders.count) {
+        return NO;
+    }
+    
+    uint64_t const * const prefixRevisions = array.contentRevisionsData.bytes;
+    uint64_t const * const revisions = self.contentRevisionsData.bytes;
+    
+    for (NSUInteger index = 0; index < prefixCount; index++) {
+        if (prefixBuilders[index] != self.builders[index] || prefixRevisions[index] != revisions[index]) {
+            return NO;
+        }
+    }
+    
+    return YES;
+}
+
+- (BOOL)componentModelAtIndex:(NSUInteger)index isEqualToComponentModelAtIndex:(NSUInteger)otherIndex inArray:(HUBWindowedComponentModelArray *)array
+{
+    // The revisions are the ones that the builders had when each array was created, since a builder may have been
+    // changed since then through a reference that was held on to
+    uint64_t const revision = ((uint64_t const *)self.contentRevisionsData.bytes)[index];
+    uint64_t const otherRevision = ((uint64_t const *)array.contentRevisionsData.bytes)[otherIndex];
+    return revision == otherRevision;
+}
+
+#pragma mark - NSArray
+
+- (NSUInteger)count
+{
+    return self.builders.count;
+}
+
+- (id<HUBComponentModel>)objectAtIndex:(NSUInteger)index
+{
+    if (index >= self.builders.count) {
+        [NSException raise:NSRangeException
+                    format:@"Index %lu beyond bounds of windowed component model array with count %lu",
+                           (unsigned long)index,
+                           (unsigned long)self.builders.count];
+    }
+    
+    NSNumber * const encodedIndex = @(index);
+    
+    [self.componentModelsLock lock];
+    
+    id<HUBComponentModel> componentModel = self.componentModelsByIndex[encodedIndex];
+    
+    if (componentModel == nil) {
+        [self slideWindowToIndex:index];
+        
+        componentModel = [self.builders[index] buildForIndex:index parent:nil];
+        self.componentModelsByIndex[encodedIndex] = componentModel;
+    }
+    
+    [self.componentModelsLock unlock];
+    
+    return componentModel;
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(nullable NSZone *)zone
+{
+    // Immutable, and copying through NSArray would build every single component model
+    return self;
+}
+
+#pragma mark - Private utilities
+
+- (void)slideWindowToIndex:(NSUInteger)index
+{
+    // Must be called with the component models lock held
+    if (NSLocationInRange(index, _windowRange)) {
+        return;
+    }
+    
+    NSUInteger const count = self.builders.count;
+    NSUInteger const windowSize = MIN(self.windowSize, count);
+    NSUInteger const halfWindowSize = windowSize / 2;
+    NSUInteger windowStart = (index > halfWindowSize) ? index - halfWindowSize : 0;
+    windowStart = MIN(windowStart, count - windowSize);
+    _windowRange = NSMakeRange(windowStart, windowSize);
+    
+    NSMutableArray<NSNumber *> * const indexesToDrop = [NSMutableArray new];
+    
+    for (NSNumber * const encodedIndex in self.componentModelsByIndex) {
+        if (!NSLocationInRange(encodedIndex.unsignedIntegerValue, _windowRange)) {
+            [indexesToDrop addObject:encodedIndex];
+        }
+    }
+    
+    [self.componentModelsByIndex removeObjectsForKeys:indexesToDrop];
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,195 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModelBuilderImplementation.h"
+#import "HUBJSONSchemaImplementation.h"
+
+@interface HUBComponentModelBuilderSortingTests : XCTestCase
+
+@property (nonatomic, strong) HUBComponentDefaults *componentDefaults;
+@property (nonatomic, strong) id<HUBJSONSchema> JSONSchema;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, HUBComponentModelBuilderImplementation *> *builders;
+@property (nonatomic, strong) NSMutableArray<NSString *> *identifierOrder;
+
+@end
+
+@implementation HUBComponentModelBuilderSortingTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    self.componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"sorting"
+                                                                         componentName:@"row"
+                                                                     componentCategory:HUBComponentCategoryRow];
+    
+    self.JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:self.componentDefaults
+                                                                    iconImageResolver:nil];
+    
+    self.builders = [NSMutableDictionary new];
+    self.identifierOrder = [NSMutableArray new];
+}
+
+#pragma mark - Tests
+
+- (void)testBuildersWithoutPreferredIndexesKeepTheirOrder
+{
+    [self addBuilderCount:5];
+    [self assertSortedIdentifiers:@[@"0", @"1", @"2", @"3", @"4"]];
+}
+
+- (void)testPreferredIndexesWithinBounds
+{
+    [self addBuilderCount:5];
+    self.builders[@"4"].preferredIndex = @0;
+    self.builders[@"0"].preferredIndex = @2;
+    
+    [self assertSortedIdentifiers:@[@"4", @"1", @"0", @"2", @"3"]];
+}
+
+- (void)testOutOfRangePreferredIndexesAreAppended
+{
+    [self addBuilderCount:5];
+    self.builders[@"1"].preferredIndex = @100;
+    self.builders[@"0"].preferredIndex = @5;
+    self.builders[@"3"].preferredIndex = @4;
+    
+    [self assertSortedIdentifiers:@[@"2", @"4", @"3", @"0", @"1"]];
+}
+
+- (void)testDuplicatePreferredIndexesOnlyPinTheLastBuilder
+{
+    [self addBuilderCount:5];
+    self.builders[@"3"].preferredIndex = @1;
+    self.builders[@"4"].preferredIndex = @1;
+    
+    [self assertSortedIdentifiers:@[@"0", @"4", @"1", @"2", @"3"]];
+}
+
+- (void)testMatchesSequentialRemoveAndInsertForRandomInputs
+{
+    uint32_t randomState = 7;
+    
+    for (NSUInteger run = 0; run < 500; run++) {
+        [self.builders removeAllObjects];
+        [self.identifierOrder removeAllObjects];
+        
+        randomState = randomState * 1664525u + 1013904223u;
+        NSUInteger const builderCount = 1 + randomState % 40;
+        [self addBuilderCount:builderCount];
+        
+        for (NSString * const identifier in self.identifierOrder) {
+            randomState = randomState * 1664525u + 1013904223u;
+            
+            // Roughly a third of the builders are pinned, to indexes that are out of range or shared every now and then
+            if (randomState % 3 == 0) {
+                randomState = randomState * 1664525u + 1013904223u;
+                self.builders[identifier].preferredIndex = @(randomState % (builderCount + 5));
+            }
+        }
+        
+        NSArray<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [HUBComponentModelBuilderImplementation sortedBuildersFromBuilders:self.builders
+                                                                                                                                       identifierOrder:self.identifierOrder];
+        
+        XCTAssertEqualObjects([self identifiersOfBuilders:sortedBuilders], [self identifiersSortedByRemovingAndInserting]);
+    }
+}
+
+#pragma mark - Utilities
+
+- (void)addBuilderCount:(NSUInteger)count
+{
+    for (NSUInteger index = 0; index < count; index++) {
+        NSString * const identifier = [NSString stringWithFormat:@"%lu", (unsigned long)index];
+        
+        self.builders[identifier] = [[HUBComponentModelBuilderImplementation alloc] initWithModelIdentifier:identifier
+                                                                                                       type:HUBComponentTypeBody
+                                                                                                 JSONSchema:self.JSONSchema
+                                                                                          componentDefaults:self.componentDefaults
+                                                                                          iconImageResolver:nil
+                                                                                       mainImageDataBuilder:nil
+                                                                                 backgroundImageDataBuilder:nil];
+        
+        [self.identifierOrder addObject:identifier];
+    }
+}
+
+- (void)assertSortedIdentifiers:(NSArray<NSString *> *)expectedIdentifiers
+{
+    NSArray<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [HUBComponentModelBuilderImplementation sortedBuildersFromBuilders:self.builders
+                                                                                                                                   identifierOrder:self.identifierOrder];
+    
+    XCTAssertEqualObjects([self identifiersOfBuilders:sortedBuilders], expectedIdentifiers);
+    XCTAssertEqualObjects([self identifiersSortedByRemovingAndInserting], expectedIdentifiers);
+}
+
+- (NSArray<NSString *> *)identifiersOfBuilders:(NSArray<HUBComponentModelBuilderImplementation *> *)builders
+{
+    NSMutableArray<NSString *> * const identifiers = [NSMutableArray new];
+    
+    for (HUBComponentModelBuilderImplementation * const builder in builders) {
+        [identifiers addObject:builder.modelIdentifier];
+    }
+    
+    return identifiers;
+}
+
+/// The order that preferred indexes were resolved into before they were resolved in a single pass
+- (NSArray<NSString *> *)identifiersSortedByRemovingAndInserting
+{
+    NSMutableOrderedSet<HUBComponentModelBuilderImplementation *> * const sortedBuilders = [NSMutableOrderedSet new];
+    NSMutableDictionary<NSNumber *, HUBComponentModelBuilderImplementation *> * const buildersByPreferredIndex = [NSMutableDictionary new];
+    
+    for (NSString * const identifier in self.identifierOrder) {
+        HUBComponentModelBuilderImplementation * const builder = self.builders[identifier];
+        NSNumber * const preferredIndex = builder.preferredIndex;
+        
+        if (preferredIndex != nil) {
+            buildersByPreferredIndex[preferredIndex] = builder;
+        }
+        
+        [sortedBuilders addObject:builder];
+    }
+    
+    NSArray<NSNumber *> * const sortedPreferredIndexes = [buildersByPreferredIndex.allKeys sortedArrayUsingSelector:@selector(compare:)];
+    
+    for (NSNumber * const preferredIndex in sortedPreferredIndexes) {
+        HUBComponentModelBuilderImplementation * const builder = buildersByPreferredIndex[preferredIndex];
+        NSUInteger const decodedPreferredIndex = preferredIndex.unsignedIntegerValue;
+        
+        [sortedBuilders removeObject:builder];
+        
+        if (decodedPreferredIndex >= sortedBuilders.count) {
+            [sortedBuilders addObject:builder];
+        } else {
+            [sortedBuilders insertObject:builder atIndex:decodedPreferredIndex];
+        }
+    }
+    
+    return [self identifiersOfBuilders:sortedBuilders.array];
+}
+
+@end
@@ -0,0 +1,152 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModel.h"
+#import "HUBComponentModelBuilderImplementation.h"
+#import "HUBJSONSchemaImplementation.h"
+
+@interface HUBComponentModelChildrenTests : XCTestCase
+
+@property (nonatomic, strong) HUBComponentModelBuilderImplementation *builder;
+
+@end
+
+@implementation HUBComponentModelChildrenTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    HUBComponentDefaults * const componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"children"
+                                                                                                componentName:@"row"
+                                                                                            componentCategory:HUBComponentCategoryRow];
+    
+    id<HUBJSONSchema> const JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:componentDefaults
+                                                                                       iconImageResolver:nil];
+    
+    self.builder = [[HUBComponentModelBuilderImplementation alloc] initWithModelIdentifier:@"parent"
+                                                                                       type:HUBComponentTypeBody
+                                                                                 JSONSchema:JSONSchema
+                                                                          componentDefaults:componentDefaults
+                                                                          iconImageResolver:nil
+                                                                       mainImageDataBuilder:nil
+                                                                 backgroundImageDataBuilder:nil];
+    
+    [self.builder builderForChildWithIdentifier:@"childA"].title = @"A";
+    [self.builder builderForChildWithIdentifier:@"childB"].title = @"B";
+}
+
+#pragma mark - Tests
+
+- (void)testModelsBuiltFromUnmodifiedBuilderAreEqual
+{
+    id<HUBComponentModel> const modelA = [self.builder buildForIndex:0 parent:nil];
+    id<HUBComponentModel> const modelB = [[self.builder copy] buildForIndex:0 parent:nil];
+    
+    XCTAssertEqualObjects(modelA, modelB);
+}
+
+- (void)testModifiedChildIsOnlyReflectedInModelsBuiltAfterwards
+{
+    id<HUBComponentModel> const previousModel = [self.builder buildForIndex:0 parent:nil];
+    [self.builder builderForChildWithIdentifier:@"childB"].title = @"Modified";
+    id<HUBComponentModel> const model = [self.builder buildForIndex:0 parent:nil];
+    
+    XCTAssertNotEqualObjects(previousModel, model);
+    XCTAssertEqualObjects([previousModel childWithIdentifier:@"childB"].title, @"B");
+    XCTAssertEqualObjects([model childWithIdentifier:@"childB"].title, @"Modified");
+}
+
+- (void)testHeldChildBuilderModifiedAfterBuildIsReflectedInNextBuild
+{
+    id<HUBComponentModelBuilder> const childBuilder = [self.builder builderForChildWithIdentifier:@"childA"];
+    id<HUBComponentModel> const previousModel = [self.builder buildForIndex:0 parent:nil];
+    
+    childBuilder.title = @"Modified";
+    id<HUBComponentModel> const model = [self.builder buildForIndex:0 parent:nil];
+    
+    XCTAssertNotEqualObjects(previousModel, model);
+    XCTAssertEqualObjects([previousModel childWithIdentifier:@"childA"].title, @"A");
+    XCTAssertEqualObjects([model childWithIdentifier:@"childA"].title, @"Modified");
+}
+
+- (void)testHeldGrandchildBuilderModifiedAfterBuildIsReflectedInNextBuild
+{
+    id<HUBComponentModelBuilder> const grandchildBuilder = [[self.builder builderForChildWithIdentifier:@"childA"] builderForChildWithIdentifier:@"grandchild"];
+    grandchildBuilder.title = @"Grandchild";
+    id<HUBComponentModel> const previousModel = [self.builder buildForIndex:0 parent:nil];
+    
+    grandchildBuilder.mainImageDataBuilder.URL = [NSURL URLWithString:@"https://spotify.com/image.png"];
+    id<HUBComponentModel> const model = [self.builder buildForIndex:0 parent:nil];
+    
+    XCTAssertNotEqualObjects(previousModel, model);
+    XCTAssertNil([[previousModel childWithIdentifier:@"childA"] childWithIdentifier:@"grandchild"].mainImageData);
+    XCTAssertEqualObjects([[model childWithIdentifier:@"childA"] childWithIdentifier:@"grandchild"].mainImageData.URL,
+                          [NSURL URLWithString:@"https://spotify.com/image.png"]);
+}
+
+- (void)testCopyDoesNotShareSnapshotAfterHeldChildBuilderIsModified
+{
+    id<HUBComponentModelBuilder> const childBuilder = [self.builder builderForChildWithIdentifier:@"childB"];
+    HUBComponentModelBuilderImplementation * const builderCopy = [self.builder copy];
+    [self.builder buildForIndex:0 parent:nil];
+    
+    childBuilder.title = @"Modified";
+    
+    XCTAssertNotEqualObjects([self.builder buildForIndex:0 parent:nil], [builderCopy buildForIndex:0 parent:nil]);
+}
+
+- (void)testEqualChildrenFromDifferentSnapshotsAreEqual
+{
+    id<HUBComponentModel> const previousModel = [self.builder buildForIndex:0 parent:nil];
+    [self.builder builderForChildWithIdentifier:@"childA"].title = @"A";
+    id<HUBComponentModel> const model = [self.builder buildForIndex:0 parent:nil];
+    
+    XCTAssertEqualObjects(previousModel, model);
+}
+
+- (void)testChildrenAreOnlyBuiltOnceWhenAccessedConcurrently
+{
+    id<HUBComponentModel> const model = [self.builder buildForIndex:0 parent:nil];
+    NSUInteger const accessCount = 16;
+    NSMutableArray<NSArray<id<HUBComponentModel>> *> * const childArrays = [NSMutableArray new];
+    
+    dispatch_apply(accessCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        NSArray<id<HUBComponentModel>> * const children = model.children;
+        
+        @synchronized (childArrays) {
+            [childArrays addObject:children];
+        }
+    });
+    
+    XCTAssertEqual(childArrays.count, accessCount);
+    
+    for (NSArray<id<HUBComponentModel>> * const children in childArrays) {
+        XCTAssertEqual(children, childArrays.firstObject);
+    }
+}
+
+@end
@@ -0,0 +1,128 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModel.h"
+#import "HUBComponentModelBuilderImplementation.h"
+#import "HUBComponentUIStateCacheImplementation.h"
+#import "HUBComponentUIStateManager.h"
+#import "HUBJSONSchemaImplementation.h"
+
+@interface HUBComponentUIStateManagerTests : XCTestCase
+
+@property (nonatomic, strong) HUBComponentUIStateCacheImplementation *cache;
+@property (nonatomic, strong) HUBComponentUIStateManager *manager;
+
+@end
+
+@implementation HUBComponentUIStateManagerTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    self.cache = [HUBComponentUIStateCacheImplementation new];
+    self.manager = [[HUBComponentUIStateManager alloc] initWithCache:self.cache];
+}
+
+#pragma mark - Tests
+
+- (void)testLeastRecentlyUsedStateIsEvictedOnceCountLimitIsExceeded
+{
+    self.cache.countLimit = 2;
+    
+    [self.manager saveUIState:@"A" forComponentModel:[self modelWithIdentifier:@"a"] cost:0];
+    [self.manager saveUIState:@"B" forComponentModel:[self modelWithIdentifier:@"b"] cost:0];
+    XCTAssertEqualObjects([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"a"]], @"A");
+    [self.manager saveUIState:@"C" forComponentModel:[self modelWithIdentifier:@"c"] cost:0];
+    
+    XCTAssertNil([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"b"]]);
+    XCTAssertEqualObjects([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"a"]], @"A");
+    XCTAssertEqual(self.cache.evictionCount, (NSUInteger)1);
+}
+
+- (void)testStatesAreEvictedOnceTotalCostLimitIsExceeded
+{
+    self.cache.totalCostLimit = 10;
+    
+    [self.manager saveUIState:@"A" forComponentModel:[self modelWithIdentifier:@"a"] cost:6];
+    [self.manager saveUIState:@"B" forComponentModel:[self modelWithIdentifier:@"b"] cost:6];
+    
+    XCTAssertNil([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"a"]]);
+    XCTAssertEqualObjects([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"b"]], @"B");
+    XCTAssertEqual(self.cache.evictionCount, (NSUInteger)1);
+}
+
+- (void)testSpilledStateIsRestoredWithItsCost
+{
+    self.cache.totalCostLimit = 10;
+    self.cache.spillsEvictedStates = YES;
+    
+    [self.manager saveUIState:@"A" forComponentModel:[self modelWithIdentifier:@"a"] cost:6];
+    [self.manager saveUIState:@"B" forComponentModel:[self modelWithIdentifier:@"b"] cost:6];
+    XCTAssertEqual(self.cache.spillCount, (NSUInteger)1);
+    
+    // Restoring the spilled state brings its cost back, which evicts the other one
+    XCTAssertEqualObjects([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"a"]], @"A");
+    XCTAssertEqual(self.cache.evictionCount, (NSUInteger)2);
+    XCTAssertEqual(self.cache.spillCount, (NSUInteger)2);
+}
+
+- (void)testPurgingDiscardsAllStatesAndIsCounted
+{
+    [self.manager saveUIState:@"A" forComponentModel:[self modelWithIdentifier:@"a"] cost:0];
+    [self.manager saveUIState:@"B" forComponentModel:[self modelWithIdentifier:@"b"] cost:0];
+    [self.manager purgeAllStates];
+    
+    XCTAssertNil([self.manager restoreUIStateForComponentModel:[self modelWithIdentifier:@"a"]]);
+    XCTAssertEqual(self.cache.purgeCount, (NSUInteger)2);
+    
+    [self.cache resetCounters];
+    XCTAssertEqual(self.cache.purgeCount, (NSUInteger)0);
+}
+
+#pragma mark - Utilities
+
+- (id<HUBComponentModel>)modelWithIdentifier:(NSString *)identifier
+{
+    HUBComponentDefaults * const componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"state"
+                                                                                                componentName:@"row"
+                                                                                            componentCategory:HUBComponentCategoryRow];
+    
+    id<HUBJSONSchema> const JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:componentDefaults
+                                                                                       iconImageResolver:nil];
+    
+    HUBComponentModelBuilderImplementation * const builder = [[HUBComponentModelBuilderImplementation alloc] initWithModelIdentifier:identifier
+                                                                                                                                type:HUBComponentTypeBody
+                                                                                                                          JSONSchema:JSONSchema
+                                                                                                                   componentDefaults:componentDefaults
+                                                                                                                   iconImageResolver:nil
+                                                                                                                mainImageDataBuilder:nil
+                                                                                                          backgroundImageDataBuilder:nil];
+    
+    return [builder buildForIndex:0 parent:nil];
+}
+
+@end
@@ -0,0 +1,285 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBBlockContentOperation.h"
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModel.h"
+#import "HUBComponentModelBuilder.h"
+#import "HUBConnectivityStateResolver.h"
+#import "HUBContentOperationContext.h"
+#import "HUBContentOperationRecorderImplementation.h"
+#import "HUBContentOperationRecording.h"
+#import "HUBContentOperationReplayer.h"
+#import "HUBFeatureInfoImplementation.h"
+#import "HUBJSONSchemaImplementation.h"
+#import "HUBPerformanceTracker.h"
+#import "HUBViewModel.h"
+#import "HUBViewModelBuilder.h"
+#import "HUBViewModelLoaderImplementation.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+#pragma mark - Test doubles
+
+@interface HUBRecorderTestConnectivityStateResolver : NSObject <HUBConnectivityStateResolver>
+
+@property (nonatomic, assign) HUBConnectivityState connectivityState;
+@property (nonatomic, weak, nullable) id<HUBConnectivityStateResolverObserver> observer;
+
+@end
+
+@implementation HUBRecorderTestConnectivityStateResolver
+
+- (HUBConnectivityState)resolveConnectivityState
+{
+    return self.connectivityState;
+}
+
+- (void)addObserver:(id<HUBConnectivityStateResolverObserver>)observer
+{
+    self.observer = observer;
+}
+
+- (void)removeObserver:(id<HUBConnectivityStateResolverObserver>)observer
+{
+    self.observer = nil;
+}
+
+@end
+
+/// Content operation that updates the subtitle of the second row, or fails with an error
+@interface HUBRecorderTestContentOperation : NSObject <HUBContentOperation>
+
+@property (nonatomic, weak, nullable) id<HUBContentOperationDelegate> delegate;
+@property (nonatomic, strong, nullable) NSError *error;
+@property (nonatomic, assign) NSUInteger performCount;
+
+@end
+
+@implementation HUBRecorderTestContentOperation
+
+- (void)performForViewURI:(NSURL *)viewURI
+              featureInfo:(id<HUBFeatureInfo>)featureInfo
+        connectivityState:(HUBConnectivityState)connectivityState
+         viewModelBuilder:(id<HUBViewModelBuilder>)viewModelBuilder
+            previousError:(nullable NSError *)previousError
+{
+    self.performCount++;
+    
+    NSError * const error = self.error;
+    
+    if (error != nil) {
+        [self.delegate contentOperation:self didFailWithError:error];
+        return;
+    }
+    
+    NSString * const subtitle = [NSString stringWithFormat:@"Update %@", @(self.performCount)];
+    [viewModelBuilder builderForBodyComponentModelWithIdentifier:@"row-1"].subtitle = subtitle;
+    [self.delegate contentOperationDidFinish:self];
+}
+
+@end
+
+#pragma mark - Tests
+
+@interface HUBContentOperationRecorderTests : XCTestCase <HUBViewModelLoaderDelegate>
+
+@property (nonatomic, strong) HUBComponentDefaults *componentDefaults;
+@property (nonatomic, strong) HUBContentOperationRecorderImplementation *recorder;
+@property (nonatomic, strong) HUBRecorderTestConnectivityStateResolver *connectivityStateResolver;
+@property (nonatomic, strong) HUBRecorderTestContentOperation *updateOperation;
+@property (nonatomic, strong) HUBViewModelLoaderImplementation *loader;
+@property (nonatomic, strong, nullable) id<HUBViewModel> viewModel;
+@property (nonatomic, strong, nullable) NSError *error;
+
+@end
+
+@implementation HUBContentOperationRecorderTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    self.componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"recorder"
+                                                                        componentName:@"row"
+                                                                    componentCategory:HUBComponentCategoryRow];
+    
+    self.recorder = [HUBContentOperationRecorderImplementation new];
+    self.connectivityStateResolver = [HUBRecorderTestConnectivityStateResolver new];
+    self.updateOperation = [HUBRecorderTestContentOperation new];
+    self.viewModel = nil;
+    self.error = nil;
+    
+    HUBBlockContentOperation * const rowsOperation = [[HUBBlockContentOperation alloc] initWithBlock:^(id<HUBContentOperationContext> context) {
+        for (NSUInteger index = 0; index < 3; index++) {
+            NSString * const identifier = [NSString stringWithFormat:@"row-%@", @(index)];
+            [context.viewModelBuilder builderForBodyComponentModelWithIdentifier:identifier].title = identifier;
+        }
+    }];
+    
+    id<HUBJSONSchema> const JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:self.componentDefaults
+                                                                                      iconImageResolver:nil];
+    
+    NSURL * const viewURI = [NSURL URLWithString:@"recorder:view"];
+    HUBPerformanceTracker * const performanceTracker = [[HUBPerformanceTracker new] trackerForViewURI:viewURI
+                                                                                    featureIdentifier:@"recorder"];
+    
+    self.loader = [[HUBViewModelLoaderImplementation alloc] initWithViewURI:viewURI
+                                                                featureInfo:[[HUBFeatureInfoImplementation alloc] initWithIdentifier:@"recorder" title:@"Recorder"]
+                                                          contentOperations:@[rowsOperation, self.updateOperation]
+                                                        contentReloadPolicy:nil
+                                                                 JSONSchema:JSONSchema
+                                                          componentDefaults:self.componentDefaults
+                                                  connectivityStateResolver:self.connectivityStateResolver
+                                                          iconImageResolver:nil
+                                                           initialViewModel:nil
+                                                         performanceTracker:performanceTracker
+                                                   contentOperationRecorder:self.recorder];
+    
+    self.loader.connectivityStateChangeDebounceInterval = 0;
+    self.loader.delegate = self;
+}
+
+#pragma mark - Tests
+
+- (void)testNothingIsRecordedUnlessRecording
+{
+    [self.loader loadViewModel];
+    
+    XCTAssertNotNil(self.viewModel);
+    XCTAssertFalse(self.recorder.recording);
+    XCTAssertEqual(self.recorder.recordedEventCount, (NSUInteger)0);
+}
+
+- (void)testRecordedSessionIsWrittenAndReplayed
+{
+    [self.recorder startRecording];
+    
+    [self.loader loadViewModel];
+    
+    self.updateOperation.error = [NSError errorWithDomain:@"recorder" code:7 userInfo:nil];
+    [self.updateOperation.delegate contentOperationRequiresRescheduling:self.updateOperation];
+    XCTAssertNotNil(self.error);
+    
+    self.updateOperation.error = nil;
+    self.connectivityStateResolver.connectivityState = HUBConnectivityStateOffline;
+    [self.connectivityStateResolver.observer connectivityStateResolverStateDidChange:self.connectivityStateResolver];
+    
+    id<HUBViewModel> const recordedViewModel = self.viewModel;
+    XCTAssertEqualObjects(recordedViewModel.bodyComponentModels[1].subtitle, @"Update 3");
+    XCTAssertEqual(self.recorder.recordedEventCount, (NSUInteger)8);
+    
+    NSURL * const fileURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+    NSError *error = nil;
+    XCTAssertTrue([self.recorder stopRecordingAndWriteToURL:fileURL error:&error]);
+    XCTAssertNil(error);
+    XCTAssertFalse(self.recorder.recording);
+    
+    NSData * const data = [NSData dataWithContentsOfURL:fileURL];
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+    
+    NSArray<HUBContentOperationRecording *> * const recordings = [HUBContentOperationRecording recordingsFromJSONData:data error:&error];
+    XCTAssertNil(error);
+    XCTAssertEqual(recordings.count, (NSUInteger)1);
+    
+    HUBContentOperationRecording * const recording = recordings.firstObject;
+    NSArray<NSString *> * const expectedEventTypes = @[@"load", @"contentOperation", @"contentOperation",
+                                                       @"rescheduling", @"contentOperation",
+                                                       @"connectivityStateChange", @"contentOperation", @"contentOperation"];
+    XCTAssertEqualObjects([self eventTypeNamesForRecording:recording], expectedEventTypes);
+    XCTAssertEqualObjects(recording.events[4].error.domain, @"recorder");
+    XCTAssertEqual(recording.events[4].error.code, 7);
+    XCTAssertEqual(recording.events[5].connectivityState, HUBConnectivityStateOffline);
+    
+    HUBContentOperationReplayer * const replayer = [[HUBContentOperationReplayer alloc] initWithRecording:recording
+                                                                                        componentDefaults:self.componentDefaults];
+    
+    NSArray<NSDictionary<NSString *, id> *> * const profiles = [replayer replay];
+    XCTAssertEqual(profiles.count, (NSUInteger)3);
+    XCTAssertEqual(replayer.unmatchedContentOperationCount, (NSUInteger)0);
+    
+    XCTAssertEqualObjects(profiles[0][@"contentOperationCount"], @2);
+    XCTAssertEqualObjects(profiles[0][@"componentCount"], @3);
+    XCTAssertNil(profiles[0][@"error"]);
+    XCTAssertEqualObjects(profiles[1][@"contentOperationCount"], @1);
+    XCTAssertNotNil(profiles[1][@"error"]);
+    XCTAssertEqualObjects(profiles[2][@"event"], @"connectivityStateChange");
+    XCTAssertEqualObjects(profiles[2][@"contentOperationCount"], @2);
+    XCTAssertNil(profiles[2][@"error"]);
+    
+    // Virtual time covers at least the recorded durations, so it never goes backwards across loads
+    XCTAssertGreaterThanOrEqual([profiles[2][@"startTime"] doubleValue], [profiles[1][@"startTime"] doubleValue]);
+    XCTAssertGreaterThanOrEqual(replayer.virtualTime, recording.events[5].time);
+    
+    id<HUBViewModel> const replayedViewModel = replayer.viewModel;
+    XCTAssertEqual(replayedViewModel.bodyComponentModels.count, recordedViewModel.bodyComponentModels.count);
+    
+    for (NSUInteger index = 0; index < recordedViewModel.bodyComponentModels.count; index++) {
+        id<HUBComponentModel> const recordedModel = recordedViewModel.bodyComponentModels[index];
+        id<HUBComponentModel> const replayedModel = replayedViewModel.bodyComponentModels[index];
+        XCTAssertEqualObjects(replayedModel.identifier, recordedModel.identifier);
+        XCTAssertEqualObjects(replayedModel.title, recordedModel.title);
+        XCTAssertEqualObjects(replayedModel.subtitle, recordedModel.subtitle);
+    }
+}
+
+- (void)testInvalidRecordingDataIsRejected
+{
+    NSData * const data = [NSJSONSerialization dataWithJSONObject:@{@"version": @2, @"views": @[]} options:(NSJSONWritingOptions)0 error:nil];
+    
+    NSError *error = nil;
+    XCTAssertNil([HUBContentOperationRecording recordingsFromJSONData:data error:&error]);
+    XCTAssertNotNil(error);
+}
+
+#pragma mark - HUBViewModelLoaderDelegate
+
+- (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didLoadViewModel:(id<HUBViewModel>)viewModel
+{
+    self.viewModel = viewModel;
+    self.error = nil;
+}
+
+- (void)viewModelLoader:(id<HUBViewModelLoader>)viewModelLoader didFailLoadingWithError:(NSError *)error
+{
+    self.error = error;
+}
+
+#pragma mark - Utilities
+
+- (NSArray<NSString *> *)eventTypeNamesForRecording:(HUBContentOperationRecording *)recording
+{
+    NSMutableArray<NSString *> * const names = [NSMutableArray new];
+    
+    for (HUBContentOperationRecordedEvent * const event in recording.events) {
+        [names addObject:HUBContentOperationRecordedEventTypeName(event.type)];
+    }
+    
+    return names;
+}
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBDataCompression.h"
+#import "HUBTestDataCompression.h"
+
+@interface HUBDataCompressionTests : XCTestCase
+
+@end
+
+@implementation HUBDataCompressionTests
+
+#pragma mark - Tests
+
+- (void)testSmallPayloadIsLeftUncompressed
+{
+    NSData * const data = [@"{\"body\":[]}" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertEqual(HUBCompressDataIfNeeded(data), data);
+}
+
+- (void)testUncompressedPayloadIsPassedThrough
+{
+    NSData * const data = [self JSONDataWithLength:4096];
+    XCTAssertFalse(HUBDataIsCompressed(data));
+    XCTAssertEqual(HUBDecompressDataIfNeeded(data, nil), data);
+}
+
+- (void)testRoundTrip
+{
+    NSData * const data = [self JSONDataWithLength:256 * 1024];
+    NSData * const compressedData = HUBCompressDataIfNeeded(data);
+    
+    XCTAssertLessThan(compressedData.length, data.length);
+    XCTAssertTrue(HUBDataIsCompressed(compressedData));
+    
+    NSError *error = nil;
+    XCTAssertEqualObjects(HUBDecompressDataIfNeeded(compressedData, &error), data);
+    XCTAssertNil(error);
+}
+
+- (void)testTruncatedPayloadFails
+{
+    NSData * const compressedData = HUBCompressDataIfNeeded([self JSONDataWithLength:64 * 1024]);
+    NSData * const truncatedData = [compressedData subdataWithRange:NSMakeRange(0, compressedData.length / 2)];
+    
+    NSError *error = nil;
+    XCTAssertNil(HUBDecompressDataIfNeeded(truncatedData, &error));
+    XCTAssertNotNil(error);
+}
+
+- (void)testPayloadDecompressingPastMaximumLengthFails
+{
+    NSMutableData * const data = [NSMutableData dataWithLength:HUBDataCompressionMaximumDecompressedLength + 1];
+    NSData * const compressedData = HUBCompressDataIfNeeded(data);
+    
+    // A run of zeros compresses about 1000x, so the payload itself is small
+    XCTAssertLessThan(compressedData.length, (NSUInteger)64 * 1024);
+    
+    NSError *error = nil;
+    XCTAssertNil(HUBDecompressDataIfNeeded(compressedData, &error));
+    XCTAssertNotNil(error);
+}
+
+- (void)testPayloadDecompressingToExactlyMaximumLengthSucceeds
+{
+    NSMutableData * const data = [NSMutableData dataWithLength:HUBDataCompressionMaximumDecompressedLength];
+    NSData * const compressedData = HUBCompressDataIfNeeded(data);
+    
+    XCTAssertEqual(HUBDecompressDataIfNeeded(compressedData, nil).length, HUBDataCompressionMaximumDecompressedLength);
+}
+
+#pragma mark - Utilities
+
+- (NSData *)JSONDataWithLength:(NSUInteger)length
+{
+    NSMutableString * const JSONString = [NSMutableString stringWithString:@"{\"body\":["];
+    NSUInteger index = 0;
+    
+    while (JSONString.length < length) {
+        [JSONString appendFormat:@"{\"id\":\"component-%@\",\"text\":{\"title\":\"Title %@\"}},", @(index), @(index)];
+        index++;
+    }
+    
+    [JSONString appendString:@"{}]}"];
+    return [JSONString dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+@end
@@ -0,0 +1,188 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBLiveContentOperation.h"
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModel.h"
+#import "HUBDataCompression.h"
+#import "HUBFeatureInfoImplementation.h"
+#import "HUBJSONSchemaImplementation.h"
+#import "HUBTestDataCompression.h"
+#import "HUBViewModel.h"
+#import "HUBViewModelBuilderImplementation.h"
+
+#if HUB_DEBUG
+
+@interface HUBLiveContentOperationTests : XCTestCase <HUBContentOperationDelegate>
+
+@property (nonatomic, strong) HUBComponentDefaults *componentDefaults;
+@property (nonatomic, strong) id<HUBJSONSchema> JSONSchema;
+@property (nonatomic, assign) NSUInteger rescheduleCount;
+
+@end
+
+@implementation HUBLiveContentOperationTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    self.componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"live"
+                                                                         componentName:@"row"
+                                                                     componentCategory:HUBComponentCategoryRow];
+    
+    self.JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:self.componentDefaults
+                                                                    iconImageResolver:nil];
+    
+    self.rescheduleCount = 0;
+}
+
+#pragma mark - Tests
+
+- (void)testPatchIsAppliedAndReschedules
+{
+    HUBLiveContentOperation * const operation = [self operationWithJSONData:[self documentData]];
+    
+    NSError *error = nil;
+    XCTAssertTrue([operation applyJSONPatch:@[@{@"op": @"replace", @"path": @"/body/0/text/title", @"value": @"Patched"}]
+                                      error:&error]);
+    XCTAssertNil(error);
+    XCTAssertEqual(self.rescheduleCount, (NSUInteger)1);
+    
+    XCTAssertEqualObjects([self viewModelFromOperation:operation].bodyComponentModels[0].title, @"Patched");
+}
+
+- (void)testPatchIsAppliedToCompressedData
+{
+    NSData * const compressedData = HUBCompressDataIfNeeded([self documentDataWithComponentCount:200]);
+    XCTAssertTrue(HUBDataIsCompressed(compressedData));
+    
+    HUBLiveContentOperation * const operation = [self operationWithJSONData:compressedData];
+    
+    NSError *error = nil;
+    XCTAssertTrue([operation applyJSONPatch:@[@{@"op": @"remove", @"path": @"/body/0"}] error:&error]);
+    XCTAssertNil(error);
+    
+    XCTAssertEqual([self viewModelFromOperation:operation].bodyComponentModels.count, (NSUInteger)199);
+}
+
+- (void)testLaterPatchDoesNotMutateContentPassedToBuilder
+{
+    HUBLiveContentOperation * const operation = [self operationWithJSONData:[self documentData]];
+    XCTAssertTrue([operation applyJSONPatch:@[@{@"op": @"replace", @"path": @"/body/0/text/title", @"value": @"First"}] error:nil]);
+    
+    HUBViewModelBuilderImplementation * const builder = [self createBuilder];
+    [self performOperation:operation withBuilder:builder];
+    
+    XCTAssertTrue([operation applyJSONPatch:@[@{@"op": @"replace", @"path": @"/body/0/text/title", @"value": @"Second"}] error:nil]);
+    
+    XCTAssertEqualObjects([builder build].bodyComponentModels[0].title, @"First");
+    XCTAssertEqualObjects([self viewModelFromOperation:operation].bodyComponentModels[0].title, @"Second");
+}
+
+- (void)testPointerWithoutLeadingSlashIsRejected
+{
+    HUBLiveContentOperation * const operation = [self operationWithJSONData:[self documentData]];
+    
+    NSError *error = nil;
+    XCTAssertFalse([operation applyJSONPatch:@[@{@"op": @"remove", @"path": @"body/0"}] error:&error]);
+    XCTAssertNotNil(error);
+    
+    XCTAssertFalse([operation applyJSONPatch:@[@{@"op": @"move", @"from": @"body/0", @"path": @"/body/1"}] error:&error]);
+    XCTAssertEqual(self.rescheduleCount, (NSUInteger)0);
+    XCTAssertEqual([self viewModelFromOperation:operation].bodyComponentModels.count, (NSUInteger)2);
+}
+
+#pragma mark - HUBContentOperationDelegate
+
+- (void)contentOperationDidFinish:(id<HUBContentOperation>)operation
+{
+    // Operations finish synchronously
+}
+
+- (void)contentOperation:(id<HUBContentOperation>)operation didFailWithError:(NSError *)error
+{
+    XCTFail(@"Unexpected content operation error: %@", error);
+}
+
+- (void)contentOperationRequiresRescheduling:(id<HUBContentOperation>)operation
+{
+    self.rescheduleCount++;
+}
+
+#pragma mark - Utilities
+
+- (NSData *)documentData
+{
+    return [self documentDataWithComponentCount:2];
+}
+
+- (NSData *)documentDataWithComponentCount:(NSUInteger)componentCount
+{
+    NSMutableArray<NSDictionary *> * const body = [NSMutableArray new];
+    
+    for (NSUInteger index = 0; index < componentCount; index++) {
+        [body addObject:@{
+            @"id": [NSString stringWithFormat:@"component-%@", @(index)],
+            @"text": @{@"title": [NSString stringWithFormat:@"Title %@", @(index)]}
+        }];
+    }
+    
+    return [NSJSONSerialization dataWithJSONObject:@{@"body": body} options:(NSJSONWritingOptions)0 error:nil];
+}
+
+- (HUBLiveContentOperation *)operationWithJSONData:(NSData *)JSONData
+{
+    HUBLiveContentOperation * const operation = [[HUBLiveContentOperation alloc] initWithJSONData:JSONData];
+    operation.delegate = self;
+    return operation;
+}
+
+- (HUBViewModelBuilderImplementation *)createBuilder
+{
+    return [[HUBViewModelBuilderImplementation alloc] initWithJSONSchema:self.JSONSchema
+                                                       componentDefaults:self.componentDefaults
+                                                       iconImageResolver:nil];
+}
+
+- (void)performOperation:(HUBLiveContentOperation *)operation withBuilder:(HUBViewModelBuilderImplementation *)builder
+{
+    [operation performForViewURI:[NSURL URLWithString:@"hubframework:live"]
+                     featureInfo:[[HUBFeatureInfoImplementation alloc] initWithIdentifier:@"live" title:@"Live"]
+               connectivityState:HUBConnectivityStateOnline
+                viewModelBuilder:builder
+                   previousError:nil];
+}
+
+- (id<HUBViewModel>)viewModelFromOperation:(HUBLiveContentOperation *)operation
+{
+    HUBViewModelBuilderImplementation * const builder = [self createBuilder];
+    [self performOperation:operation withBuilder:builder];
+    return [builder build];
+}
+
+@end
+
+#endif // DEBUG
@@ -0,0 +1,176 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import <sys/socket.h>
+#import <unistd.h>
+
+#import "HUBLiveFrameReader.h"
+
+#if HUB_DEBUG
+
+/// Tests for `HUBLiveFrameReader`, feeding it from a local socket the same way the live service does from its connection
+@interface HUBLiveFrameReaderTests : XCTestCase
+
+@property (nonatomic, strong) HUBLiveFrameReader *frameReader;
+@property (nonatomic, strong) NSInputStream *inputStream;
+@property (nonatomic, assign) int writeSocket;
+
+@end
+
+@implementation HUBLiveFrameReaderTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    int sockets[2];
+    XCTAssertEqual(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+    
+    CFReadStreamRef readStream = NULL;
+    CFStreamCreatePairWithSocket(kCFAllocatorDefault, sockets[0], &readStream, NULL);
+    
+    self.inputStream = CFBridgingRelease(readStream);
+    [self.inputStream setProperty:@YES forKey:(__bridge NSString *)kCFStreamPropertyShouldCloseNativeSocket];
+    [self.inputStream open];
+    
+    self.writeSocket = sockets[1];
+    self.frameReader = [HUBLiveFrameReader new];
+}
+
+- (void)tearDown
+{
+    [self.inputStream close];
+    close(self.writeSocket);
+    
+    [super tearDown];
+}
+
+#pragma mark - Tests
+
+- (void)testFramesSplitAcrossReads
+{
+    NSData * const document = [@"{\"body\":[{\"id\":\"a\"}]}" dataUsingEncoding:NSUTF8StringEncoding];
+    NSData * const patch = [@"[{\"op\":\"remove\",\"path\":\"/body/0\"}]" dataUsingEncoding:NSUTF8StringEncoding];
+    
+    NSMutableData * const data = [NSMutableData new];
+    [data appendData:[self frameWithType:HUBLiveFrameTypeDocument payload:document]];
+    [data appendData:[self frameWithType:HUBLiveFrameTypePatch payload:patch]];
+    
+    NSArray<NSArray *> * const frames = [self framesReadFromSocketAfterWritingData:data chunkLength:7];
+    
+    XCTAssertEqual(frames.count, (NSUInteger)2);
+    XCTAssertEqualObjects(frames[0], (@[@(HUBLiveFrameTypeDocument), document]));
+    XCTAssertEqualObjects(frames[1], (@[@(HUBLiveFrameTypePatch), patch]));
+    XCTAssertFalse(self.frameReader.failed);
+}
+
+- (void)testFrameWithUnknownTypeFails
+{
+    NSData * const data = [self frameWithType:(HUBLiveFrameType)9 payload:[@"{}" dataUsingEncoding:NSUTF8StringEncoding]];
+    
+    XCTAssertEqual([self framesReadFromSocketAfterWritingData:data chunkLength:data.length].count, (NSUInteger)0);
+    XCTAssertTrue(self.frameReader.failed);
+}
+
+- (void)testUnframedDocumentsSplitAcrossReads
+{
+    // Braces inside strings, including after escaped quotes, must not end a document
+    NSString * const firstDocument = @"{\"title\":\"}{\\\"}\",\"body\":[{\"id\":\"a\"}]}";
+    NSString * const secondDocument = @"{\"body\":[[],{\"id\":\"b\"}]}";
+    NSString * const stream = [NSString stringWithFormat:@"%@\n%@ \n", firstDocument, secondDocument];
+    
+    NSArray<NSArray *> * const frames = [self framesReadFromSocketAfterWritingData:[stream dataUsingEncoding:NSUTF8StringEncoding]
+                                                                       chunkLength:3];
+    
+    XCTAssertEqual(frames.count, (NSUInteger)2);
+    XCTAssertEqualObjects(frames[0], (@[@(HUBLiveFrameTypeDocument), [firstDocument dataUsingEncoding:NSUTF8StringEncoding]]));
+    XCTAssertEqualObjects(frames[1], (@[@(HUBLiveFrameTypeDocument), [secondDocument dataUsingEncoding:NSUTF8StringEncoding]]));
+    XCTAssertFalse(self.frameReader.failed);
+}
+
+- (void)testUnframedDataBetweenDocumentsFails
+{
+    NSData * const data = [@"{\"body\":[]} x" dataUsingEncoding:NSUTF8StringEncoding];
+    
+    XCTAssertEqual([self framesReadFromSocketAfterWritingData:data chunkLength:data.length].count, (NSUInteger)1);
+    XCTAssertTrue(self.frameReader.failed);
+}
+
+#pragma mark - Utilities
+
+- (NSData *)frameWithType:(HUBLiveFrameType)type payload:(NSData *)payload
+{
+    uint32_t const length = (uint32_t)payload.length;
+    uint8_t const header[5] = {
+        (uint8_t)(length >> 24),
+        (uint8_t)(length >> 16),
+        (uint8_t)(length >> 8),
+        (uint8_t)length,
+        type
+    };
+    
+    NSMutableData * const frame = [NSMutableData dataWithBytes:header length:sizeof(header)];
+    [frame appendData:payload];
+    return frame;
+}
+
+/// Write data to the socket in chunks, reading any complete frames after each chunk. Returns [type, payload] pairs.
+- (NSArray<NSArray *> *)framesReadFromSocketAfterWritingData:(NSData *)data chunkLength:(NSUInteger)chunkLength
+{
+    NSMutableArray<NSArray *> * const frames = [NSMutableArray new];
+    
+    for (NSUInteger offset = 0; offset < data.length; offset += chunkLength) {
+        NSUInteger const length = MIN(chunkLength, data.length - offset);
+        XCTAssertEqual(write(self.writeSocket, (const uint8_t *)data.bytes + offset, length), (ssize_t)length);
+        
+        NSInteger bytesRead = 0;
+        NSDate * const timeoutDate = [NSDate dateWithTimeIntervalSinceNow:5];
+        
+        while (bytesRead < (NSInteger)length && [timeoutDate timeIntervalSinceNow] > 0) {
+            if (!self.inputStream.hasBytesAvailable) {
+                [[NSRunLoop currentRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.001]];
+                continue;
+            }
+            
+            NSInteger const chunkBytesRead = [self.frameReader appendBytesFromStream:self.inputStream];
+            XCTAssertGreaterThanOrEqual(chunkBytesRead, 0);
+            bytesRead += MAX(chunkBytesRead, 0);
+        }
+        
+        XCTAssertEqual(bytesRead, (NSInteger)length);
+        
+        HUBLiveFrameType type = HUBLiveFrameTypeDocument;
+        NSData *payload = nil;
+        
+        while ((payload = [self.frameReader nextFramePayloadWithType:&type]) != nil) {
+            [frames addObject:@[@(type), payload]];
+        }
+    }
+    
+    return frames;
+}
+
+@end
+
+#endif // DEBUG
@@ -0,0 +1,121 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+#import <XCTest/XCTest.h>
+
+#import "HUBComponentCategories.h"
+#import "HUBComponentDefaults.h"
+#import "HUBComponentModel.h"
+#import "HUBComponentModelBuilder.h"
+#import "HUBJSONSchemaImplementation.h"
+#import "HUBViewModel.h"
+#import "HUBViewModelBuilderImplementation.h"
+#import "HUBViewModelDiff.h"
+#import "HUBWindowedComponentModelArray.h"
+
+static NSUInteger const HUBWindowedViewModelDiffComponentCount = 2000;
+
+@interface HUBWindowedViewModelDiffTests : XCTestCase
+
+@property (nonatomic, strong) HUBViewModelBuilderImplementation *builder;
+
+@end
+
+@implementation HUBWindowedViewModelDiffTests
+
+#pragma mark - XCTestCase
+
+- (void)setUp
+{
+    [super setUp];
+    
+    HUBComponentDefaults * const componentDefaults = [[HUBComponentDefaults alloc] initWithComponentNamespace:@"windowed"
+                                                                                                componentName:@"row"
+                                                                                            componentCategory:HUBComponentCategoryRow];
+    
+    id<HUBJSONSchema> const JSONSchema = [[HUBJSONSchemaImplementation alloc] initWithComponentDefaults:componentDefaults
+                                                                                       iconImageResolver:nil];
+    
+    self.builder = [[HUBViewModelBuilderImplementation alloc] initWithJSONSchema:JSONSchema
+                                                               componentDefaults:componentDefaults
+                                                               iconImageResolver:nil];
+    
+    for (NSUInteger index = 0; index < HUBWindowedViewModelDiffComponentCount; index++) {
+        NSString * const identifier = [NSString stringWithFormat:@"component-%lu", (unsigned long)index];
+        [self.builder builderForBodyComponentModelWithIdentifier:identifier].title = identifier;
+    }
+}
+
+#pragma mark - Tests
+
+- (void)testUnmodifiedComponentsAreNotReloaded
+{
+    id<HUBViewModel> const fromViewModel = [self.builder build];
+    id<HUBViewModel> const toViewModel = [self.builder build];
+    
+    HUBViewModelDiff * const diff = [HUBViewModelDiff diffFromViewModel:fromViewModel toViewModel:toViewModel];
+    XCTAssertEqual(diff.reloadedBodyComponentIndexPaths.count, (NSUInteger)0);
+    XCTAssertEqual(diff.insertedBodyComponentIndexPaths.count, (NSUInteger)0);
+    XCTAssertEqual(diff.deletedBodyComponentIndexPaths.count, (NSUInteger)0);
+}
+
+- (void)testModifiedComponentIsReloadedWithoutBuildingModels
+{
+    id<HUBViewModel> const fromViewModel = [self.builder build];
+    [self.builder builderForBodyComponentModelWithIdentifier:@"component-1500"].title = @"Modified";
+    id<HUBViewModel> const toViewModel = [self.builder build];
+    
+    XCTAssertTrue([toViewModel.bodyComponentModels isKindOfClass:[HUBWindowedComponentModelArray class]]);
+    
+    HUBDiffAlgorithm * const algorithms[] = {HUBDiffMyersAlgorithm, HUBDiffLCSAlgorithm};
+    
+    for (size_t index = 0; index < sizeof(algorithms) / sizeof(algorithms[0]); index++) {
+        HUBViewModelDiff * const diff = [HUBViewModelDiff diffFromViewModel:fromViewModel toViewModel:toViewModel algorithm:algorithms[index]];
+        XCTAssertEqualObjects(diff.reloadedBodyComponentIndexPaths, @[[NSIndexPath indexPathForItem:1500 inSection:0]]);
+    }
+    
+    // Building the model outside the window would have moved it
+    NSRange const windowRange = ((HUBWindowedComponentModelArray *)toViewModel.bodyComponentModels).windowRange;
+    XCTAssertEqual(windowRange.location, (NSUInteger)0);
+    
+    XCTAssertEqualObjects(toViewModel.bodyComponentModels[1500].title, @"Modified");
+    XCTAssertTrue(NSLocationInRange(1500, ((HUBWindowedComponentModelArray *)toViewModel.bodyComponentModels).windowRange));
+}
+
+- (void)testComponentModifiedThroughHeldBuilderAfterBuildIsReloaded
+{
+    id<HUBComponentModelBuilder> const componentBuilder = [self.builder builderForBodyComponentModelWithIdentifier:@"component-700"];
+    id<HUBComponentModelBuilder> const childBuilder = [componentBuilder builderForChildWithIdentifier:@"child"];
+    id<HUBViewModel> const fromViewModel = [self.builder build];
+    
+    componentBuilder.subtitle = @"Modified";
+    id<HUBViewModel> const toViewModel = [self.builder build];
+    
+    HUBViewModelDiff * const diff = [HUBViewModelDiff diffFromViewModel:fromViewModel toViewModel:toViewModel];
+    XCTAssertEqualObjects(diff.reloadedBodyComponentIndexPaths, @[[NSIndexPath indexPathForItem:700 inSection:0]]);
+    
+    childBuilder.targetBuilder.URI = [NSURL URLWithString:@"spotify:modified"];
+    id<HUBViewModel> const childModifiedViewModel = [self.builder build];
+    
+    HUBViewModelDiff * const childDiff = [HUBViewModelDiff diffFromViewModel:toViewModel toViewModel:childModifiedViewModel];
+    XCTAssertEqualObjects(childDiff.reloadedBodyComponentIndexPaths, @[[NSIndexPath indexPathForItem:700 inSection:0]]);
+}
+
+@end
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Compression helpers for tests and benchmarks
+ *
+ *  The framework only ever decompresses data (see `HUBDataCompression.h`), since the compressed payloads it
+ *  accepts are produced by servers or the `hublive` application. These produce the same kind of payloads.
+ */
+
+/// Payloads smaller than this (in bytes) are not worth compressing, and are left as-is
+static NSUInteger const HUBDataCompressionMinimumPayloadLength = 1024;
+
+/**
+ *  Return the zlib compression level (1-9) that should be used for a payload of a given size
+ *
+ *  @param length The length of the uncompressed payload, in bytes
+ *
+ *  Small payloads are cheap to compress, so they use the best compression. As payloads grow, the
+ *  level is lowered to keep the compression time down, trading a few percent of output size for it.
+ */
+extern int HUBCompressionLevelForPayloadLength(NSUInteger length);
+
+/**
+ *  Gzip some data, using a compression level picked by `HUBCompressionLevelForPayloadLength()`
+ *
+ *  @param data The data to compress
+ *
+ *  @return The compressed data, or `data` itself if it's shorter than `HUBDataCompressionMinimumPayloadLength`,
+ *          if compressing it didn't make it any smaller, or if compression failed.
+ */
+extern NSData *HUBCompressDataIfNeeded(NSData *data);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2016 Spotify AB.
+ *
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#import "HUBTestDataCompression.h"
+
+#import <GoogleToolboxForMac/GTMNSData+zlib.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+int HUBCompressionLevelForPayloadLength(NSUInteger length)
+{
+    if (length < 64 * 1024) {
+        return 9;
+    }
+    
+    if (length < 1024 * 1024) {
+        return 6;
+    }
+    
+    return 1;
+}
+
+NSData *HUBCompressDataIfNeeded(NSData *data)
+{
+    if (data.length < HUBDataCompressionMinimumPayloadLength) {
+        return data;
+    }
+    
+    NSData * const compressedData = [NSData gtm_dataByGzippingData:data
+                                                  compressionLevel:HUBCompressionLevelForPayloadLength(data.length)
+                                                             error:nil];
+    
+    if (compressedData == nil || compressedData.length >= data.length) {
+        return data;
+    }
+    
+    return compressedData;
+}
+
+NS_ASSUME_NONNULL_END
@@ -44,9 +44,11 @@
 #import "HUBComponentTargetBuilder.h"
 #import "HUBComponentTargetJSONSchema.h"
 #import "HUBComponentType.h"
+#import "HUBComponentUIStateCache.h"
 #import "HUBComponentViewObserver.h"
 #import "HUBComponentWithChildren.h"
 #import "HUBComponentWithImageHandling.h"
+#import "HUBComponentWithRecyclableChildren.h"
 #import "HUBComponentWithRestorableUIState.h"
 #import "HUBComponentWithScrolling.h"
 #import "HUBComponentWithSelectionState.h"
@@ -57,12 +59,15 @@
 #import "HUBContentOperationActionPerformer.h"
 #import "HUBContentOperationContext.h"
 #import "HUBContentOperationFactory.h"
+#import "HUBContentOperationRecorder.h"
+#import "HUBContentOperationWithConnectivityIndependentContent.h"
 #import "HUBContentOperationWithInitialContent.h"
 #import "HUBContentOperationWithPaginatedContent.h"
 #import "HUBContentReloadPolicy.h"
 #import "HUBDefaults.h"
 #import "HUBFeatureInfo.h"
 #import "HUBFeatureRegistry.h"
+#import "HUBFrameProfiler.h"
 #import "HubFramework.h"
 #import "HUBHeaderMacros.h"
 #import "HUBIcon.h"
@@ -70,6 +75,8 @@
 #import "HUBIdentifier.h"
 #import "HUBImageLoader.h"
 #import "HUBImageLoaderFactory.h"
+#import "HUBImageLoaderWithBatchedRequests.h"
+#import "HUBImageLoaderWithSizeVariants.h"
 #import "HUBJSONCompatibleBuilder.h"
 #import "HUBJSONPath.h"
 #import "HUBJSONSchema.h"
@@ -77,8 +84,10 @@
 #import "HUBLiveService.h"
 #import "HUBManager.h"
 #import "HUBMutableJSONPath.h"
+#import "HUBPerformanceObserver.h"
 #import "HUBScrollPosition.h"
 #import "HUBSerializable.h"
+#import "HUBStatelessAction.h"
 #import "HUBViewController.h"
 #import "HUBViewControllerFactory.h"
 #import "HUBViewControllerScrollHandler.h"